@@ -281,8 +281,9 @@ static void util(void) {
 }
 
 static void arith(void) {
-	bn_t a, b, c, d[3], e[3];
+	bn_t a, b, c, d[3], e[3], t[RLC_BN_TABLE];
 	crt_t crt;
+	mod_t ctx;
 	dig_t f;
 	int len;
 
@@ -290,6 +291,7 @@ static void arith(void) {
 	bn_null(b);
 	bn_null(c);
 	crt_null(crt);
+	mod_null(ctx);
 
 	bn_new(a);
 	bn_new(b);
@@ -300,7 +302,12 @@ static void arith(void) {
 		bn_new(d[j]);
 		bn_new(e[j]);
 	}
+	for (int j = 0; j < RLC_BN_TABLE; j++) {
+		bn_null(t[j]);
+		bn_new(t[j]);
+	}
 	crt_new(crt);
+	mod_new(ctx);
 
 	BENCH_RUN("bn_add") {
 		bn_rand(a, RLC_POS, RLC_BN_BITS);
@@ -667,6 +674,71 @@ static void arith(void) {
 	}
 	BENCH_END;
 
+	if (bn_is_even(b)) {
+		bn_add_dig(b, b, 1);
+	}
+	BENCH_RUN("bn_mxp_pre") {
+		bn_rand(a, RLC_POS, RLC_BN_BITS);
+		bn_mod(a, a, b);
+		BENCH_ADD(bn_mxp_pre(t, a, b));
+	}
+	BENCH_END;
+
+	BENCH_RUN("bn_mxp_fix") {
+		bn_rand(a, RLC_POS, RLC_BN_BITS);
+		bn_mod(a, a, b);
+		bn_mxp_pre(t, a, b);
+		BENCH_ADD(bn_mxp_fix(c, (const bn_t *)t, a, b));
+	}
+	BENCH_END;
+
+	BENCH_RUN("bn_mod_ctx") {
+		BENCH_ADD(bn_mod_ctx(ctx, b));
+	}
+	BENCH_END;
+
+	BENCH_RUN("bn_mod_ctx_conv") {
+		bn_rand(a, RLC_POS, RLC_BN_BITS);
+		bn_mod(a, a, b);
+		BENCH_ADD(bn_mod_ctx_conv(c, a, ctx));
+	}
+	BENCH_END;
+
+	BENCH_RUN("bn_mod_ctx_mul") {
+		bn_rand(a, RLC_POS, RLC_BN_BITS);
+		bn_mod(a, a, b);
+		bn_mod_ctx_conv(c, a, ctx);
+		BENCH_ADD(bn_mod_ctx_mul(c, c, a, ctx));
+	}
+	BENCH_END;
+
+	BENCH_RUN("bn_mxp_ctx") {
+		bn_rand(a, RLC_POS, RLC_BN_BITS);
+		bn_mod(a, a, b);
+		bn_mod_ctx_conv(a, a, ctx);
+		BENCH_ADD(bn_mxp_ctx(c, a, b, ctx));
+	}
+	BENCH_END;
+
+	BENCH_RUN("bn_mxp_ctx_many") {
+		for (int j = 0; j < 4; j++) {
+			bn_rand(t[j], RLC_POS, RLC_BN_BITS);
+			bn_mod(t[j], t[j], b);
+			bn_mod_ctx_conv(t[j], t[j], ctx);
+		}
+		BENCH_ADD(bn_mxp_ctx_many(t, (const bn_t *)t, b, ctx, 4));
+	}
+	BENCH_DIV(4);
+
+	BENCH_RUN("bn_mxp_x8") {
+		for (int j = 0; j < 8; j++) {
+			bn_rand(t[j], RLC_POS, RLC_BN_BITS);
+			bn_mod(t[j], t[j], b);
+		}
+		BENCH_ADD(bn_mxp_x8(t, (const bn_t *)t, b, b));
+	}
+	BENCH_DIV(8);
+
 	bn_gen_prime(crt->p, RLC_BN_BITS / 2);
 	bn_gen_prime(crt->q, RLC_BN_BITS / 2);
 	bn_mul(crt->n, crt->p, crt->q);
@@ -825,6 +897,8 @@ static void arith(void) {
 	BENCH_ONE("bn_gen_prime_stron", bn_gen_prime_stron(a, RLC_BN_BITS), 1);
 #endif
 
+	BENCH_ONE("bn_next_prime", bn_next_prime(c, a), 1);
+
 	BENCH_ONE("bn_is_prime", bn_is_prime(a), 1);
 
 	BENCH_ONE("bn_is_prime_basic", bn_is_prime_basic(a), 1);
@@ -962,7 +1036,74 @@ static void arith(void) {
 		bn_free(d[j]);
 		bn_free(e[j]);
 	}
+	for (int j = 0; j < RLC_BN_TABLE; j++) {
+		bn_free(t[j]);
+	}
 	crt_free(crt);
+	mod_free(ctx);
+}
+
+/**
+ * Benchmarks the polynomial operations over a set of the given size.
+ */
+#define BENCH_POLY(N)														\
+	BENCH_ONE("bn_lag (" #N ")", bn_lag(c, x, p, N), 1);					\
+	BENCH_ONE("bn_lag_fast (" #N ")", bn_lag_fast(c, x, p, N), 1);		\
+	BENCH_ONE("bn_evl (" #N ")",											\
+		for (i = 0; i < N; i++) bn_evl(y[i], c, x[i], p, N), 1);			\
+	BENCH_ONE("bn_evl_sim (" #N ")", bn_evl_sim(y, c, x, p, N, N), 1);	\
+	BENCH_ONE("bn_itp (" #N ")", bn_itp(c, x, y, p, N), 1);
+
+/**
+ * Benchmarks only the quasi-linear polynomial operations, for sets too large
+ * for the quadratic methods.
+ */
+#define BENCH_POLY_FAST(N)													\
+	BENCH_ONE("bn_lag_fast (" #N ")", bn_lag_fast(c, x, p, N), 1);		\
+	BENCH_ONE("bn_evl_sim (" #N ")", bn_evl_sim(y, c, x, p, N, N), 1);	\
+	BENCH_ONE("bn_itp (" #N ")", bn_itp(c, x, y, p, N), 1);
+
+static void poly(void) {
+	int i, n = 10000;
+	bn_t p, *c = RLC_MALLOC(bn_t, n + 1), *x = RLC_MALLOC(bn_t, n),
+		*y = RLC_MALLOC(bn_t, n);
+
+	bn_null(p);
+	bn_new(p);
+	for (i = 0; i <= n; i++) {
+		bn_null(c[i]);
+		bn_new(c[i]);
+	}
+	for (i = 0; i < n; i++) {
+		bn_null(x[i]);
+		bn_null(y[i]);
+		bn_new(x[i]);
+		bn_new(y[i]);
+	}
+
+	bn_gen_prime(p, RLC_BN_BITS);
+	for (i = 0; i < n; i++) {
+		bn_rand_mod(x[i], p);
+	}
+
+	BENCH_POLY(16);
+	BENCH_POLY(64);
+	BENCH_POLY(256);
+	BENCH_POLY(512);
+	BENCH_POLY_FAST(2048);
+	BENCH_POLY_FAST(10000);
+
+	bn_free(p);
+	for (i = 0; i <= n; i++) {
+		bn_free(c[i]);
+	}
+	for (i = 0; i < n; i++) {
+		bn_free(x[i]);
+		bn_free(y[i]);
+	}
+	alloc_free((void *)c);
+	alloc_free((void *)x);
+	alloc_free((void *)y);
 }
 
 int main(void) {
@@ -978,6 +1119,8 @@ int main(void) {
 	util();
 	util_banner("Arithmetic:", 1);
 	arith();
+	util_banner("Polynomials:", 1);
+	poly();
 
 	core_clean();
 	return 0;
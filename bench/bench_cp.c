@@ -35,12 +35,19 @@
 #include "relic.h"
 #include "relic_bench.h"
 
+/**
+ * Number of operations processed in a batch.
+ */
+#define BATCH	16
+
 #if defined(WITH_BN)
 
 static void rsa(void) {
 	rsa_t pub, prv;
 	uint8_t in[10], new[10], h[RLC_MD_LEN], out[RLC_BN_BITS / 8 + 1];
-	int out_len, new_len;
+	uint8_t ib[BATCH][10], nb[BATCH][10], ob[BATCH][RLC_BN_BITS / 8 + 1];
+	uint8_t *ip[BATCH], *np[BATCH], *op[BATCH];
+	int out_len, new_len, il[BATCH], nl[BATCH], ol[BATCH];
 
 	rsa_null(pub);
 	rsa_null(prv);
@@ -98,6 +105,31 @@ static void rsa(void) {
 		BENCH_ADD(cp_rsa_ver(out, out_len, h, RLC_MD_LEN, 1, pub));
 	} BENCH_END;
 
+	for (int j = 0; j < BATCH; j++) {
+		ip[j] = ib[j];
+		np[j] = nb[j];
+		op[j] = ob[j];
+		il[j] = sizeof(ib[j]);
+	}
+
+	BENCH_RUN("cp_rsa_dec_many") {
+		for (int j = 0; j < BATCH; j++) {
+			ol[j] = RLC_BN_BITS / 8 + 1;
+			nl[j] = sizeof(nb[j]);
+			rand_bytes(ib[j], il[j]);
+			cp_rsa_enc(ob[j], &ol[j], ib[j], il[j], pub);
+		}
+		BENCH_ADD(cp_rsa_dec_many(np, nl, op, ol, BATCH, prv));
+	} BENCH_DIV(BATCH);
+
+	BENCH_RUN("cp_rsa_sig_many (h = 0)") {
+		for (int j = 0; j < BATCH; j++) {
+			ol[j] = RLC_BN_BITS / 8 + 1;
+			rand_bytes(ib[j], il[j]);
+		}
+		BENCH_ADD(cp_rsa_sig_many(op, ol, ip, il, BATCH, 0, prv));
+	} BENCH_DIV(BATCH);
+
 	rsa_free(pub);
 	rsa_free(prv);
 }
@@ -174,12 +206,14 @@ static void benaloh(void) {
 static void paillier(void) {
 	bn_t c, m, pub;
 	phpe_t prv;
+	mod_t ctx;
     shpe_t spub, sprv;
 
 	bn_null(c);
 	bn_null(m);
 	bn_null(pub);
 	phpe_null(prv);
+	mod_null(ctx);
     shpe_null(spub);
     shpe_null(sprv);
 
@@ -188,6 +222,7 @@ static void paillier(void) {
 	bn_new(m);
 	bn_new(pub);
 	phpe_new(prv);
+	mod_new(ctx);
     shpe_new(spub);
     shpe_new(sprv);
 
@@ -198,6 +233,12 @@ static void paillier(void) {
 		BENCH_ADD(cp_phpe_enc(c, m, pub));
 	} BENCH_END;
 
+	cp_phpe_ctx(ctx, pub);
+	BENCH_RUN("cp_phpe_enc_ctx") {
+		bn_rand_mod(m, pub);
+		BENCH_ADD(cp_phpe_enc_ctx(c, m, pub, ctx));
+	} BENCH_END;
+
 	BENCH_RUN("cp_phpe_add") {
 		bn_rand_mod(m, pub);
 		cp_phpe_enc(c, m, pub);
@@ -241,6 +282,12 @@ static void paillier(void) {
 		BENCH_ADD(cp_ghpe_enc(c, m, pub, 1));
 	} BENCH_END;
 
+	cp_ghpe_ctx(ctx, pub, 1);
+	BENCH_RUN("cp_ghpe_enc_ctx (1)") {
+		bn_rand_mod(m, pub);
+		BENCH_ADD(cp_ghpe_enc_ctx(c, m, pub, 1, ctx));
+	} BENCH_END;
+
 	BENCH_RUN("cp_ghpe_dec (1)") {
 		bn_rand_mod(m, pub);
 		cp_ghpe_enc(m, c, pub, 1);
@@ -264,6 +311,7 @@ static void paillier(void) {
 	bn_free(m);
 	bn_free(pub);
 	phpe_free(prv);
+	mod_free(ctx);
     shpe_free(spub);
     shpe_free(sprv);
 }
@@ -373,18 +421,24 @@ static void ecies(void) {
 }
 
 static void ecdsa(void) {
-	uint8_t msg[5] = { 0, 1, 2, 3, 4 }, h[RLC_MD_LEN];
-	bn_t r, s, d;
-	ec_t p;
+	uint8_t msg[5] = { 0, 1, 2, 3, 4 }, h[RLC_MD_LEN], hb[BATCH][RLC_MD_LEN];
+	uint8_t *mb[BATCH];
+	int lb[BATCH], vb[BATCH];
+	bn_t r, s, d, k, n, rb[BATCH], sb[BATCH];
+	ec_t p, qb[BATCH], pb[BATCH];
 
 	bn_null(r);
 	bn_null(s);
 	bn_null(d);
+	bn_null(k);
+	bn_null(n);
 	ec_null(p);
 
 	bn_new(r);
 	bn_new(s);
 	bn_new(d);
+	bn_new(k);
+	bn_new(n);
 	ec_new(p);
 
 	BENCH_RUN("cp_ecdsa_gen") {
@@ -414,9 +468,54 @@ static void ecdsa(void) {
 	}
 	BENCH_END;
 
+	ec_curve_get_ord(n);
+	for (int i = 0; i < BATCH; i++) {
+		bn_new(rb[i]);
+		bn_new(sb[i]);
+		ec_new(qb[i]);
+		ec_new(pb[i]);
+		/* Sign with a small set of keys. */
+		if (i % 4 == 0) {
+			cp_ecdsa_gen(d, p);
+		}
+		ec_copy(qb[i], p);
+		rand_bytes(hb[i], RLC_MD_LEN);
+		mb[i] = hb[i];
+		lb[i] = RLC_MD_LEN;
+		cp_ecdsa_sig(rb[i], sb[i], hb[i], RLC_MD_LEN, 1, d);
+		/* Recover the point R = (e/s)G + (r/s)Q. */
+		bn_read_bin(k, hb[i], RLC_MD_LEN);
+		if (8 * RLC_MD_LEN > bn_bits(n)) {
+			bn_rsh(k, k, 8 * RLC_MD_LEN - bn_bits(n));
+		}
+		bn_mod_inv(s, sb[i], n);
+		bn_mul(k, k, s);
+		bn_mod(k, k, n);
+		bn_mul(s, rb[i], s);
+		bn_mod(s, s, n);
+		ec_mul_sim_gen(pb[i], k, qb[i], s);
+	}
+
+	BENCH_RUN("cp_ecdsa_ver_batch (16)") {
+		BENCH_ADD(cp_ecdsa_ver_batch(vb, rb, sb, mb, lb, 1, qb, NULL, BATCH));
+	} BENCH_DIV(BATCH);
+
+	BENCH_RUN("cp_ecdsa_ver_batch (16, R)") {
+		BENCH_ADD(cp_ecdsa_ver_batch(vb, rb, sb, mb, lb, 1, qb, pb, BATCH));
+	} BENCH_DIV(BATCH);
+
+	for (int i = 0; i < BATCH; i++) {
+		bn_free(rb[i]);
+		bn_free(sb[i]);
+		ec_free(qb[i]);
+		ec_free(pb[i]);
+	}
+
 	bn_free(r);
 	bn_free(s);
 	bn_free(d);
+	bn_free(k);
+	bn_free(n);
 	ec_free(p);
 }
 
@@ -696,6 +795,51 @@ static void etrs(void) {
 
 #endif /* WITH_EC */
 
+#if defined(WITH_ED)
+
+static void eddsa(void) {
+	uint8_t msg[5] = { 0, 1, 2, 3, 4 }, prv[RLC_EDDSA_LEN];
+	uint8_t pub[BATCH][RLC_EDDSA_LEN], sig[BATCH][RLC_EDDSA_SIG];
+	uint8_t hb[BATCH][RLC_MD_LEN], *sb[BATCH], *mb[BATCH], *pb[BATCH];
+	int lb[BATCH], vb[BATCH];
+
+	BENCH_RUN("cp_eddsa_gen") {
+		BENCH_ADD(cp_eddsa_gen(pub[0], prv));
+	}
+	BENCH_END;
+
+	BENCH_RUN("cp_eddsa_sign") {
+		BENCH_ADD(cp_eddsa_sig(sig[0], msg, 5, prv, pub[0]));
+	}
+	BENCH_END;
+
+	BENCH_RUN("cp_eddsa_ver") {
+		BENCH_ADD(cp_eddsa_ver(sig[0], msg, 5, pub[0]));
+	}
+	BENCH_END;
+
+	for (int i = 0; i < BATCH; i++) {
+		/* Sign with a small set of keys. */
+		if (i % 4 == 0) {
+			cp_eddsa_gen(pub[i], prv);
+		} else {
+			memcpy(pub[i], pub[i - 1], RLC_EDDSA_LEN);
+		}
+		rand_bytes(hb[i], RLC_MD_LEN);
+		cp_eddsa_sig(sig[i], hb[i], RLC_MD_LEN, prv, pub[i]);
+		sb[i] = sig[i];
+		mb[i] = hb[i];
+		lb[i] = RLC_MD_LEN;
+		pb[i] = pub[i];
+	}
+
+	BENCH_RUN("cp_eddsa_ver_batch (16)") {
+		BENCH_ADD(cp_eddsa_ver_batch(vb, sb, mb, lb, pb, BATCH));
+	} BENCH_DIV(BATCH);
+}
+
+#endif
+
 #if defined(WITH_PC)
 
 static void pdpub(void) {
@@ -1070,9 +1214,10 @@ static void bgn(void) {
 }
 
 static void bls(void) {
-	uint8_t msg[5] = { 0, 1, 2, 3, 4 };
-	g1_t s;
-	g2_t p;
+	uint8_t msg[5] = { 0, 1, 2, 3, 4 }, hb[BATCH][RLC_MD_LEN], *mb[BATCH];
+	int lb[BATCH], vb[BATCH];
+	g1_t s, sb[BATCH];
+	g2_t p, qb[BATCH];
 	bn_t d;
 
 	g1_null(s);
@@ -1098,6 +1243,41 @@ static void bls(void) {
 	}
 	BENCH_END;
 
+	for (int i = 0; i < BATCH; i++) {
+		g1_null(sb[i]);
+		g2_null(qb[i]);
+		g1_new(sb[i]);
+		g2_new(qb[i]);
+		rand_bytes(hb[i], RLC_MD_LEN);
+		mb[i] = hb[i];
+		lb[i] = RLC_MD_LEN;
+		cp_bls_gen(d, qb[i]);
+		cp_bls_sig(sb[i], mb[i], lb[i], d);
+	}
+
+	BENCH_RUN("cp_bls_agg_sig (16)") {
+		BENCH_ADD(cp_bls_agg_sig(s, sb, BATCH));
+	}
+	BENCH_END;
+
+	BENCH_FEW("cp_bls_agg_ver (16)", cp_bls_agg_ver(s, mb, lb, qb, BATCH), BATCH);
+
+	BENCH_FEW("cp_bls_ver_batch (16)",
+		cp_bls_ver_batch(vb, sb, mb, lb, qb, BATCH), BATCH);
+
+	for (int i = 0; i < BATCH; i++) {
+		cp_bls_gen(d, qb[i]);
+		cp_bls_sig(sb[i], msg, 5, d);
+	}
+	cp_bls_agg_sig(s, sb, BATCH);
+
+	BENCH_FEW("cp_bls_fast_ver (16)",
+		cp_bls_fast_ver(s, msg, 5, qb, BATCH), BATCH);
+
+	for (int i = 0; i < BATCH; i++) {
+		g1_free(sb[i]);
+		g2_free(qb[i]);
+	}
 	g1_free(s);
 	bn_free(d);
 	g2_free(p);
@@ -1994,6 +2174,13 @@ int main(void) {
 	}
 #endif
 
+#if defined(WITH_ED)
+	if (ed_param_set_any() == RLC_OK) {
+		util_banner("Protocols based on Edwards curves:\n", 0);
+		eddsa();
+	}
+#endif
+
 #if defined(WITH_PC)
 	if (pc_param_set_any() == RLC_OK) {
 		util_banner("Protocols based on pairings:\n", 0);
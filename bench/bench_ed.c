@@ -30,6 +30,8 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "relic.h"
 #include "relic_bench.h"
@@ -643,6 +645,79 @@ static void arith(void) {
 	bn_free(n);
 }
 
+/**
+ * Maximum number of points in the multi-scalar multiplication sweep.
+ */
+#define LOT_MAX		(1 << 16)
+
+/**
+ * Maximum number of points benchmarked with interleaving, which keeps its
+ * recodings on the stack.
+ */
+#define LOT_INTER	(1 << 12)
+
+static void lot(void) {
+	char label[32];
+	ed_t r, *p = malloc(LOT_MAX * sizeof(ed_t));
+	bn_t n, *k = malloc(LOT_MAX * sizeof(bn_t));
+
+	if (p == NULL || k == NULL) {
+		free(p);
+		free(k);
+		return;
+	}
+
+	bn_null(n);
+	ed_null(r);
+	bn_new(n);
+	ed_new(r);
+	ed_curve_get_ord(n);
+	for (int i = 0; i < LOT_MAX; i++) {
+		ed_null(p[i]);
+		ed_new(p[i]);
+		bn_null(k[i]);
+		bn_new(k[i]);
+		bn_rand_mod(k[i], n);
+		if (i < 16) {
+			ed_rand(p[i]);
+		} else {
+			ed_add(p[i], p[i - 16], p[i - 15]);
+		}
+	}
+	ed_norm_sim(p, (const ed_t *)p, LOT_MAX);
+
+	for (int m = 2; m <= LOT_MAX; m <<= 1) {
+		if (m <= LOT_INTER) {
+			snprintf(label, sizeof(label), "ed_mul_sim_lot_inter (%d)", m);
+			bench_reset();
+			util_print("BENCH: %s%*c = ", label, (int)(32 - strlen(label)), ' ');
+			bench_before();
+			ed_mul_sim_lot_inter(r, p, k, m);
+			bench_after();
+			bench_compute(1);
+			bench_print();
+		}
+
+		snprintf(label, sizeof(label), "ed_mul_sim_lot_bucket (%d)", m);
+		bench_reset();
+		util_print("BENCH: %s%*c = ", label, (int)(32 - strlen(label)), ' ');
+		bench_before();
+		ed_mul_sim_lot_bucket(r, p, k, m);
+		bench_after();
+		bench_compute(1);
+		bench_print();
+	}
+
+	bn_free(n);
+	ed_free(r);
+	for (int i = 0; i < LOT_MAX; i++) {
+		ed_free(p[i]);
+		bn_free(k[i]);
+	}
+	free(p);
+	free(k);
+}
+
 static void bench(void) {
 	ed_param_print();
 	util_banner("Utilities:", 1);
@@ -650,6 +725,8 @@ static void bench(void) {
 	util();
 	util_banner("Arithmetic:", 1);
 	arith();
+	util_banner("Multi-scalar multiplication:", 1);
+	lot();
 }
 
 int main(void) {
@@ -30,6 +30,8 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "relic.h"
 #include "relic_bench.h"
@@ -55,7 +57,8 @@ static void memory(void) {
 static void util(void) {
 	ep_t p, q, t[4];
 	uint8_t bin[2 * RLC_FP_BYTES + 1];
-	int l;
+	int l, id = ep_param_get();
+	ctx_t *par;
 
 	ep_null(p);
 	ep_null(q);
@@ -179,6 +182,18 @@ static void util(void) {
 		BENCH_ADD(ep_read_bin(p, bin, l));
 	} BENCH_END;
 
+	BENCH_FEW("ep_param_set", ep_param_set(ep_param_get()), 1);
+
+	par = core_par_new();
+	core_par_set(par);
+	ep_param_set(id);
+	core_par_set(NULL);
+	BENCH_RUN("core_par_set") {
+		BENCH_ADD(core_par_set(par));
+		core_par_set(NULL);
+	} BENCH_END;
+	core_par_free(par);
+
 	ep_free(p);
 	ep_free(q);
 	for (int j = 0; j < 4; j++) {
@@ -189,6 +204,7 @@ static void util(void) {
 static void arith(void) {
 	ep_t p, q, r, t[RLC_EP_TABLE_MAX];
 	bn_t k, l[2], n;
+	uint8_t *bin;
 
 	ep_null(p);
 	ep_null(q);
@@ -417,6 +433,21 @@ static void arith(void) {
 		BENCH_ADD(ep_mul_fix(q, (const ep_t *)t, k));
 	} BENCH_END;
 
+	bin = RLC_ALLOCA(uint8_t, ep_size_pre());
+	BENCH_RUN("ep_write_pre") {
+		ep_rand(p);
+		ep_mul_pre(t, p);
+		BENCH_ADD(ep_write_pre(bin, ep_size_pre(), (const ep_t *)t));
+	} BENCH_END;
+
+	BENCH_RUN("ep_read_pre") {
+		ep_rand(p);
+		ep_mul_pre(t, p);
+		ep_write_pre(bin, ep_size_pre(), (const ep_t *)t);
+		BENCH_ADD(ep_read_pre(t, bin, ep_size_pre()));
+	} BENCH_END;
+	RLC_FREE(bin);
+
 	for (int i = 0; i < RLC_EP_TABLE; i++) {
 		ep_free(t[i]);
 	}
@@ -575,6 +606,24 @@ static void arith(void) {
 		BENCH_ADD(ep_map(p, msg, 5));
 	} BENCH_END;
 
+	BENCH_RUN("ep_map_dst_many (16)") {
+		ep_t s[16];
+		uint8_t msg[16][5];
+		const uint8_t *m[16];
+		int l[16];
+		rand_bytes(msg[0], sizeof(msg));
+		for (int i = 0; i < 16; i++) {
+			ep_null(s[i]);
+			ep_new(s[i]);
+			m[i] = msg[i];
+			l[i] = 5;
+		}
+		BENCH_ADD(ep_map_dst_many(s, m, l, 16, (const uint8_t *)"RELIC", 5));
+		for (int i = 0; i < 16; i++) {
+			ep_free(s[i]);
+		}
+	} BENCH_DIV(16);
+
 	BENCH_RUN("ep_pck") {
 		ep_rand(p);
 		BENCH_ADD(ep_pck(q, p));
@@ -585,6 +634,23 @@ static void arith(void) {
 		BENCH_ADD(ep_upk(q, p));
 	} BENCH_END;
 
+	BENCH_RUN("ep_upk_many (16)") {
+		ep_t s[16], t[16];
+		for (int i = 0; i < 16; i++) {
+			ep_null(s[i]);
+			ep_null(t[i]);
+			ep_new(s[i]);
+			ep_new(t[i]);
+			ep_rand(s[i]);
+			ep_pck(t[i], s[i]);
+		}
+		BENCH_ADD(ep_upk_many(s, (const ep_t *)t, 16));
+		for (int i = 0; i < 16; i++) {
+			ep_free(s[i]);
+			ep_free(t[i]);
+		}
+	} BENCH_DIV(16);
+
 	ep_free(p);
 	ep_free(q);
 	ep_free(r);
@@ -594,6 +660,79 @@ static void arith(void) {
 	bn_free(n);
 }
 
+/**
+ * Maximum number of points in the multi-scalar multiplication sweep.
+ */
+#define LOT_MAX		(1 << 16)
+
+/**
+ * Maximum number of points benchmarked with interleaving, which keeps its
+ * recodings on the stack.
+ */
+#define LOT_INTER	(1 << 12)
+
+static void lot(void) {
+	char label[32];
+	ep_t r, *p = malloc(LOT_MAX * sizeof(ep_t));
+	bn_t n, *k = malloc(LOT_MAX * sizeof(bn_t));
+
+	if (p == NULL || k == NULL) {
+		free(p);
+		free(k);
+		return;
+	}
+
+	bn_null(n);
+	ep_null(r);
+	bn_new(n);
+	ep_new(r);
+	ep_curve_get_ord(n);
+	for (int i = 0; i < LOT_MAX; i++) {
+		ep_null(p[i]);
+		ep_new(p[i]);
+		bn_null(k[i]);
+		bn_new(k[i]);
+		bn_rand_mod(k[i], n);
+		if (i < 16) {
+			ep_rand(p[i]);
+		} else {
+			ep_add(p[i], p[i - 16], p[i - 15]);
+		}
+	}
+	ep_norm_sim(p, (const ep_t *)p, LOT_MAX);
+
+	for (int m = 2; m <= LOT_MAX; m <<= 1) {
+		if (m <= LOT_INTER) {
+			snprintf(label, sizeof(label), "ep_mul_sim_lot_inter (%d)", m);
+			bench_reset();
+			util_print("BENCH: %s%*c = ", label, (int)(32 - strlen(label)), ' ');
+			bench_before();
+			ep_mul_sim_lot_inter(r, p, k, m);
+			bench_after();
+			bench_compute(1);
+			bench_print();
+		}
+
+		snprintf(label, sizeof(label), "ep_mul_sim_lot_bucket (%d)", m);
+		bench_reset();
+		util_print("BENCH: %s%*c = ", label, (int)(32 - strlen(label)), ' ');
+		bench_before();
+		ep_mul_sim_lot_bucket(r, p, k, m);
+		bench_after();
+		bench_compute(1);
+		bench_print();
+	}
+
+	bn_free(n);
+	ep_free(r);
+	for (int i = 0; i < LOT_MAX; i++) {
+		ep_free(p[i]);
+		bn_free(k[i]);
+	}
+	free(p);
+	free(k);
+}
+
 static void bench(void) {
 	ep_param_print();
 	util_banner("Utilities:", 1);
@@ -601,6 +740,8 @@ static void bench(void) {
 	util();
 	util_banner("Arithmetic:", 1);
 	arith();
+	util_banner("Multi-scalar multiplication:", 1);
+	lot();
 }
 
 int main(void) {
@@ -34,6 +34,11 @@
 #include "relic.h"
 #include "relic_bench.h"
 
+/**
+ * Number of points used to benchmark multi-scalar multiplication.
+ */
+#define BENCH_LOT	32
+
 static void memory2(void) {
 	ep4_t a[BENCH];
 
@@ -179,8 +184,9 @@ static void util2(void) {
 }
 
 static void arith2(void) {
-	ep2_t p, q, r, t[RLC_EPX_TABLE_MAX];
-	bn_t k, n, l[2];
+	ep2_t p, q, r, t[RLC_EPX_TABLE_MAX], u[BENCH_LOT];
+	bn_t k, n, l[2], v[BENCH_LOT];
+	uint8_t *bin;
 	fp2_t s;
 
 	ep2_null(p);
@@ -385,6 +391,21 @@ static void arith2(void) {
 		BENCH_ADD(ep2_mul_fix(q, t, k));
 	} BENCH_END;
 
+	bin = RLC_ALLOCA(uint8_t, ep2_size_pre());
+	BENCH_RUN("ep2_write_pre") {
+		ep2_rand(p);
+		ep2_mul_pre(t, p);
+		BENCH_ADD(ep2_write_pre(bin, ep2_size_pre(), t));
+	} BENCH_END;
+
+	BENCH_RUN("ep2_read_pre") {
+		ep2_rand(p);
+		ep2_mul_pre(t, p);
+		ep2_write_pre(bin, ep2_size_pre(), t);
+		BENCH_ADD(ep2_read_pre(t, bin, ep2_size_pre()));
+	} BENCH_END;
+	RLC_FREE(bin);
+
 	for (int i = 0; i < RLC_EPX_TABLE_MAX; i++) {
 		ep2_free(t[i]);
 	}
@@ -538,6 +559,26 @@ static void arith2(void) {
 		ep2_free(t[i]);
 	}
 
+	for (int i = 0; i < BENCH_LOT; i++) {
+		ep2_new(u[i]);
+		bn_new(v[i]);
+		ep2_rand(u[i]);
+		bn_rand_mod(v[i], n);
+	}
+
+	BENCH_RUN("ep2_mul_sim_lot_inter (32)") {
+		BENCH_ADD(ep2_mul_sim_lot_inter(r, u, v, BENCH_LOT));
+	} BENCH_END;
+
+	BENCH_RUN("ep2_mul_sim_lot_bucket (32)") {
+		BENCH_ADD(ep2_mul_sim_lot_bucket(r, u, v, BENCH_LOT));
+	} BENCH_END;
+
+	for (int i = 0; i < BENCH_LOT; i++) {
+		ep2_free(u[i]);
+		bn_free(v[i]);
+	}
+
 	BENCH_RUN("ep2_frb") {
 		ep2_rand(q);
 		BENCH_ADD(ep2_frb(r, q, 1));
@@ -549,6 +590,24 @@ static void arith2(void) {
 		BENCH_ADD(ep2_map(p, msg, 5));
 	} BENCH_END;
 
+	BENCH_RUN("ep2_map_dst_many (16)") {
+		ep2_t s[16];
+		uint8_t msg[16][5];
+		const uint8_t *m[16];
+		int l[16];
+		rand_bytes(msg[0], sizeof(msg));
+		for (int i = 0; i < 16; i++) {
+			ep2_null(s[i]);
+			ep2_new(s[i]);
+			m[i] = msg[i];
+			l[i] = 5;
+		}
+		BENCH_ADD(ep2_map_dst_many(s, m, l, 16, (const uint8_t *)"RELIC", 5));
+		for (int i = 0; i < 16; i++) {
+			ep2_free(s[i]);
+		}
+	} BENCH_DIV(16);
+
 	BENCH_RUN("ep2_pck") {
 		ep2_rand(p);
 		BENCH_ADD(ep2_pck(q, p));
@@ -559,6 +618,23 @@ static void arith2(void) {
 		BENCH_ADD(ep2_upk(q, p));
 	} BENCH_END;
 
+	BENCH_RUN("ep2_upk_many (16)") {
+		ep2_t s[16], t[16];
+		for (int i = 0; i < 16; i++) {
+			ep2_null(s[i]);
+			ep2_null(t[i]);
+			ep2_new(s[i]);
+			ep2_new(t[i]);
+			ep2_rand(s[i]);
+			ep2_pck(t[i], s[i]);
+		}
+		BENCH_ADD(ep2_upk_many(s, (const ep2_t *)t, 16));
+		for (int i = 0; i < 16; i++) {
+			ep2_free(s[i]);
+			ep2_free(t[i]);
+		}
+	} BENCH_DIV(16);
+
 	ep2_free(p);
 	ep2_free(q);
 	ep2_free(r);
@@ -696,8 +772,8 @@ static void util4(void) {
 }
 
 static void arith4(void) {
-	ep4_t p, q, r, t[RLC_EPX_TABLE_MAX];
-	bn_t k, n, l;
+	ep4_t p, q, r, t[RLC_EPX_TABLE_MAX], u[BENCH_LOT];
+	bn_t k, n, l, v[BENCH_LOT];
 	fp4_t s;
 
 	ep4_null(p);
@@ -1038,6 +1114,26 @@ static void arith4(void) {
 		BENCH_ADD(ep4_mul_sim_gen(r, k, q, l));
 	} BENCH_END;
 
+	for (int i = 0; i < BENCH_LOT; i++) {
+		ep4_new(u[i]);
+		bn_new(v[i]);
+		ep4_rand(u[i]);
+		bn_rand_mod(v[i], n);
+	}
+
+	BENCH_RUN("ep4_mul_sim_lot_inter (32)") {
+		BENCH_ADD(ep4_mul_sim_lot_inter(r, u, v, BENCH_LOT));
+	} BENCH_END;
+
+	BENCH_RUN("ep4_mul_sim_lot_bucket (32)") {
+		BENCH_ADD(ep4_mul_sim_lot_bucket(r, u, v, BENCH_LOT));
+	} BENCH_END;
+
+	for (int i = 0; i < BENCH_LOT; i++) {
+		ep4_free(u[i]);
+		bn_free(v[i]);
+	}
+
 	BENCH_RUN("ep4_frb") {
 		ep4_rand(q);
 		BENCH_ADD(ep4_frb(r, q, 1));
@@ -166,8 +166,8 @@ static void util(void) {
 }
 
 static void arith(void) {
-	fp_t a, b, c, f[2];
-	dv_t d;
+	fp_t a, b, c, f[2], g[8], h[8];
+	dv_t d, t[8];
 	bn_t e;
 
 	fp_null(a);
@@ -177,6 +177,11 @@ static void arith(void) {
 	bn_null(e);
 	fp_null(f[0]);
 	fp_null(f[1]);
+	for (int j = 0; j < 8; j++) {
+		fp_null(g[j]);
+		fp_null(h[j]);
+		dv_null(t[j]);
+	}
 
 	fp_new(a);
 	fp_new(b);
@@ -185,6 +190,12 @@ static void arith(void) {
 	bn_new(e);
 	fp_new(f[0]);
 	fp_new(f[1]);
+	for (int j = 0; j < 8; j++) {
+		fp_new(g[j]);
+		fp_new(h[j]);
+		dv_new(t[j]);
+		dv_zero(t[j], RLC_DV_DIGS);
+	}
 
 	dv_zero(d, RLC_DV_DIGS);
 
@@ -227,6 +238,15 @@ static void arith(void) {
 	}
 	BENCH_END;
 
+	BENCH_RUN("fp_add_many") {
+		for (int j = 0; j < 8; j++) {
+			fp_rand(g[j]);
+			fp_rand(h[j]);
+		}
+		BENCH_ADD(fp_add_many(g, (const fp_t *)g, (const fp_t *)h, 8));
+	}
+	BENCH_DIV(8);
+
 	BENCH_RUN("fp_sub") {
 		fp_rand(a);
 		fp_rand(b);
@@ -234,6 +254,15 @@ static void arith(void) {
 	}
 	BENCH_END;
 
+	BENCH_RUN("fp_sub_many") {
+		for (int j = 0; j < 8; j++) {
+			fp_rand(g[j]);
+			fp_rand(h[j]);
+		}
+		BENCH_ADD(fp_sub_many(g, (const fp_t *)g, (const fp_t *)h, 8));
+	}
+	BENCH_DIV(8);
+
 #if FP_ADD == BASIC || !defined(STRIP)
 	BENCH_RUN("fp_sub_basic") {
 		fp_rand(a);
@@ -338,6 +367,24 @@ static void arith(void) {
 	}
 	BENCH_END;
 
+	BENCH_RUN("fp_mul_x8") {
+		for (int j = 0; j < 8; j++) {
+			fp_rand(g[j]);
+			fp_rand(h[j]);
+		}
+		BENCH_ADD(fp_mul_x8(g, (const fp_t *)g, (const fp_t *)h));
+	}
+	BENCH_DIV(8);
+
+	BENCH_RUN("fp_mul_many") {
+		for (int j = 0; j < 8; j++) {
+			fp_rand(g[j]);
+			fp_rand(h[j]);
+		}
+		BENCH_ADD(fp_mul_many(g, (const fp_t *)g, (const fp_t *)h, 8));
+	}
+	BENCH_DIV(8);
+
 	BENCH_RUN("fp_sqr") {
 		fp_rand(a);
 		BENCH_ADD(fp_sqr(c, a));
@@ -368,6 +415,14 @@ static void arith(void) {
 	BENCH_END;
 #endif
 
+	BENCH_RUN("fp_sqr_many") {
+		for (int j = 0; j < 8; j++) {
+			fp_rand(g[j]);
+		}
+		BENCH_ADD(fp_sqr_many(g, (const fp_t *)g, 8));
+	}
+	BENCH_DIV(8);
+
 	BENCH_RUN("fp_dbl") {
 		fp_rand(a);
 		BENCH_ADD(fp_dbl(c, a));
@@ -480,6 +535,15 @@ static void arith(void) {
 	}
 #endif
 
+	BENCH_RUN("fp_rdc_many") {
+		for (int j = 0; j < 8; j++) {
+			fp_rand(g[j]);
+			fp_lsh(t[j], g[j], RLC_FP_BITS);
+		}
+		BENCH_ADD(fp_rdc_many(h, t, 8));
+	}
+	BENCH_DIV(8);
+
 	BENCH_RUN("fp_inv") {
 		fp_rand(a);
 		BENCH_ADD(fp_inv(c, a));
@@ -626,6 +690,15 @@ static void arith(void) {
 	BENCH_END;
 #endif
 
+	BENCH_RUN("fp_exp_many") {
+		for (int j = 0; j < 8; j++) {
+			fp_rand(g[j]);
+		}
+		bn_rand(e, RLC_POS, RLC_FP_BITS);
+		BENCH_ADD(fp_exp_many(h, (const fp_t *)g, e, 8));
+	}
+	BENCH_DIV(8);
+
 	BENCH_RUN("fp_srt") {
 		fp_rand(a);
 		fp_sqr(a, a);
@@ -633,6 +706,15 @@ static void arith(void) {
 	}
 	BENCH_END;
 
+	BENCH_RUN("fp_srt_many") {
+		for (int j = 0; j < 8; j++) {
+			fp_rand(g[j]);
+			fp_sqr(g[j], g[j]);
+		}
+		BENCH_ADD(fp_srt_many(h, NULL, (const fp_t *)g, 8));
+	}
+	BENCH_DIV(8);
+
 	BENCH_RUN("fp_prime_conv") {
 		bn_rand(e, RLC_POS, RLC_FP_BITS);
 		BENCH_ADD(fp_prime_conv(a, e));
@@ -658,6 +740,11 @@ static void arith(void) {
 	bn_free(e);
 	fp_free(f[0]);
 	fp_free(f[1]);
+	for (int j = 0; j < 8; j++) {
+		fp_free(g[j]);
+		fp_free(h[j]);
+		dv_free(t[j]);
+	}
 }
 
 int main(void) {
@@ -43,6 +43,21 @@ static void hash(void) {
 		BENCH_ADD(md_map(hash, buf, sizeof(buf)));
 	} BENCH_END;
 
+#if MD_MAP == SH256
+	BENCH_RUN("md_map_sh256_many (32)") {
+		uint8_t out[32][RLC_MD_LEN], *dig[32];
+		const uint8_t *msg[32];
+		int len[32];
+		rand_bytes(buf, sizeof(buf));
+		for (int i = 0; i < 32; i++) {
+			msg[i] = buf;
+			len[i] = sizeof(buf);
+			dig[i] = out[i];
+		}
+		BENCH_ADD(md_map_sh256_many(dig, msg, len, 32));
+	} BENCH_DIV(32);
+#endif
+
 	BENCH_RUN("md_xmd (256)") {
 		rand_bytes(buf, sizeof(buf));
 		BENCH_ADD(md_xmd(buf, sizeof(buf), buf, sizeof(buf), dst, 5));
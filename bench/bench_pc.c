@@ -34,6 +34,11 @@
 #include "relic.h"
 #include "relic_bench.h"
 
+/**
+ * Number of elements used to benchmark multi-exponentiation.
+ */
+#define BENCH_LOT	32
+
 static void memory1(void) {
 	g1_t a[BENCH];
 
@@ -650,8 +655,8 @@ static void util(void) {
 }
 
 static void arith(void) {
-	gt_t a, b, c;
-	bn_t d, e, f;
+	gt_t a, b, c, g[BENCH_LOT];
+	bn_t d, e, f, h[BENCH_LOT];
 
 	gt_new(a);
 	gt_new(b);
@@ -705,6 +710,24 @@ static void arith(void) {
 	}
 	BENCH_END;
 
+	gt_get_ord(d);
+	for (int i = 0; i < BENCH_LOT; i++) {
+		gt_new(g[i]);
+		bn_new(h[i]);
+		gt_rand(g[i]);
+		bn_rand_mod(h[i], d);
+	}
+
+	BENCH_RUN("gt_exp_sim_lot (32)") {
+		BENCH_ADD(gt_exp_sim_lot(c, g, h, BENCH_LOT));
+	}
+	BENCH_END;
+
+	for (int i = 0; i < BENCH_LOT; i++) {
+		gt_free(g[i]);
+		bn_free(h[i]);
+	}
+
 	BENCH_RUN("gt_exp_dig") {
 		gt_rand(a);
 		pc_get_ord(d);
@@ -722,8 +745,8 @@ static void arith(void) {
 }
 
 static void pairing(void) {
-	g1_t p[2];
-	g2_t q[2];
+	g1_t p[2], s[BENCH_LOT];
+	g2_t q[2], t[BENCH_LOT];
 	gt_t r;
 
 	g1_new(p[0]);
@@ -752,6 +775,23 @@ static void pairing(void) {
 	}
 	BENCH_END;
 
+	for (int i = 0; i < BENCH_LOT; i++) {
+		g1_new(s[i]);
+		g2_new(t[i]);
+		g1_rand(s[i]);
+		g2_rand(t[i]);
+	}
+
+	BENCH_RUN("pc_map_sim (32)") {
+		BENCH_ADD(pc_map_sim(r, s, t, BENCH_LOT));
+	}
+	BENCH_END;
+
+	for (int i = 0; i < BENCH_LOT; i++) {
+		g1_free(s[i]);
+		g2_free(t[i]);
+	}
+
 	g1_free(p[0]);
 	g2_free(q[0]);
 	g1_free(p[1]);
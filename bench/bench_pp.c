@@ -337,8 +337,9 @@ static void pairing12(void) {
 	bn_t k, n, l;
 	ep2_t p[2], r;
 	ep_t q[2];
-	fp12_t e;
-	int j;
+	fp12_t e, f[RLC_PP_EXP_BLK];
+	fp2_t t[2][RLC_PP_TABLE_K12], *_t[2];
+	int j, m;
 
 	bn_null(k);
 	bn_null(n);
@@ -351,12 +352,21 @@ static void pairing12(void) {
 	bn_new(l);
 	ep2_new(r);
 	fp12_new(e);
+	for (j = 0; j < RLC_PP_EXP_BLK; j++) {
+		fp12_null(f[j]);
+		fp12_new(f[j]);
+	}
 
 	for (j = 0; j < 2; j++) {
 		ep2_null(p[j]);
 		ep_null(q[j]);
 		ep2_new(p[j]);
 		ep_new(q[j]);
+		for (m = 0; m < RLC_PP_TABLE_K12; m++) {
+			fp2_null(t[j][m]);
+			fp2_new(t[j][m]);
+		}
+		_t[j] = t[j];
 	}
 
 	ep2_curve_get_ord(n);
@@ -467,6 +477,14 @@ static void pairing12(void) {
 	}
 	BENCH_END;
 
+	BENCH_RUN("pp_exp_k12_many") {
+		for (j = 0; j < RLC_PP_EXP_BLK; j++) {
+			fp12_rand(f[j]);
+		}
+		BENCH_ADD(pp_exp_k12_many(f, f, RLC_PP_EXP_BLK));
+	}
+	BENCH_DIV(RLC_PP_EXP_BLK);
+
 	BENCH_RUN("pp_map_k12") {
 		ep2_rand(p[0]);
 		ep_rand(q[0]);
@@ -539,21 +557,66 @@ static void pairing12(void) {
 	BENCH_END;
 #endif
 
+#if PP_MAP == OATEP || !defined(STRIP)
+	BENCH_RUN("pp_map_sim_oatep_k12_aff (2)") {
+		ep2_rand(p[0]);
+		ep_rand(q[0]);
+		ep2_rand(p[1]);
+		ep_rand(q[1]);
+		BENCH_ADD(pp_map_sim_oatep_k12_aff(e, q, p, 2));
+	}
+	BENCH_END;
+#endif
+
+#if PP_MAP == OATEP || !defined(STRIP)
+	BENCH_RUN("pp_map_pre_k12") {
+		ep2_rand(p[0]);
+		BENCH_ADD(pp_map_pre_k12(t[0], p[0]));
+	}
+	BENCH_END;
+
+	BENCH_RUN("pp_map_oatep_k12_pre") {
+		ep2_rand(p[0]);
+		ep_rand(q[0]);
+		pp_map_pre_k12(t[0], p[0]);
+		BENCH_ADD(pp_map_oatep_k12_pre(e, q[0], t[0]));
+	}
+	BENCH_END;
+
+	BENCH_RUN("pp_map_sim_oatep_k12_pre (2)") {
+		ep2_rand(p[0]);
+		ep_rand(q[0]);
+		ep2_rand(p[1]);
+		ep_rand(q[1]);
+		pp_map_pre_k12(t[0], p[0]);
+		pp_map_pre_k12(t[1], p[1]);
+		BENCH_ADD(pp_map_sim_oatep_k12_pre(e, q, _t, 2));
+	}
+	BENCH_END;
+#endif
+
 	bn_free(k);
 	bn_free(n);
 	bn_free(l);
 	fp12_free(e);
+	for (j = 0; j < RLC_PP_EXP_BLK; j++) {
+		fp12_free(f[j]);
+	}
 	ep2_free(r);
 	for (j = 0; j < 2; j++) {
 		ep2_free(p[j]);
 		ep_free(q[j]);
+		for (m = 0; m < RLC_PP_TABLE_K12; m++) {
+			fp2_free(t[j][m]);
+		}
 	}
 }
 
 static void pairing48(void) {
 	ep_t p;
-	fp8_t qx, qy, qz;
-	fp48_t e;
+	fp8_t qx, qy, qz, t[RLC_PP_TABLE_K48];
+	fp48_t e, f[RLC_PP_EXP_BLK];
+	int j;
 
 	ep_null(p);
 	fp8_null(qx);
@@ -566,6 +629,14 @@ static void pairing48(void) {
 	fp8_new(qy);
 	fp8_new(qz);
 	fp48_new(e);
+	for (j = 0; j < RLC_PP_EXP_BLK; j++) {
+		fp48_null(f[j]);
+		fp48_new(f[j]);
+	}
+	for (j = 0; j < RLC_PP_TABLE_K48; j++) {
+		fp8_null(t[j]);
+		fp8_new(t[j]);
+	}
 
 	BENCH_RUN("pp_add_k48") {
 		fp8_rand(qx);
@@ -634,6 +705,14 @@ static void pairing48(void) {
 	}
 	BENCH_END;
 
+	BENCH_RUN("pp_exp_k48_many") {
+		for (j = 0; j < RLC_PP_EXP_BLK; j++) {
+			fp48_rand(f[j]);
+		}
+		BENCH_ADD(pp_exp_k48_many(f, f, RLC_PP_EXP_BLK));
+	}
+	BENCH_DIV(RLC_PP_EXP_BLK);
+
 	BENCH_RUN("pp_map_k48") {
 		fp8_rand(qx);
 		fp8_rand(qy);
@@ -643,11 +722,33 @@ static void pairing48(void) {
 	}
 	BENCH_END;
 
+	BENCH_RUN("pp_map_pre_k48") {
+		fp8_rand(qx);
+		fp8_rand(qy);
+		BENCH_ADD(pp_map_pre_k48(t, qx, qy));
+	}
+	BENCH_END;
+
+	BENCH_RUN("pp_map_k48_pre") {
+		fp8_rand(qx);
+		fp8_rand(qy);
+		ep_rand(p);
+		pp_map_pre_k48(t, qx, qy);
+		BENCH_ADD(pp_map_k48_pre(e, p, t));
+	}
+	BENCH_END;
+
 	ep_free(p);
 	fp8_free(qx);
 	fp8_free(qy);
 	fp8_free(qz);
 	fp48_free(e);
+	for (j = 0; j < RLC_PP_EXP_BLK; j++) {
+		fp48_free(f[j]);
+	}
+	for (j = 0; j < RLC_PP_TABLE_K48; j++) {
+		fp8_free(t[j]);
+	}
 }
 
 static void pairing54(void) {
@@ -1,12 +1,13 @@
 message(STATUS "Multiple precision arithmetic configuration (BN module):\n")
 
-message("   ** Options for the multiple precision module (default = 1024,DOUBLE,0):\n")
+message("   ** Options for the multiple precision module (default = 1024,DOUBLE,0,6):\n")
 
 message("      BN_PRECI=n        The base precision in bits. Let w be n in words.")
 message("      BN_MAGNI=DOUBLE   A multiple precision integer can store 2w words.")
 message("      BN_MAGNI=CARRY    A multiple precision integer can store w+1 words.")
 message("      BN_MAGNI=SINGLE   A multiple precision integer can store w words.")
-message("      BN_KARAT=n        The number of Karatsuba steps.\n")
+message("      BN_KARAT=n        The number of Karatsuba steps.")
+message("      BN_DEPTH=w        Width w in [2,8] of precomputation table for fixed base methods.\n")
 
 message("   ** Available multiple precision arithmetic methods (default = COMBA;COMBA;MONTY;SLIDE;BASIC;BASIC):\n")
 
@@ -52,6 +53,12 @@ if (NOT BN_KARAT)
 endif(NOT BN_KARAT)
 set(BN_KARAT ${BN_KARAT} CACHE STRING "Number of Karatsuba levels.")
 
+# Fix the width of the fixed base precomputation tables.
+if (NOT BN_DEPTH)
+	set(BN_DEPTH 6)
+endif(NOT BN_DEPTH)
+set(BN_DEPTH ${BN_DEPTH} CACHE STRING "Width of precomputation table for fixed base methods.")
+
 if (NOT BN_MAGNI)
 	set(BN_MAGNI "DOUBLE")
 endif(NOT BN_MAGNI)
@@ -305,6 +305,35 @@ void bn_div1_low(dig_t *c, dig_t *d, const dig_t *a, int size, dig_t digit);
 void bn_modn_low(dig_t *c, const dig_t *a, int sa, const dig_t *m, int sm,
 	dig_t u);
 
+/**
+ * Multiplies eight pairs of digit vectors with Montgomery reduction. Computes
+ * c_i = a_i * b_i * R^(-1) mod m, where R = 2^(size * RLC_DIG). The inputs
+ * must be reduced modulo m and the outputs are fully reduced.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the first digit vectors to multiply.
+ * @param[in] b				- the second digit vectors to multiply.
+ * @param[in] m				- the modulus.
+ * @param[in] u				- the reciprocal of the modulus.
+ * @param[in] size			- the number of digits, at most RLC_BN_SIZE.
+ */
+void bn_mulm_x8_low(dig_t *c[], const dig_t *a[], const dig_t *b[],
+		const dig_t *m, dig_t u, int size);
+
+/**
+ * Reduces eight double-precision digit vectors with Montgomery reduction.
+ * Computes c_i = a_i * R^(-1) mod m, where R = 2^(size * RLC_DIG). The inputs
+ * must be smaller than m * R and the outputs are fully reduced.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the digit vectors to reduce.
+ * @param[in] m				- the modulus.
+ * @param[in] u				- the reciprocal of the modulus.
+ * @param[in] size			- the number of digits of the modulus.
+ */
+void bn_rdcm_x8_low(dig_t *c[], const dig_t *a[], const dig_t *m, dig_t u,
+		int size);
+
 #endif /* !ASM */
 
 #endif /* !RLC_BN_LOW_H */
@@ -82,6 +82,16 @@ dig_t fp_addn_low(dig_t *c, const dig_t *a, const dig_t *b);
  */
 void fp_addm_low(dig_t *c, const dig_t *a, const dig_t *b);
 
+/**
+ * Adds eight pairs of digit vectors with integrated modular reduction.
+ * Computes c_i = a_i + b_i.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the first digit vectors to add.
+ * @param[in] b				- the second digit vectors to add.
+ */
+void fp_addm_x8_low(dig_t *c[], const dig_t *a[], const dig_t *b[]);
+
 /**
  * Adds two double-length digit vectors. Computes c = a + b.
  *
@@ -133,6 +143,16 @@ dig_t fp_subn_low(dig_t *c, const dig_t *a, const dig_t *b);
  */
 void fp_subm_low(dig_t *c, const dig_t *a, const dig_t *b);
 
+/**
+ * Subtracts eight pairs of digit vectors with integrated modular reduction.
+ * Computes c_i = a_i - b_i.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the digit vectors.
+ * @param[in] b				- the digit vectors to subtract.
+ */
+void fp_subm_x8_low(dig_t *c[], const dig_t *a[], const dig_t *b[]);
+
 /**
  * Subtracts a double-length digit vector from another digit vector.
  * Computes c = a - b.
@@ -279,6 +299,16 @@ void fp_muln_low(dig_t *c, const dig_t *a, const dig_t *b);
  */
 void fp_mulm_low(dig_t *c, const dig_t *a, const dig_t *b);
 
+/**
+ * Multiplies eight pairs of digit vectors with embedded modular reduction.
+ * Computes c_i = (a_i * b_i) mod p.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the first digit vectors to multiply.
+ * @param[in] b				- the second digit vectors to multiply.
+ */
+void fp_mulm_x8_low(dig_t *c[], const dig_t *a[], const dig_t *b[]);
+
 /**
  * Squares a digit vector. Computes c = a * a.
  *
@@ -295,6 +325,15 @@ void fp_sqrn_low(dig_t *c, const dig_t *a);
  */
 void fp_sqrm_low(dig_t *c, const dig_t *a);
 
+/**
+ * Squares eight digit vectors with embedded modular reduction. Computes
+ * c_i = (a_i * a_i) mod p.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the digit vectors to square.
+ */
+void fp_sqrm_x8_low(dig_t *c[], const dig_t *a[]);
+
 /**
  * Reduces a digit vector modulo m represented in special form.
  * Computes c = a mod m.
@@ -313,6 +352,15 @@ void fp_rdcs_low(dig_t *c, const dig_t *a, const dig_t *m);
  */
 void fp_rdcn_low(dig_t *c, dig_t *a);
 
+/**
+ * Reduces eight double-precision digit vectors modulo the configured prime p
+ * with Montgomery reduction. Computes c_i = a_i * R^(-1) mod p.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the digit vectors to reduce.
+ */
+void fp_rdcn_x8_low(dig_t *c[], const dig_t *a[]);
+
 /**
  * Inverts a digit vector modulo the configured prime.
  *
@@ -329,6 +377,35 @@ void fp_invm_low(dig_t *c, const dig_t *a);
  */
 int fp_smbm_low(const dig_t *a);
 
+/**
+ * Applies a batch of constant-time division steps to the least significant
+ * digits of the two values in the Bernstein-Yang inversion.
+ *
+ * @param[out] m			- the transition matrix, scaled by 2^s.
+ * @param[in] delta			- the current value of delta.
+ * @param[in] f				- the least significant bits of f.
+ * @param[in] g				- the least significant bits of g.
+ * @param[in] s				- the number of division steps, at most RLC_DIG - 2.
+ * @return the updated value of delta.
+ */
+dis_t fp_invds_low(dis_t m[4], dis_t delta, dig_t f, dig_t g, int s);
+
+/**
+ * Applies a batch of constant-time division steps to the least significant
+ * digits of the two values in the Legendre symbol computation, keeping track
+ * of the quadratic reciprocity sign changes.
+ *
+ * @param[out] m			- the transition matrix, scaled by 2^s.
+ * @param[out] k			- the sign changes, modulo 4.
+ * @param[in] delta			- the current value of delta.
+ * @param[in] f				- the least significant bits of f.
+ * @param[in] g				- the least significant bits of g.
+ * @param[in] s				- the number of division steps, at most RLC_DIG - 2.
+ * @return the updated value of delta.
+ */
+dis_t fp_smbds_low(dis_t m[4], dig_t *k, dis_t delta, dig_t f, dig_t g,
+		int s);
+
 #endif /* ASM */
 
 #endif /* !RLC_FP_LOW_H */
@@ -29,6 +29,11 @@
  * @ingroup utils
  */
 
+#ifndef RLC_ALLOC_H
+#define RLC_ALLOC_H
+
+#include <stddef.h>
+
 #include "relic_conf.h"
 
 #if defined(_MSC_VER) || defined(__MINGW32__) || defined(__MINGW64__)
@@ -45,7 +50,7 @@
  * @param[in] S                 - the number of obecs to allocate.
  */
 #if ALLOC == DYNAMIC
-#define RLC_ALLOCA(T, S)		(T*) calloc((S), sizeof(T))
+#define RLC_ALLOCA(T, S)		(T*) alloc_calloc((S), sizeof(T))
 #else
 #define RLC_ALLOCA(T, S)		(T*) _alloca((S) * sizeof(T))
 #endif
@@ -68,13 +73,23 @@
  * @param[in] S                 - the number of obecs to allocate.
  */
 #if ALLOC == DYNAMIC
-#define RLC_ALLOCA(T, S)		(T*) malloc((S) * sizeof(T))
+#define RLC_ALLOCA(T, S)		(T*) alloc_malloc((S) * sizeof(T))
 #else
 #define RLC_ALLOCA(T, S)		(T*) alloca((S) * sizeof(T))
 #endif
 
 #endif
 
+/*
+ * Allocates an array of "Type" with the specified size on the heap, whatever
+ * the allocation mode, for arrays too large to be placed on the stack. The
+ * array is set to zero and must be released with alloc_free().
+ *
+ * @param[in] T                 - the type of each object.
+ * @param[in] S                 - the number of objects to allocate.
+ */
+#define RLC_MALLOC(T, S)		(T*) alloc_calloc((S), sizeof(T))
+
 /*
  * Free memory allocated with RLC_ALLOCA.
  *
@@ -83,9 +98,111 @@
 #if ALLOC == DYNAMIC
 #define RLC_FREE(A)															\
 	if (A != NULL) {														\
-		free((void *)A);													\
+		alloc_free((void *)A);												\
 		A = NULL;															\
 	}
 #else
 #define RLC_FREE(A)         	(void)A;
 #endif
+
+/*============================================================================*/
+/* Type definitions                                                           */
+/*============================================================================*/
+
+/**
+ * Represents the system allocator backing the memory pools.
+ */
+typedef struct {
+	/** Allocates a block of memory. */
+	void *(*get)(size_t size);
+	/** Resizes a block of memory. */
+	void *(*resize)(void *ptr, size_t size);
+	/** Releases a block of memory. */
+	void (*put)(void *ptr);
+} alloc_t;
+
+/*============================================================================*/
+/* Function prototypes                                                        */
+/*============================================================================*/
+
+/**
+ * Replaces the system allocator used to obtain memory. Must be called before
+ * the library is initialized in any thread, unless the new allocator can
+ * release the memory obtained from the previous one (e.g. a wrapper of it).
+ *
+ * @param[in] sys			- the new allocator, or NULL for the C library.
+ */
+void alloc_set(const alloc_t *sys);
+
+/**
+ * Initializes the memory pool of the current thread. Small blocks are carved
+ * from a bump arena and recycled through free lists of fixed size classes.
+ */
+void alloc_init(void);
+
+/**
+ * Finalizes the memory pool of the current thread, releasing the scopes left
+ * open. The arena is returned to the system once all the blocks obtained
+ * outside scopes are freed.
+ */
+void alloc_clean(void);
+
+/**
+ * Allocates a block of memory aligned to 16 bytes.
+ *
+ * @param[in] size			- the number of bytes.
+ * @return the allocated block, or NULL if no memory is available.
+ */
+void *alloc_malloc(size_t size);
+
+/**
+ * Allocates a block of memory for an array and sets it to zero.
+ *
+ * @param[in] n				- the number of elements.
+ * @param[in] size			- the size of each element in bytes.
+ * @return the allocated block, or NULL if no memory is available.
+ */
+void *alloc_calloc(size_t n, size_t size);
+
+/**
+ * Resizes a block of memory, preserving its contents.
+ *
+ * @param[in] ptr			- the block to resize, or NULL.
+ * @param[in] size			- the new number of bytes.
+ * @return the resized block, or NULL if no memory is available.
+ */
+void *alloc_realloc(void *ptr, size_t size);
+
+/**
+ * Releases a block of memory.
+ *
+ * @param[in] ptr			- the block to release, or NULL.
+ */
+void alloc_free(void *ptr);
+
+/**
+ * Opens an allocation scope in the current thread. All blocks obtained after
+ * this call are reclaimed at once by the matching alloc_release().
+ *
+ * @return the mark identifying the scope.
+ */
+int alloc_mark(void);
+
+/**
+ * Closes an allocation scope and the scopes nested inside it, invalidating
+ * every block allocated since the mark was taken.
+ *
+ * @param[in] mark			- the mark returned by alloc_mark().
+ */
+void alloc_release(int mark);
+
+/**
+ * Reads the allocation counters of the current thread.
+ *
+ * @param[out] calls		- the number of allocation requests.
+ * @param[out] bytes		- the number of bytes requested.
+ * @param[out] sys			- the number of requests to the system allocator.
+ */
+void alloc_stats(size_t *calls, size_t *bytes, size_t *sys);
+
+#endif /* !RLC_ALLOC_H */
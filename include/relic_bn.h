@@ -71,6 +71,18 @@
 #define RLC_BN_SIZE		((int)RLC_BN_DIGS)
 #endif
 
+/**
+ * Size of a precomputation table for fixed base exponentiation using the comb
+ * method.
+ */
+#define RLC_BN_TABLE	(1 << BN_DEPTH)
+
+/**
+ * Maximum number of exponentiations interleaved at once when exponentiating
+ * many integers to the same power, as many as the lanes of bn_mxp_x8().
+ */
+#define RLC_BN_LOT		8
+
 /**
  * Positive sign of a multiple precision integer.
  */
@@ -145,6 +157,27 @@ typedef crt_st crt_t[1];
 typedef crt_st *crt_t;
 #endif
 
+/**
+ * Represents a modulus with the constants precomputed for modular reduction,
+ * so that they can be reused across several operations.
+ */
+typedef struct {
+	/** The modulus m. */
+	bn_t m;
+	/** The Montgomery reciprocal -m^(-1) mod 2^RLC_DIG, if m is odd. */
+	bn_t u;
+	/** The square of the Montgomery radix modulo m, if m is odd. */
+	bn_t r2;
+	/** The Barrett reciprocal floor(2^(2 * RLC_DIG * n) / m), or zero. */
+	bn_t v;
+} mod_st;
+
+#if ALLOC == AUTO
+typedef mod_st mod_t[1];
+#else
+typedef mod_st *mod_t;
+#endif
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -168,7 +201,7 @@ typedef crt_st *crt_t;
  */
 #if ALLOC == DYNAMIC
 #define bn_new(A)															\
-	A = (bn_t)calloc(1, sizeof(bn_st));										\
+	A = (bn_t)alloc_calloc(1, sizeof(bn_st));								\
 	if ((A) == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -192,7 +225,7 @@ typedef crt_st *crt_t;
  */
 #if ALLOC == DYNAMIC
 #define bn_new_size(A, D)													\
-	A = (bn_t)calloc(1, sizeof(bn_st));										\
+	A = (bn_t)alloc_calloc(1, sizeof(bn_st));								\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -213,7 +246,7 @@ typedef crt_st *crt_t;
 #define bn_free(A)															\
 	if (A != NULL) {														\
 		bn_clean(A);														\
-		free((void *)A);													\
+		alloc_free((void *)A);												\
 		A = NULL;															\
 	}
 
@@ -236,7 +269,7 @@ typedef crt_st *crt_t;
  */
 #if ALLOC == DYNAMIC
 #define crt_new(A)															\
-	A = (crt_t)calloc(1, sizeof(crt_st));									\
+	A = (crt_t)alloc_calloc(1, sizeof(crt_st));								\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -272,7 +305,7 @@ typedef crt_st *crt_t;
 		bn_free((A)->p);													\
 		bn_free((A)->q);													\
 		bn_free((A)->qi);													\
-		free(A);															\
+		alloc_free(A);														\
 		A = NULL;															\
 	}
 
@@ -281,6 +314,59 @@ typedef crt_st *crt_t;
 
 #endif
 
+/**
+ * Initializes a modulus context with a null value.
+ *
+ * @param[out] A			- the context to initialize.
+ */
+#define mod_null(A)			RLC_NULL(A)
+
+/**
+ * Calls a function to allocate and initialize a modulus context.
+ *
+ * @param[out] A			- the new context.
+ */
+#if ALLOC == DYNAMIC
+#define mod_new(A)															\
+	A = (mod_t)alloc_calloc(1, sizeof(mod_st));								\
+	if (A == NULL) {														\
+		RLC_THROW(ERR_NO_MEMORY);											\
+	}																		\
+	bn_new((A)->m);															\
+	bn_new((A)->u);															\
+	bn_new((A)->r2);														\
+	bn_new((A)->v);															\
+
+#elif ALLOC == AUTO
+#define mod_new(A)															\
+	bn_new((A)->m);															\
+	bn_new((A)->u);															\
+	bn_new((A)->r2);														\
+	bn_new((A)->v);															\
+
+#endif
+
+/**
+ * Calls a function to clean and free a modulus context.
+ *
+ * @param[out] A			- the context to clean and free.
+ */
+#if ALLOC == DYNAMIC
+#define mod_free(A)															\
+	if (A != NULL) {														\
+		bn_free((A)->m);													\
+		bn_free((A)->u);													\
+		bn_free((A)->r2);													\
+		bn_free((A)->v);													\
+		alloc_free(A);														\
+		A = NULL;															\
+	}
+
+#elif ALLOC == AUTO
+#define mod_free(A)				/* empty */
+
+#endif
+
 /**
  * Multiples two multiple precision integers. Computes c = a * b.
  *
@@ -1069,6 +1155,77 @@ void bn_mod_pre_pmers(bn_t u, const bn_t m);
  */
 void bn_mod_pmers(bn_t c, const bn_t a, const bn_t m, const bn_t u);
 
+/**
+ * Precomputes the constants for reducing modulo a positive integer and stores
+ * them in a context. The Montgomery constants are only computed for odd
+ * moduli, and the Barrett reciprocal only for even moduli or if BN_MOD is
+ * BARRT.
+ *
+ * @param[out] ctx			- the modulus context.
+ * @param[in] m				- the modulus.
+ * @throw ERR_NO_VALID		- if the modulus is not positive.
+ */
+void bn_mod_ctx(mod_t ctx, const bn_t m);
+
+/**
+ * Reduces a multiple precision integer modulo the modulus of a context using
+ * Barrett reduction if the context holds the reciprocal, or division
+ * otherwise. Computes c = a mod m.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the multiple precision integer to reduce.
+ * @param[in] ctx			- the modulus context.
+ */
+void bn_mod_ctx_rdc(bn_t c, const bn_t a, const mod_t ctx);
+
+/**
+ * Converts a multiple precision integer to Montgomery form with a single
+ * Montgomery multiplication by the precomputed radix square.
+ * Computes c = a * R mod m.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the multiple precision integer to convert.
+ * @param[in] ctx			- the modulus context.
+ * @throw ERR_NO_VALID		- if the modulus is even.
+ */
+void bn_mod_ctx_conv(bn_t c, const bn_t a, const mod_t ctx);
+
+/**
+ * Converts a multiple precision integer from Montgomery form.
+ * Computes c = a * R^(-1) mod m.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the multiple precision integer to convert.
+ * @param[in] ctx			- the modulus context.
+ * @throw ERR_NO_VALID		- if the modulus is even.
+ */
+void bn_mod_ctx_back(bn_t c, const bn_t a, const mod_t ctx);
+
+/**
+ * Multiplies two multiple precision integers reduced modulo the modulus of a
+ * context using Montgomery multiplication. If both operands are in Montgomery
+ * form, so is the result; if only one is, the result is in canonical form.
+ * Computes c = a * b * R^(-1) mod m.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first multiple precision integer to multiply.
+ * @param[in] b				- the second multiple precision integer to multiply.
+ * @param[in] ctx			- the modulus context.
+ * @throw ERR_NO_VALID		- if the modulus is even.
+ */
+void bn_mod_ctx_mul(bn_t c, const bn_t a, const bn_t b, const mod_t ctx);
+
+/**
+ * Squares a multiple precision integer reduced modulo the modulus of a
+ * context using Montgomery multiplication. Computes c = a^2 * R^(-1) mod m.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the multiple precision integer to square.
+ * @param[in] ctx			- the modulus context.
+ * @throw ERR_NO_VALID		- if the modulus is even.
+ */
+void bn_mod_ctx_sqr(bn_t c, const bn_t a, const mod_t ctx);
+
 /**
  * Exponentiates a multiple precision integer modulo a positive integer using
  * the binary method.
@@ -1113,6 +1270,86 @@ void bn_mxp_monty(bn_t c, const bn_t a, const bn_t b, const bn_t m);
  */
 void bn_mxp_dig(bn_t c, const bn_t a, dig_t b, const bn_t m);
 
+/**
+ * Builds a precomputation table for exponentiating a fixed base modulo a
+ * positive integer using the single-table comb method. The table covers
+ * exponents with as many bits as the modulus.
+ *
+ * @param[out] t			- the precomputation table with RLC_BN_TABLE entries.
+ * @param[in] g				- the fixed base.
+ * @param[in] m				- the modulus.
+ */
+void bn_mxp_pre(bn_t *t, const bn_t g, const bn_t m);
+
+/**
+ * Exponentiates a fixed base modulo a positive integer using a precomputation
+ * table built by bn_mxp_pre(). Exponents longer than the modulus fall back to
+ * bn_mxp(). Computes c = g^e mod m.
+ *
+ * @param[out] c			- the result.
+ * @param[in] t				- the precomputation table.
+ * @param[in] e				- the exponent.
+ * @param[in] m				- the modulus.
+ */
+void bn_mxp_fix(bn_t c, const bn_t *t, const bn_t e, const bn_t m);
+
+/**
+ * Exponentiates a multiple precision integer in Montgomery form modulo the
+ * modulus of a context, using the sliding window method. The basis and the
+ * result stay in Montgomery form, so that chained operations over the same
+ * modulus avoid conversions. Computes c = a^b mod m.
+ *
+ * @param[out] c			- the result, in Montgomery form.
+ * @param[in] a				- the basis, in Montgomery form.
+ * @param[in] b				- the exponent.
+ * @param[in] ctx			- the modulus context.
+ * @throw ERR_NO_VALID		- if the modulus is even.
+ */
+void bn_mxp_ctx(bn_t c, const bn_t a, const bn_t b, const mod_t ctx);
+
+/**
+ * Exponentiates a multiple precision integer in Montgomery form to a small
+ * power modulo the modulus of a context. Computes c = a^b mod m.
+ *
+ * @param[out] c			- the result, in Montgomery form.
+ * @param[in] a				- the basis, in Montgomery form.
+ * @param[in] b				- the exponent.
+ * @param[in] ctx			- the modulus context.
+ * @throw ERR_NO_VALID		- if the modulus is even.
+ */
+void bn_mxp_ctx_dig(bn_t c, const bn_t a, dig_t b, const mod_t ctx);
+
+/**
+ * Exponentiates many multiple precision integers in Montgomery form to the
+ * same power modulo the modulus of a context. The exponent is recoded once
+ * and the exponentiations are interleaved window by window, RLC_BN_LOT at a
+ * time. Computes c_i = a_i^b mod m.
+ *
+ * @param[out] c			- the results, in Montgomery form.
+ * @param[in] a				- the bases, in Montgomery form.
+ * @param[in] b				- the exponent.
+ * @param[in] ctx			- the modulus context.
+ * @param[in] n				- the number of bases.
+ * @throw ERR_NO_VALID		- if the modulus is even.
+ */
+void bn_mxp_ctx_many(bn_t *c, const bn_t *a, const bn_t b, const mod_t ctx,
+		int n);
+
+/**
+ * Exponentiates eight multiple precision integers to the same power modulo an
+ * odd modulus. The eight exponentiations run in lockstep, so that every
+ * modular multiplication is computed for all the bases at once. Computes
+ * c_i = a_i^b mod m for 0 <= i < 8.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the bases.
+ * @param[in] b				- the exponent.
+ * @param[in] m				- the modulus.
+ * @throw ERR_NO_VALID		- if the modulus is even or negative.
+ * @throw ERR_NO_PRECI		- if the modulus is larger than the precision.
+ */
+void bn_mxp_x8(bn_t *c, const bn_t *a, const bn_t b, const bn_t m);
+
 /*
  * Computes a modular exponentiation of a multiple precision integer using the
  * Chinese Remainder Theorem, given the moduli.
@@ -1313,6 +1550,15 @@ int bn_is_prime_rabin(const bn_t a);
  */
 int bn_is_prime_solov(const bn_t a);
 
+/**
+ * Computes the smallest probable prime larger than a given integer. Candidates
+ * are sieved in windows by the small primes before any primality test.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the integer to start from.
+ */
+void bn_next_prime(bn_t c, const bn_t a);
+
 /**
  * Generates a probable prime number.
  *
@@ -1510,6 +1756,30 @@ void bn_rec_glv(bn_t k0, bn_t k1, const bn_t k, const bn_t n, const bn_t v1[],
 void bn_rec_frb(bn_t *ki, int sub, const bn_t k, const bn_t x, const bn_t n,
 	int bls);
 
+/**
+ * Chooses the window size of the bucket method for a multi-scalar
+ * multiplication and estimates its cost.
+ *
+ * @param[out] w			- the chosen window size.
+ * @param[in] n				- the number of scalars.
+ * @param[in] l				- the maximum length of the scalars in bits.
+ * @param[in] max			- the maximum window size.
+ * @return the estimated number of group operations.
+ */
+size_t bn_rec_bkt(int *w, int n, int l, int max);
+
+/**
+ * Extracts a window of bits from a scalar written as a vector of digits, as
+ * used by the bucket method. Bits past the end of the vector are zero.
+ *
+ * @param[in] a				- the digit vector.
+ * @param[in] d				- the number of digits in the vector.
+ * @param[in] from			- the position of the first bit in the window.
+ * @param[in] w				- the window size.
+ * @return the window value.
+ */
+int bn_rec_get(const dig_t *a, int d, int from, int w);
+
 /**
  * Computes the coefficients of the polynomial representing the Lagrange
  * interpolation for a modulus and a given set of roots.
@@ -1535,4 +1805,45 @@ void bn_lag(bn_t *c, const bn_t *a, const bn_t b, int n);
  */
 void bn_evl(bn_t c, const bn_t *a, const bn_t x, const bn_t b, int n);
 
+/**
+ * Computes the coefficients of the polynomial representing the Lagrange
+ * interpolation for a modulus and a given set of roots, using a subproduct
+ * tree and Karatsuba multiplication. Computes the same result as bn_lag() in
+ * quasi-linear time.
+ *
+ * @param[out] c 			- the coefficients of the polynomial.
+ * @param[in] a				- the set of roots.
+ * @param[in] b				- the modulus.
+ * @param[in] n				- the number of roots to interpolate.
+ */
+void bn_lag_fast(bn_t *c, const bn_t *a, const bn_t b, int n);
+
+/**
+ * Evaluates a polynomial over several values in a modular way, reducing the
+ * polynomial down the subproduct tree of the values. Computes
+ * c[i] = a(x[i]) mod q.
+ *
+ * @param[out] c 			- the results of the evaluations.
+ * @param[in] a 			- the coefficients of the polynomial.
+ * @param[in] x				- the values to evaluate.
+ * @param[in] b				- the modulus.
+ * @param[in] n				- the number of coefficients of the polynomial.
+ * @param[in] m				- the number of values to evaluate.
+ */
+void bn_evl_sim(bn_t *c, const bn_t *a, const bn_t *x, const bn_t b, int n,
+		int m);
+
+/**
+ * Computes the coefficients of the polynomial of degree smaller than n that
+ * takes given values over n distinct points, modulo a prime.
+ * Computes c(x) such that c(x[i]) = y[i] mod q.
+ *
+ * @param[out] c 			- the n coefficients of the polynomial.
+ * @param[in] x				- the points.
+ * @param[in] y				- the values at the points.
+ * @param[in] b				- the modulus.
+ * @param[in] n				- the number of points.
+ */
+void bn_itp(bn_t *c, const bn_t *x, const bn_t *y, const bn_t b, int n);
+
 #endif /* !RLC_BN_H */
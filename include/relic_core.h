@@ -467,12 +467,21 @@ int core_init(void);
 int core_clean(void);
 
 /**
- * Returns a pointer to the current library context.
+ * Returns a pointer to the current library context. If a parameter set is
+ * active, the pointer refers to the parameter set instead.
  *
  * @return a pointer to the library context.
  */
 ctx_t *core_get(void);
 
+/**
+ * Returns a pointer to the library context of the calling thread, which holds
+ * the error, PRNG and benchmarking state even when a parameter set is active.
+ *
+ * @return a pointer to the library context.
+ */
+ctx_t *core_state(void);
+
 /**
  * Switched the library context to a new context.
  *
@@ -480,6 +489,55 @@ ctx_t *core_get(void);
  */
 void core_set(ctx_t *ctx);
 
+/**
+ * Allocates and initializes a parameter set. A parameter set is a context
+ * that only holds field, curve and pairing parameters and can be shared
+ * among threads once configured.
+ *
+ * @return a pointer to the new parameter set, or NULL if no memory is left.
+ */
+ctx_t *core_par_new(void);
+
+/**
+ * Finalizes and frees a parameter set.
+ *
+ * @param[in,out] par				- the parameter set.
+ */
+void core_par_free(ctx_t *par);
+
+/**
+ * Returns the parameter set active in the calling thread.
+ *
+ * @return a pointer to the parameter set, or NULL if the parameters of the
+ * thread's own context are in use.
+ */
+ctx_t *core_par_get(void);
+
+/**
+ * Switches the parameters used by the calling thread to a parameter set
+ * without any recomputation. Configuration functions such as ep_param_set()
+ * modify the active parameter set, so a set must not be configured after it
+ * is shared with other threads.
+ *
+ * @param[in] par					- the parameter set, or NULL to go back to
+ * 									  the parameters of the thread's context.
+ */
+void core_par_set(ctx_t *par);
+
+/**
+ * Runs a function once for each index from 0 to n - 1, in parallel if
+ * multithreading is enabled. The index 0 runs in the calling thread and the
+ * others in a pool of worker threads, which are initialized once and use the
+ * parameters of the caller. The indices run in the calling thread when the
+ * pool is busy or cannot be started.
+ *
+ * @param[in] fun					- the function, taking an argument and an index.
+ * @param[in] arg					- the argument passed to the function.
+ * @param[in] n						- the number of indices, at most CORES.
+ * @return RLC_OK if no worker raised an error, RLC_ERR otherwise.
+ */
+int core_run(void (*fun)(void *arg, int id), void *arg, int n);
+
 #if defined(MULTI)
 
 #include "relic_multi.h"
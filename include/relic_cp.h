@@ -44,6 +44,20 @@
 #include "relic_pc.h"
 #include "relic_mpc.h"
 
+/*============================================================================*/
+/* Constant definitions                                                       */
+/*============================================================================*/
+
+/**
+ * Length in bytes of EdDSA keys and encoded points.
+ */
+#define RLC_EDDSA_LEN		32
+
+/**
+ * Length in bytes of an EdDSA signature.
+ */
+#define RLC_EDDSA_SIG		(2 * RLC_EDDSA_LEN)
+
 /*============================================================================*/
 /* Type definitions.                                                          */
 /*============================================================================*/
@@ -280,7 +294,7 @@ typedef etrs_st *etrs_t;
  */
 #if ALLOC == DYNAMIC
 #define shpe_new(A)															\
-	A = (shpe_t)calloc(1, sizeof(shpe_st));									\
+	A = (shpe_t)alloc_calloc(1, sizeof(shpe_st));							\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -313,7 +327,7 @@ typedef etrs_st *etrs_t;
 		bn_free((A)->g);													\
 		bn_free((A)->gn);													\
 		crt_free((A)->crt);													\
-		free(A);															\
+		alloc_free(A);														\
 		A = NULL;															\
 	}
 
@@ -336,7 +350,7 @@ typedef etrs_st *etrs_t;
  */
 #if ALLOC == DYNAMIC
 #define rsa_new(A)															\
-	A = (rsa_t)calloc(1, sizeof(_rsa_st));									\
+	A = (rsa_t)alloc_calloc(1, sizeof(_rsa_st));							\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -365,7 +379,7 @@ typedef etrs_st *etrs_t;
 		bn_free((A)->d);													\
 		bn_free((A)->e);													\
 		crt_free((A)->crt);													\
-		free(A);															\
+		alloc_free(A);														\
 		A = NULL;															\
 	}
 
@@ -430,7 +444,7 @@ typedef etrs_st *etrs_t;
  */
 #if ALLOC == DYNAMIC
 #define bdpe_new(A)															\
-	A = (bdpe_t)calloc(1, sizeof(bdpe_st));									\
+	A = (bdpe_t)alloc_calloc(1, sizeof(bdpe_st));							\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -463,7 +477,7 @@ typedef etrs_st *etrs_t;
 		bn_free((A)->p);													\
 		bn_free((A)->q);													\
 		(A)->t = 0;															\
-		free(A);															\
+		alloc_free(A);														\
 		A = NULL;															\
 	}
 
@@ -485,7 +499,7 @@ typedef etrs_st *etrs_t;
  */
 #if ALLOC == DYNAMIC
 #define sokaka_new(A)														\
-	A = (sokaka_t)calloc(1, sizeof(sokaka_st));								\
+	A = (sokaka_t)alloc_calloc(1, sizeof(sokaka_st));						\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -506,7 +520,7 @@ typedef etrs_st *etrs_t;
 	if (A != NULL) {														\
 		g1_free((A)->s1);													\
 		g2_free((A)->s2);													\
-		free(A);															\
+		alloc_free(A);														\
 		A = NULL;															\
 	}
 
@@ -528,7 +542,7 @@ typedef etrs_st *etrs_t;
  */
 #if ALLOC == DYNAMIC
 #define bgn_new(A)															\
-	A = (bgn_t)calloc(1, sizeof(bgn_st));									\
+	A = (bgn_t)alloc_calloc(1, sizeof(bgn_st));								\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -563,7 +577,7 @@ typedef etrs_st *etrs_t;
 		g2_free((A)->hx);													\
 		g2_free((A)->hy);													\
 		g2_free((A)->hz);													\
-		free(A);															\
+		alloc_free(A);														\
 		A = NULL;															\
 	}
 
@@ -585,7 +599,7 @@ typedef etrs_st *etrs_t;
  */
 #if ALLOC == DYNAMIC
 #define ers_new(A)															\
-	A = (ers_t)calloc(1, sizeof(ers_st));									\
+	A = (ers_t)alloc_calloc(1, sizeof(ers_st));								\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -614,7 +628,7 @@ typedef etrs_st *etrs_t;
 		bn_free((A)->c[1]);													\
 		bn_free((A)->r[0]);													\
 		bn_free((A)->r[1]);													\
-		free(A);															\
+		alloc_free(A);														\
 		A = NULL;															\
 	}
 
@@ -636,7 +650,7 @@ typedef etrs_st *etrs_t;
  */
 #if ALLOC == DYNAMIC
 #define smlers_new(A)														\
-	A = (smlers_t)calloc(1, sizeof(ers_st));								\
+	A = (smlers_t)alloc_calloc(1, sizeof(ers_st));							\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -665,7 +679,7 @@ typedef etrs_st *etrs_t;
 		bn_free((A)->c[1]);													\
 		bn_free((A)->r[0]);													\
 		bn_free((A)->r[1]);													\
-		free(A);															\
+		alloc_free(A);														\
 		A = NULL;															\
 	}
 
@@ -687,7 +701,7 @@ typedef etrs_st *etrs_t;
  */
 #if ALLOC == DYNAMIC
 #define etrs_new(A)															\
-	A = (etrs_t)calloc(1, sizeof(etrs_st));									\
+	A = (etrs_t)alloc_calloc(1, sizeof(etrs_st));							\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -719,7 +733,7 @@ typedef etrs_st *etrs_t;
 		bn_free((A)->c[1]);													\
 		bn_free((A)->r[0]);													\
 		bn_free((A)->r[1]);													\
-		free(A);															\
+		alloc_free(A);														\
 		A = NULL;															\
 	}
 
@@ -767,6 +781,23 @@ int cp_rsa_enc(uint8_t *out, int *out_len, uint8_t *in, int in_len, rsa_t pub);
  */
 int cp_rsa_dec(uint8_t *out, int *out_len, uint8_t *in, int in_len, rsa_t prv);
 
+/**
+ * Decrypts many ciphertexts under the same private key using the RSA
+ * cryptosystem. The Montgomery contexts are shared among all the ciphertexts
+ * and the exponentiations are interleaved. Uses the CRT optimization if CP_CRT
+ * is on.
+ *
+ * @param[out] out			- the output buffers.
+ * @param[in, out] out_len	- the buffer capacities and numbers of bytes written.
+ * @param[in] in			- the input buffers.
+ * @param[in] in_len		- the numbers of bytes to decrypt.
+ * @param[in] n				- the number of ciphertexts.
+ * @param[in] prv			- the private key.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_rsa_dec_many(uint8_t *out[], int out_len[], uint8_t *in[],
+		const int in_len[], int n, rsa_t prv);
+
 /**
  * Signs using the basic RSA signature algorithm. The flag must be non-zero if
  * the message being signed is already a hash value. Uses the CRT optimization
@@ -783,6 +814,23 @@ int cp_rsa_dec(uint8_t *out, int *out_len, uint8_t *in, int in_len, rsa_t prv);
 int cp_rsa_sig(uint8_t *sig, int *sig_len, uint8_t *msg, int msg_len,
 		int hash, rsa_t prv);
 
+/**
+ * Signs many messages under the same private key using the basic RSA signature
+ * algorithm. The Montgomery contexts are shared among all the messages and the
+ * exponentiations are interleaved. Uses the CRT optimization if CP_CRT is on.
+ *
+ * @param[out] sig			- the signatures.
+ * @param[in, out] sig_len	- the buffer capacities and numbers of bytes written.
+ * @param[in] msg			- the messages to sign.
+ * @param[in] msg_len		- the numbers of bytes to sign.
+ * @param[in] n				- the number of messages.
+ * @param[in] hash			- the flag to indicate the message format.
+ * @param[in] prv			- the private key.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_rsa_sig_many(uint8_t *sig[], int sig_len[], uint8_t *msg[],
+		const int msg_len[], int n, int hash, rsa_t prv);
+
 /**
  * Verifies an RSA signature. The flag must be non-zero if the message being
  * signed is already a hash value.
@@ -887,6 +935,27 @@ int cp_phpe_gen(bn_t pub, phpe_t prv, int bits);
  */
 int cp_phpe_enc(bn_t c, bn_t m, bn_t pub);
 
+/**
+ * Precomputes the modulus context of n^2 used by Paillier encryption, so that
+ * it can be shared among many encryptions under the same public key.
+ *
+ * @param[out] ctx			- the modulus context.
+ * @param[in] pub			- the public key.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_phpe_ctx(mod_t ctx, bn_t pub);
+
+/**
+ * Encrypts using the Paillier cryptosystem and a precomputed modulus context.
+ *
+ * @param[out] c			- the ciphertext, represented as an integer.
+ * @param[in] m				- the plaintext as an integer.
+ * @param[in] pub			- the public key.
+ * @param[in] ctx			- the modulus context built by cp_phpe_ctx().
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_phpe_enc_ctx(bn_t c, bn_t m, bn_t pub, mod_t ctx);
+
 /**
  * Evaluated a homomorphic addition using the Paillier cryptosystem.
  *
@@ -971,6 +1040,30 @@ int cp_ghpe_gen(bn_t pub, bn_t prv, int bits);
  */
 int cp_ghpe_enc(bn_t c, bn_t m, bn_t pub, int s);
 
+/**
+ * Precomputes the modulus context of n^(s + 1) used by Generalized Paillier
+ * encryption, so that it can be shared among many encryptions.
+ *
+ * @param[out] ctx			- the modulus context.
+ * @param[in] pub			- the public key.
+ * @param[in] s				- the block length parameter.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_ghpe_ctx(mod_t ctx, bn_t pub, int s);
+
+/**
+ * Encrypts using the Generalized Paillier cryptosystem and a precomputed
+ * modulus context.
+ *
+ * @param[out] c			- the ciphertext.
+ * @param[in] m				- the plaintext.
+ * @param[in] pub			- the public key.
+ * @param[in] s				- the block length parameter.
+ * @param[in] ctx			- the modulus context built by cp_ghpe_ctx().
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_ghpe_enc_ctx(bn_t c, bn_t m, bn_t pub, int s, mod_t ctx);
+
 /**
  * Decrypts using the Generalized Paillier cryptosystem.
  *
@@ -1101,6 +1194,27 @@ int cp_ecdsa_sig(bn_t r, bn_t s, uint8_t *msg, int len, int hash, bn_t d);
  */
 int cp_ecdsa_ver(bn_t r, bn_t s, uint8_t *msg, int len, int hash, ec_t q);
 
+/**
+ * Verifies many messages signed with ECDSA in a batch. All the inversions are
+ * computed simultaneously. If the points R_i recovered from the signatures
+ * are given, a randomized linear combination of the verification equations is
+ * checked with a single multi-scalar multiplication. When the batch check
+ * fails, the signatures are verified one by one to find the invalid ones.
+ *
+ * @param[out] ver			- the verification result of each signature.
+ * @param[in] r				- the first components of the signatures.
+ * @param[in] s				- the second components of the signatures.
+ * @param[in] msg			- the signed messages.
+ * @param[in] len			- the message lengths in bytes.
+ * @param[in] hash			- the flag to indicate the message format.
+ * @param[in] q				- the public keys.
+ * @param[in] p				- the points R_i with x-coordinates r_i, or NULL.
+ * @param[in] m				- the number of signatures.
+ * @return a boolean value indicating if all signatures are valid.
+ */
+int cp_ecdsa_ver_batch(int *ver, bn_t r[], bn_t s[], uint8_t *msg[],
+		int len[], int hash, ec_t q[], ec_t p[], int m);
+
 /**
  * Generates an Elliptic Curve Schnorr Signature key pair.
  *
@@ -1135,6 +1249,58 @@ int cp_ecss_sig(bn_t e, bn_t s, uint8_t *msg, int len, bn_t d);
  */
 int cp_ecss_ver(bn_t e, bn_t s, uint8_t *msg, int len, ec_t q);
 
+/**
+ * Generates an Ed25519 key pair as specified in RFC 8032.
+ *
+ * @param[out] pub			- the encoded public key (RLC_EDDSA_LEN bytes).
+ * @param[out] prv			- the private key (RLC_EDDSA_LEN bytes).
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_eddsa_gen(uint8_t *pub, uint8_t *prv);
+
+/**
+ * Signs a message using Ed25519.
+ *
+ * @param[out] sig			- the signature (RLC_EDDSA_SIG bytes).
+ * @param[in] msg			- the message to sign.
+ * @param[in] len			- the message length in bytes.
+ * @param[in] prv			- the private key.
+ * @param[in] pub			- the encoded public key matching the private key.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise or if the keys do
+ * not match.
+ */
+int cp_eddsa_sig(uint8_t *sig, uint8_t *msg, int len, uint8_t *prv,
+		uint8_t *pub);
+
+/**
+ * Verifies a message signed with Ed25519 using the cofactored equation
+ * 8SG = 8R + 8kA.
+ *
+ * @param[in] sig			- the signature.
+ * @param[in] msg			- the signed message.
+ * @param[in] len			- the message length in bytes.
+ * @param[in] pub			- the encoded public key.
+ * @return a boolean value indicating if the signature is valid.
+ */
+int cp_eddsa_ver(uint8_t *sig, uint8_t *msg, int len, uint8_t *pub);
+
+/**
+ * Verifies many messages signed with Ed25519 in a batch. A random linear
+ * combination of the verification equations is checked with a single
+ * multi-scalar multiplication. When the batch check fails, the signatures are
+ * verified one by one to find the invalid ones.
+ *
+ * @param[out] ver			- the verification result of each signature.
+ * @param[in] sig			- the signatures.
+ * @param[in] msg			- the signed messages.
+ * @param[in] len			- the message lengths in bytes.
+ * @param[in] pub			- the encoded public keys.
+ * @param[in] m				- the number of signatures.
+ * @return a boolean value indicating if all signatures are valid.
+ */
+int cp_eddsa_ver_batch(int *ver, uint8_t *sig[], uint8_t *msg[], int len[],
+		uint8_t *pub[], int m);
+
 /**
  * Generate parameters for the DCKKS pairing delegation protocol described at
  * "Secure and Efficient Delegationof Pairings with Online Inputs" (CARDIS 2020)
@@ -1545,6 +1711,61 @@ int cp_bls_sig(g1_t s, uint8_t *msg, int len, bn_t d);
  */
 int cp_bls_ver(g1_t s, uint8_t *msg, int len, g2_t q);
 
+/**
+ * Aggregates BLS signatures into a single signature.
+ *
+ * @param[out] s			- the aggregate signature.
+ * @param[in] sig			- the signatures to aggregate.
+ * @param[in] n				- the number of signatures.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_bls_agg_sig(g1_t s, g1_t sig[], int n);
+
+/**
+ * Verifies an aggregate BLS signature on distinct messages using n + 1 Miller
+ * loops and a single final exponentiation. Repeated messages, an empty set of
+ * signers and the identity as signature are rejected.
+ *
+ * @param[in] s				- the aggregate signature.
+ * @param[in] msg			- the signed messages.
+ * @param[in] len			- the message lengths in bytes.
+ * @param[in] q				- the public keys.
+ * @param[in] n				- the number of signers.
+ * @return a boolean value indicating if the signature is valid.
+ */
+int cp_bls_agg_ver(g1_t s, uint8_t *msg[], int len[], g2_t q[], int n);
+
+/**
+ * Verifies an aggregate BLS signature on a single message by aggregating the
+ * public keys. The keys must come with proofs of possession to prevent
+ * rogue-key attacks. Empty signer sets, signatures or keys at infinity and
+ * aggregate keys at infinity are rejected.
+ *
+ * @param[in] s				- the aggregate signature.
+ * @param[in] msg			- the signed message.
+ * @param[in] len			- the message length in bytes.
+ * @param[in] q				- the public keys.
+ * @param[in] n				- the number of signers.
+ * @return a boolean value indicating if the signature is valid.
+ */
+int cp_bls_fast_ver(g1_t s, uint8_t *msg, int len, g2_t q[], int n);
+
+/**
+ * Verifies many independent BLS signatures in a batch by checking a randomized
+ * linear combination of the verification equations. When the batch check
+ * fails, the signatures are verified one by one to find the invalid ones.
+ *
+ * @param[out] ver			- the verification result of each signature.
+ * @param[in] s				- the signatures.
+ * @param[in] msg			- the signed messages.
+ * @param[in] len			- the message lengths in bytes.
+ * @param[in] q				- the public keys.
+ * @param[in] n				- the number of signatures.
+ * @return a boolean value indicating if all signatures are valid.
+ */
+int cp_bls_ver_batch(int *ver, g1_t s[], uint8_t *msg[], int len[],
+		g2_t q[], int n);
+
 /**
  * Generates a key pair for the Boneh-Boyen (BB) signature protocol.
  *
@@ -174,7 +174,7 @@ typedef eb_st *eb_t;
  */
 #if ALLOC == DYNAMIC
 #define eb_new(A)															\
-	A = (eb_t)calloc(1, sizeof(eb_st));										\
+	A = (eb_t)alloc_calloc(1, sizeof(eb_st));								\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -192,7 +192,7 @@ typedef eb_st *eb_t;
 #if ALLOC == DYNAMIC
 #define eb_free(A)															\
 	if (A != NULL) {														\
-		free(A);															\
+		alloc_free(A);														\
 		A = NULL;															\
 	}																		\
 
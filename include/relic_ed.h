@@ -156,7 +156,7 @@ typedef ed_st *ed_t;
  */
 #if ALLOC == DYNAMIC
 #define ed_new(A)															\
-	A = (ed_t)calloc(1, sizeof(ed_st));										\
+	A = (ed_t)alloc_calloc(1, sizeof(ed_st));								\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}
@@ -174,7 +174,7 @@ typedef ed_st *ed_t;
 #if ALLOC == DYNAMIC
 #define ed_free(A)															\
 	if (A != NULL) {														\
-		free(A);															\
+		alloc_free(A);														\
 		A = NULL;															\
 	}
 
@@ -777,16 +777,40 @@ void ed_mul_sim_joint(ed_t r, const ed_t p, const bn_t k, const ed_t q,
 	const bn_t m);
 
 /**
- * Multiplies and adds multiple Edwards elliptic curve points simultaneously.
+ * Multiplies and adds multiple Edwards elliptic curve points simultaneously,
+ * choosing between interleaving and the bucket method by estimated cost.
  * Computes R = \Sum_i=0..n [k_i]P_i.
  *
  * @param[out] r			- the result.
- * @param[out] p			- the elements to multiply.
- * @param[out] k			- the integer scalars.
- * @param[out] n			- the number of elements to multiply.
+ * @param[in] p				- the elements to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of elements to multiply.
  */
 void ed_mul_sim_lot(ed_t r, const ed_t p[], const bn_t k[], int n);
 
+/**
+ * Multiplies and adds multiple Edwards elliptic curve points simultaneously
+ * using interleaving of w-NAFs. Computes R = \Sum_i=0..n [k_i]P_i.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the elements to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of elements to multiply.
+ */
+void ed_mul_sim_lot_inter(ed_t r, const ed_t p[], const bn_t k[], int n);
+
+/**
+ * Multiplies and adds multiple Edwards elliptic curve points simultaneously
+ * using Pippenger's bucket method with signed windows. Computes
+ * R = \Sum_i=0..n [k_i]P_i.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the elements to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of elements to multiply.
+ */
+void ed_mul_sim_lot_bucket(ed_t r, const ed_t p[], const bn_t k[], int n);
+
 /**
  * Multiplies and adds the generator and an Edwards elliptic curve point
  * simultaneously. Computes R = [k]G + [m]Q.
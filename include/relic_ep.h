@@ -312,7 +312,7 @@ typedef iso_st *iso_t;
  */
 #if ALLOC == DYNAMIC
 #define ep_new(A)															\
-	A = (ep_t)calloc(1, sizeof(ep_st));										\
+	A = (ep_t)alloc_calloc(1, sizeof(ep_st));								\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -330,7 +330,7 @@ typedef iso_st *iso_t;
 #if ALLOC == DYNAMIC
 #define ep_free(A)															\
 	if (A != NULL) {														\
-		free(A);															\
+		alloc_free(A);														\
 		A = NULL;															\
 	}
 
@@ -823,6 +823,38 @@ void ep_read_bin(ep_t a, const uint8_t *bin, int len);
  */
 void ep_write_bin(uint8_t *bin, int len, const ep_t a, int pack);
 
+/**
+ * Returns the number of bytes necessary to store a precomputation table for
+ * multiplying a fixed prime elliptic curve point.
+ *
+ * @return the number of bytes.
+ */
+int ep_size_pre(void);
+
+/**
+ * Reads a precomputation table for multiplying a fixed prime elliptic curve
+ * point from a byte vector. The table must have been written with the same
+ * curve and precomputation method, and every point is validated.
+ *
+ * @param[out] t			- the precomputation table.
+ * @param[in] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is invalid.
+ * @throw ERR_NO_VALID		- if the encoded table is invalid.
+ */
+void ep_read_pre(ep_t *t, const uint8_t *bin, int len);
+
+/**
+ * Writes a precomputation table for multiplying a fixed prime elliptic curve
+ * point to a byte vector in a versioned format.
+ *
+ * @param[out] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @param[in] t				- the precomputation table.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is invalid.
+ */
+void ep_write_pre(uint8_t *bin, int len, const ep_t *t);
+
 /**
  * Negates a prime elliptic curve point.
  *
@@ -1154,16 +1186,40 @@ void ep_mul_sim_joint(ep_t r, const ep_t p, const bn_t k, const ep_t q,
 		const bn_t m);
 
 /**
- * Multiplies and adds multiple elliptic curve points simultaneously.
+ * Multiplies and adds multiple elliptic curve points simultaneously,
+ * choosing between interleaving and the bucket method by estimated cost.
  * Computes R = \Sum_i=0..n [k_i]P_i.
  *
  * @param[out] r			- the result.
- * @param[out] p			- the elements to multiply.
- * @param[out] k			- the integer scalars.
- * @param[out] n			- the number of elements to multiply.
+ * @param[in] p				- the elements to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of elements to multiply.
  */
 void ep_mul_sim_lot(ep_t r, const ep_t p[], const bn_t k[], int n);
 
+/**
+ * Multiplies and adds multiple elliptic curve points simultaneously using
+ * interleaving of NAFs. Computes R = \Sum_i=0..n [k_i]P_i.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the elements to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of elements to multiply.
+ */
+void ep_mul_sim_lot_inter(ep_t r, const ep_t p[], const bn_t k[], int n);
+
+/**
+ * Multiplies and adds multiple elliptic curve points simultaneously using
+ * Pippenger's bucket method with signed windows. Computes
+ * R = \Sum_i=0..n [k_i]P_i.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the elements to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of elements to multiply.
+ */
+void ep_mul_sim_lot_bucket(ep_t r, const ep_t p[], const bn_t k[], int n);
+
 /**
  * Multiplies and adds the generator and a prime elliptic curve point
  * simultaneously. Computes R = [k]G + [m]Q.
@@ -1237,6 +1293,21 @@ void ep_map(ep_t p, const uint8_t *msg, int len);
 void ep_map_dst(ep_t p, const uint8_t *msg, int len, const uint8_t *dst,
 		int dst_len);
 
+/**
+ * Maps several byte arrays to points in a prime elliptic curve with a common
+ * domain separation tag, sharing the field inversions and normalizations among
+ * all of them.
+ *
+ * @param[out] p			- the results.
+ * @param[in] msg			- the byte arrays to map.
+ * @param[in] len			- the array lengths in bytes.
+ * @param[in] n				- the number of byte arrays.
+ * @param[in] dst			- the domain separation tag.
+ * @param[in] dst_len		- the domain separation tag length in bytes.
+ */
+void ep_map_dst_many(ep_t *p, const uint8_t *msg[], const int len[], int n,
+		const uint8_t *dst, int dst_len);
+
 /**
  * Compresses a point.
  *
@@ -1254,4 +1325,14 @@ void ep_pck(ep_t r, const ep_t p);
  */
 int ep_upk(ep_t r, const ep_t p);
 
+/**
+ * Decompresses many points, extracting all the square roots together.
+ *
+ * @param[out] r			- the results.
+ * @param[in] p				- the points to decompress.
+ * @param[in] n				- the number of points.
+ * @return a boolean value indicating if all decompressions were successful.
+ */
+int ep_upk_many(ep_t *r, const ep_t *p, int n);
+
 #endif /* !RLC_EP_H */
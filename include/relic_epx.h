@@ -223,7 +223,7 @@ typedef iso2_st *iso2_t;
  */
 #if ALLOC == DYNAMIC
 #define ep2_new(A)															\
-	A = (ep2_t)calloc(1, sizeof(ep2_st));									\
+	A = (ep2_t)alloc_calloc(1, sizeof(ep2_st));								\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -250,7 +250,7 @@ typedef iso2_st *iso2_t;
 		fp2_free((A)->x);													\
 		fp2_free((A)->y);													\
 		fp2_free((A)->z);													\
-		free(A);															\
+		alloc_free(A);														\
 		A = NULL;															\
 	}																		\
 
@@ -273,7 +273,7 @@ typedef iso2_st *iso2_t;
  */
 #if ALLOC == DYNAMIC
 #define ep4_new(A)															\
-	A = (ep4_t)calloc(1, sizeof(ep4_st));									\
+	A = (ep4_t)alloc_calloc(1, sizeof(ep4_st));								\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -300,7 +300,7 @@ typedef iso2_st *iso2_t;
 		fp4_free((A)->x);													\
 		fp4_free((A)->y);													\
 		fp4_free((A)->z);													\
-		free(A);															\
+		alloc_free(A);														\
 		A = NULL;															\
 	}																		\
 
@@ -759,6 +759,38 @@ void ep2_read_bin(ep2_t a, const uint8_t *bin, int len);
  */
 void ep2_write_bin(uint8_t *bin, int len, ep2_t a, int pack);
 
+/**
+ * Returns the number of bytes necessary to store a precomputation table for
+ * multiplying a fixed prime elliptic curve over a quadratic extension point.
+ *
+ * @return the number of bytes.
+ */
+int ep2_size_pre(void);
+
+/**
+ * Reads a precomputation table for multiplying a fixed prime elliptic curve over a quadratic extension
+ * point from a byte vector. The table must have been written with the same
+ * curve and precomputation method, and every point is validated.
+ *
+ * @param[out] t			- the precomputation table.
+ * @param[in] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is invalid.
+ * @throw ERR_NO_VALID		- if the encoded table is invalid.
+ */
+void ep2_read_pre(ep2_t *t, const uint8_t *bin, int len);
+
+/**
+ * Writes a precomputation table for multiplying a fixed prime elliptic curve over a quadratic extension
+ * point to a byte vector in a versioned format.
+ *
+ * @param[out] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @param[in] t				- the precomputation table.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is invalid.
+ */
+void ep2_write_pre(uint8_t *bin, int len, ep2_t *t);
+
 /**
  * Negates a point represented in affine coordinates in an elliptic curve over
  * a quadratic extension.
@@ -1075,16 +1107,40 @@ void ep2_mul_sim_inter(ep2_t r, ep2_t p, bn_t k, ep2_t q, bn_t m);
 void ep2_mul_sim_joint(ep2_t r, ep2_t p, bn_t k, ep2_t q, bn_t m);
 
 /**
- * Multiplies simultaneously elements from a prime elliptic curve.
+ * Multiplies simultaneously elements from a prime elliptic curve, choosing
+ * between interleaving and the bucket method by estimated cost.
  * Computes R = \Sum_i=0..n k_iP_i.
  *
  * @param[out] r			- the result.
- * @param[out] p			- the points to multiply.
- * @param[out] k			- the integer scalars.
- * @param[out] n			- the number of elements to multiply.
+ * @param[in] p				- the points to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of elements to multiply.
  */
 void ep2_mul_sim_lot(ep2_t r, ep2_t p[], const bn_t k[], int n);
 
+/**
+ * Multiplies simultaneously elements from a prime elliptic curve using
+ * interleaving of NAFs. Computes R = \Sum_i=0..n k_iP_i.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of elements to multiply.
+ */
+void ep2_mul_sim_lot_inter(ep2_t r, ep2_t p[], const bn_t k[], int n);
+
+/**
+ * Multiplies simultaneously elements from a prime elliptic curve using
+ * Pippenger's bucket method with signed windows. Computes
+ * R = \Sum_i=0..n k_iP_i.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of elements to multiply.
+ */
+void ep2_mul_sim_lot_bucket(ep2_t r, ep2_t p[], const bn_t k[], int n);
+
 /**
  * Multiplies and adds the generator and a prime elliptic curve point
  * simultaneously. Computes R = [k]G + [l]Q.
@@ -1157,6 +1213,21 @@ void ep2_map(ep2_t p, const uint8_t *msg, int len);
  */
 void ep2_map_dst(ep2_t p, const uint8_t *msg, int len, const uint8_t *dst, int dst_len);
 
+/**
+ * Maps several byte arrays to points in an elliptic curve over a quadratic
+ * extension with a common domain separation tag, sharing the field inversions
+ * among all of them.
+ *
+ * @param[out] p			- the results.
+ * @param[in] msg			- the byte arrays to map.
+ * @param[in] len			- the array lengths in bytes.
+ * @param[in] n				- the number of byte arrays.
+ * @param[in] dst			- the domain separation tag.
+ * @param[in] dst_len		- the domain separation tag length in bytes.
+ */
+void ep2_map_dst_many(ep2_t *p, const uint8_t *msg[], const int len[], int n,
+		const uint8_t *dst, int dst_len);
+
 /**
  * Computes a power of the Gailbraith-Lin-Scott homomorphism of a point
  * represented in affine coordinates on a twisted elliptic curve over a
@@ -1188,6 +1259,17 @@ void ep2_pck(ep2_t r, ep2_t p);
  */
 int ep2_upk(ep2_t r, ep2_t p);
 
+/**
+ * Decompresses many points in an elliptic curve over a quadratic extension,
+ * extracting all the square roots together.
+ *
+ * @param[out] r			- the results.
+ * @param[in] p				- the points to decompress.
+ * @param[in] n				- the number of points.
+ * @return if all decompressions were successful
+ */
+int ep2_upk_many(ep2_t *r, const ep2_t *p, int n);
+
 /**
  * Initializes the elliptic curve over quartic extension.
  */
@@ -1715,16 +1797,40 @@ void ep4_mul_sim_inter(ep4_t r, ep4_t p, bn_t k, ep4_t q, bn_t m);
 void ep4_mul_sim_joint(ep4_t r, ep4_t p, bn_t k, ep4_t q, bn_t m);
 
 /**
- * Multiplies simultaneously elements from a prime elliptic curve.
+ * Multiplies simultaneously elements from a prime elliptic curve, choosing
+ * between interleaving and the bucket method by estimated cost.
  * Computes R = \Sum_i=0..n k_iP_i.
  *
  * @param[out] r			- the result.
- * @param[out] p			- the points to multiply.
- * @param[out] k			- the integer scalars.
- * @param[out] n			- the number of elements to multiply.
+ * @param[in] p				- the points to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of elements to multiply.
  */
 void ep4_mul_sim_lot(ep4_t r, ep4_t p[], const bn_t k[], int n);
 
+/**
+ * Multiplies simultaneously elements from a prime elliptic curve using
+ * interleaving of NAFs. Computes R = \Sum_i=0..n k_iP_i.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of elements to multiply.
+ */
+void ep4_mul_sim_lot_inter(ep4_t r, ep4_t p[], const bn_t k[], int n);
+
+/**
+ * Multiplies simultaneously elements from a prime elliptic curve using
+ * Pippenger's bucket method with signed windows. Computes
+ * R = \Sum_i=0..n k_iP_i.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of elements to multiply.
+ */
+void ep4_mul_sim_lot_bucket(ep4_t r, ep4_t p[], const bn_t k[], int n);
+
 /**
  * Multiplies and adds the generator and a prime elliptic curve point
  * simultaneously. Computes R = [k]G + [l]Q.
@@ -125,7 +125,7 @@ typedef struct _sts_t {
 #define RLC_ERR_TRY														\
 	{																	\
 		sts_t *_last, _this;											\
-		ctx_t *_ctx = core_get();										\
+		ctx_t *_ctx = core_state();										\
 		_last = _ctx->last; 											\
 		_this.block = 1;												\
 		_ctx->last = &_this; 											\
@@ -157,7 +157,7 @@ typedef struct _sts_t {
 			}															\
 	} 																	\
 	for (int _z = 0; _z < 2; _z++) 										\
-		if (_z == 1 && core_get()->caught) 								\
+		if (_z == 1 && core_state()->caught) 								\
 
 /**
  * Implements the THROW clause of the error-handling routines.
@@ -178,7 +178,7 @@ typedef struct _sts_t {
  */
 #define RLC_ERR_THROW(E)												\
 	{																	\
-		ctx_t *_ctx = core_get();										\
+		ctx_t *_ctx = core_state();										\
 		_ctx->code = RLC_ERR;											\
 		if (_ctx->last == NULL || _ctx->last->block == 1) {				\
 			if (_ctx->last == NULL) {									\
@@ -258,10 +258,10 @@ typedef struct _sts_t {
  * Stub for the THROW clause.
  */
 #ifdef QUIET
-#define RLC_THROW(E)			core_get()->code = RLC_ERR;
+#define RLC_THROW(E)			core_state()->code = RLC_ERR;
 #else
 #define RLC_THROW(E)														\
-	core_get()->code = RLC_ERR; 											\
+	core_state()->code = RLC_ERR; 											\
 	util_print("ERROR THROWN in %s:%d\n", RLC_FILE, __LINE__);				\
 
 #endif
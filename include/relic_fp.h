@@ -798,6 +798,17 @@ void fp_add_integ(fp_t c, const fp_t a, const fp_t b);
  */
 void fp_add_dig(fp_t c, const fp_t a, dig_t b);
 
+/**
+ * Adds pairs of prime field elements in a batch. Computes c_i = a_i + b_i for
+ * 0 <= i < n.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the first prime field elements to add.
+ * @param[in] b				- the second prime field elements to add.
+ * @param[in] n				- the number of pairs.
+ */
+void fp_add_many(fp_t *c, const fp_t *a, const fp_t *b, int n);
+
 /**
  * Subtracts a prime field element from another using basic subtraction.
  * Computes c = a - b.
@@ -827,6 +838,17 @@ void fp_sub_integ(fp_t c, const fp_t a, const fp_t b);
  */
 void fp_sub_dig(fp_t c, const fp_t a, dig_t b);
 
+/**
+ * Subtracts pairs of prime field elements in a batch. Computes
+ * c_i = a_i - b_i for 0 <= i < n.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the prime field elements.
+ * @param[in] b				- the prime field elements to subtract.
+ * @param[in] n				- the number of pairs.
+ */
+void fp_sub_many(fp_t *c, const fp_t *a, const fp_t *b, int n);
+
 /**
  * Negates a prime field element using basic negation.
  *
@@ -921,6 +943,28 @@ void fp_mul_karat(fp_t c, const fp_t a, const fp_t b);
  */
 void fp_mul_dig(fp_t c, const fp_t a, dig_t b);
 
+/**
+ * Multiplies eight pairs of prime field elements at once. Computes
+ * c_i = a_i * b_i for 0 <= i < 8. Each c_i may overlap only a_i or b_i.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the first prime field elements.
+ * @param[in] b				- the second prime field elements.
+ */
+void fp_mul_x8(fp_t *c, const fp_t *a, const fp_t *b);
+
+/**
+ * Multiplies pairs of prime field elements in a batch, eight at a time.
+ * Computes c_i = a_i * b_i for 0 <= i < n. Each c_i may overlap only a_i or
+ * b_i.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the first prime field elements to multiply.
+ * @param[in] b				- the second prime field elements to multiply.
+ * @param[in] n				- the number of pairs.
+ */
+void fp_mul_many(fp_t *c, const fp_t *a, const fp_t *b, int n);
+
 /**
  * Squares a prime field element using Schoolbook squaring.
  *
@@ -954,6 +998,16 @@ void fp_sqr_integ(fp_t c, const fp_t a);
  */
 void fp_sqr_karat(fp_t c, const fp_t a);
 
+/**
+ * Squares prime field elements in a batch, eight at a time. Computes
+ * c_i = a_i^2 for 0 <= i < n. Each c_i may overlap only a_i.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the prime field elements to square.
+ * @param[in] n				- the number of elements.
+ */
+void fp_sqr_many(fp_t *c, const fp_t *a, int n);
+
 /**
  * Shifts a prime field element number to the left. Computes
  * c = a * 2^bits.
@@ -1009,6 +1063,16 @@ void fp_rdc_monty_comba(fp_t c, dv_t a);
  */
 void fp_rdc_quick(fp_t c, dv_t a);
 
+/**
+ * Reduces multiplication results modulo the prime field order in a batch.
+ * Computes c_i = a_i mod p for 0 <= i < n.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the multiplication results to reduce.
+ * @param[in] n				- the number of results.
+ */
+void fp_rdc_many(fp_t *c, dv_t *a, int n);
+
 /**
  * Inverts a prime field element using Fermat's Little Theorem.
  *
@@ -1155,6 +1219,18 @@ void fp_exp_slide(fp_t c, const fp_t a, const bn_t b);
  */
 void fp_exp_monty(fp_t c, const fp_t a, const bn_t b);
 
+/**
+ * Exponentiates many prime field elements to the same public exponent. The
+ * sliding window recoding of the exponent is computed once and all bases are
+ * processed together by the multi-lane arithmetic.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the bases.
+ * @param[in] b				- the exponent.
+ * @param[in] n				- the number of bases.
+ */
+void fp_exp_many(fp_t *c, const fp_t *a, const bn_t b, int n);
+
 /**
  * Extracts the square root of a prime field element. Computes c = sqrt(a). The
  * other square root is the negation of c.
@@ -1165,4 +1241,17 @@ void fp_exp_monty(fp_t c, const fp_t a, const bn_t b);
  */
 int fp_srt(fp_t c, const fp_t a);
 
+/**
+ * Extracts the square roots of many prime field elements. The exponentiations
+ * are shared when p = 3 mod 4, otherwise each root is extracted separately.
+ *
+ * @param[out] c			- the results.
+ * @param[out] b			- the flags telling which elements have square
+ * 							  roots, or NULL if they are not needed.
+ * @param[in] a				- the prime field elements.
+ * @param[in] n				- the number of elements.
+ * @return					- 1 if all elements have square roots, 0 otherwise.
+ */
+int fp_srt_many(fp_t *c, int *b, const fp_t *a, int n);
+
 #endif /* !RLC_FP_H */
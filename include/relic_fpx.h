@@ -1523,6 +1523,14 @@ void fp2_sqr_basic(fp2_t c, fp2_t a);
  */
 void fp2_sqr_integ(fp2_t c, fp2_t a);
 
+/**
+ * Computes the square of a cyclotomic quadratic extension field element.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the cyclotomic extension element to square.
+ */
+void fp2_sqr_cyc(fp2_t c, fp2_t a);
+
 /**
  * Inverts a quadratic extension field element. Computes c = 1/a.
  *
@@ -1613,6 +1621,19 @@ void fp2_frb(fp2_t c, fp2_t a, int i);
  */
 int fp2_srt(fp2_t c, fp2_t a);
 
+/**
+ * Extracts the square roots of many quadratic extension field elements. The
+ * square roots in the base field and the inversions are shared among elements.
+ *
+ * @param[out] c			- the results.
+ * @param[out] b			- the flags telling which elements have square
+ * 							  roots, or NULL if they are not needed.
+ * @param[in] a				- the extension field elements.
+ * @param[in] n				- the number of elements.
+ * @return					- 1 if all elements have square roots, 0 otherwise.
+ */
+int fp2_srt_many(fp2_t *c, int *b, fp2_t *a, int n);
+
 /**
  * Compresses an extension field element.
  *
@@ -3234,6 +3255,15 @@ void fp12_inv(fp12_t c, fp12_t a);
  */
 void fp12_inv_cyc(fp12_t c, fp12_t a);
 
+/**
+ * Inverts multiple dodecic extension field elements simultaneously.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the dodecic extension field elements to invert.
+ * @param[in] n				- the number of elements.
+ */
+void fp12_inv_sim(fp12_t *c, fp12_t *a, int n);
+
 /**
  * Computes the Frobenius endomorphism of a dodecic extension element.
  * Computes c = a^p.
@@ -3284,6 +3314,17 @@ void fp12_exp_cyc(fp12_t c, fp12_t a, bn_t b);
  */
 void fp2_exp_cyc_sim(fp2_t e, fp2_t a, bn_t b, fp2_t c, bn_t d);
 
+/**
+ * Computes a product of powers of cyclotomic quadratic extension field elements
+ * using the bucket method. Computes c = \Prod_i=0..n a_i^b_i.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the elements to exponentiate.
+ * @param[in] b				- the exponents.
+ * @param[in] n				- the number of elements.
+ */
+void fp2_exp_cyc_lot(fp2_t c, fp2_t a[], bn_t b[], int n);
+
 /**
  * Computes a power of a cyclotomic dodecic extension field element.
  *
@@ -3295,6 +3336,17 @@ void fp2_exp_cyc_sim(fp2_t e, fp2_t a, bn_t b, fp2_t c, bn_t d);
  */
 void fp12_exp_cyc_sim(fp12_t e, fp12_t a, bn_t b, fp12_t c, bn_t d);
 
+/**
+ * Computes a product of powers of cyclotomic dodecic extension field elements
+ * using the bucket method. Computes c = \Prod_i=0..n a_i^b_i.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the elements to exponentiate.
+ * @param[in] b				- the exponents.
+ * @param[in] n				- the number of elements.
+ */
+void fp12_exp_cyc_lot(fp12_t c, fp12_t a[], bn_t b[], int n);
+
 /**
  * Computes a power of a cyclotomic dodecic extension field element.
  *
@@ -3902,6 +3954,15 @@ void fp24_inv(fp24_t c, fp24_t a);
  */
 void fp24_inv_cyc(fp24_t c, fp24_t a);
 
+/**
+ * Inverts multiple 24-degree extension field elements simultaneously.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the 24-degree extension field elements to invert.
+ * @param[in] n				- the number of elements.
+ */
+void fp24_inv_sim(fp24_t *c, fp24_t *a, int n);
+
 /**
  * Computes the Frobenius endomorphism of a 24-degree extension element.
  * Computes c = a^p.
@@ -3952,6 +4013,17 @@ void fp24_exp_cyc(fp24_t c, fp24_t a, bn_t b);
  */
 void fp24_exp_cyc_sim(fp24_t e, fp24_t a, bn_t b, fp24_t c, bn_t d);
 
+/**
+ * Computes a product of powers of cyclotomic 24-degree extension field elements
+ * using the bucket method. Computes c = \Prod_i=0..n a_i^b_i.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the elements to exponentiate.
+ * @param[in] b				- the exponents.
+ * @param[in] n				- the number of elements.
+ */
+void fp24_exp_cyc_lot(fp24_t c, fp24_t a[], bn_t b[], int n);
+
 /**
  * Computes a power of a cyclotomic 24-extension field element.
  *
@@ -4264,6 +4336,15 @@ void fp48_inv(fp48_t c, fp48_t a);
  */
 void fp48_inv_cyc(fp48_t c, fp48_t a);
 
+/**
+ * Inverts multiple 48-extension field elements simultaneously.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the 48-extension field elements to invert.
+ * @param[in] n				- the number of elements.
+ */
+void fp48_inv_sim(fp48_t *c, fp48_t *a, int n);
+
 /**
  * Computes the Frobenius endomorphism of a 48-extension element.
  * Computes c = a^p.
@@ -48,19 +48,55 @@
 #define first_ctx     RLC_PREFIX(first_ctx)
 #undef core_ctx
 #define core_ctx      RLC_PREFIX(core_ctx)
+#undef core_par
+#define core_par      RLC_PREFIX(core_par)
 
 #undef core_init
 #undef core_clean
 #undef core_get
+#undef core_state
 #undef core_set
+#undef core_par_new
+#undef core_par_free
+#undef core_par_get
+#undef core_par_set
+#undef core_run
 #undef core_set_thread_initializer
 
 #define core_init 	RLC_PREFIX(core_init)
 #define core_clean 	RLC_PREFIX(core_clean)
 #define core_get 	RLC_PREFIX(core_get)
+#define core_state 	RLC_PREFIX(core_state)
 #define core_set 	RLC_PREFIX(core_set)
+#define core_par_new 	RLC_PREFIX(core_par_new)
+#define core_par_free 	RLC_PREFIX(core_par_free)
+#define core_par_get 	RLC_PREFIX(core_par_get)
+#define core_par_set 	RLC_PREFIX(core_par_set)
+#define core_run 	RLC_PREFIX(core_run)
 #define core_set_thread_initializer 	RLC_PREFIX(core_set_thread_initializer)
 
+#undef alloc_set
+#undef alloc_init
+#undef alloc_clean
+#undef alloc_malloc
+#undef alloc_calloc
+#undef alloc_realloc
+#undef alloc_free
+#undef alloc_mark
+#undef alloc_release
+#undef alloc_stats
+
+#define alloc_set 	RLC_PREFIX(alloc_set)
+#define alloc_init 	RLC_PREFIX(alloc_init)
+#define alloc_clean 	RLC_PREFIX(alloc_clean)
+#define alloc_malloc 	RLC_PREFIX(alloc_malloc)
+#define alloc_calloc 	RLC_PREFIX(alloc_calloc)
+#define alloc_realloc 	RLC_PREFIX(alloc_realloc)
+#define alloc_free 	RLC_PREFIX(alloc_free)
+#define alloc_mark 	RLC_PREFIX(alloc_mark)
+#define alloc_release 	RLC_PREFIX(alloc_release)
+#define alloc_stats 	RLC_PREFIX(alloc_stats)
+
 #undef arch_init
 #undef arch_clean
 #undef arch_cycles
@@ -246,10 +282,22 @@
 #undef bn_mod_monty_comba
 #undef bn_mod_pre_pmers
 #undef bn_mod_pmers
+#undef bn_mod_ctx
+#undef bn_mod_ctx_rdc
+#undef bn_mod_ctx_conv
+#undef bn_mod_ctx_back
+#undef bn_mod_ctx_mul
+#undef bn_mod_ctx_sqr
 #undef bn_mxp_basic
 #undef bn_mxp_slide
 #undef bn_mxp_monty
 #undef bn_mxp_dig
+#undef bn_mxp_pre
+#undef bn_mxp_fix
+#undef bn_mxp_ctx
+#undef bn_mxp_ctx_dig
+#undef bn_mxp_ctx_many
+#undef bn_mxp_x8
 #undef bn_mxp_crt
 #undef bn_srt
 #undef bn_gcd_basic
@@ -269,6 +317,7 @@
 #undef bn_is_prime_basic
 #undef bn_is_prime_rabin
 #undef bn_is_prime_solov
+#undef bn_next_prime
 #undef bn_gen_prime_basic
 #undef bn_gen_prime_safep
 #undef bn_gen_prime_stron
@@ -286,8 +335,13 @@
 #undef bn_rec_jsf
 #undef bn_rec_glv
 #undef bn_rec_frb
+#undef bn_rec_bkt
+#undef bn_rec_get
 #undef bn_lag
 #undef bn_evl
+#undef bn_lag_fast
+#undef bn_evl_sim
+#undef bn_itp
 
 #define bn_make 	RLC_PREFIX(bn_make)
 #define bn_clean 	RLC_PREFIX(bn_clean)
@@ -355,10 +409,22 @@
 #define bn_mod_monty_comba 	RLC_PREFIX(bn_mod_monty_comba)
 #define bn_mod_pre_pmers 	RLC_PREFIX(bn_mod_pre_pmers)
 #define bn_mod_pmers 	RLC_PREFIX(bn_mod_pmers)
+#define bn_mod_ctx 	RLC_PREFIX(bn_mod_ctx)
+#define bn_mod_ctx_rdc 	RLC_PREFIX(bn_mod_ctx_rdc)
+#define bn_mod_ctx_conv 	RLC_PREFIX(bn_mod_ctx_conv)
+#define bn_mod_ctx_back 	RLC_PREFIX(bn_mod_ctx_back)
+#define bn_mod_ctx_mul 	RLC_PREFIX(bn_mod_ctx_mul)
+#define bn_mod_ctx_sqr 	RLC_PREFIX(bn_mod_ctx_sqr)
 #define bn_mxp_basic 	RLC_PREFIX(bn_mxp_basic)
 #define bn_mxp_slide 	RLC_PREFIX(bn_mxp_slide)
 #define bn_mxp_monty 	RLC_PREFIX(bn_mxp_monty)
 #define bn_mxp_dig 	RLC_PREFIX(bn_mxp_dig)
+#define bn_mxp_pre 	RLC_PREFIX(bn_mxp_pre)
+#define bn_mxp_fix 	RLC_PREFIX(bn_mxp_fix)
+#define bn_mxp_ctx 	RLC_PREFIX(bn_mxp_ctx)
+#define bn_mxp_ctx_dig 	RLC_PREFIX(bn_mxp_ctx_dig)
+#define bn_mxp_ctx_many 	RLC_PREFIX(bn_mxp_ctx_many)
+#define bn_mxp_x8 	RLC_PREFIX(bn_mxp_x8)
 #define bn_mxp_crt 	RLC_PREFIX(bn_mxp_crt)
 #define bn_srt 	RLC_PREFIX(bn_srt)
 #define bn_gcd_basic 	RLC_PREFIX(bn_gcd_basic)
@@ -378,6 +444,7 @@
 #define bn_is_prime_basic 	RLC_PREFIX(bn_is_prime_basic)
 #define bn_is_prime_rabin 	RLC_PREFIX(bn_is_prime_rabin)
 #define bn_is_prime_solov 	RLC_PREFIX(bn_is_prime_solov)
+#define bn_next_prime 	RLC_PREFIX(bn_next_prime)
 #define bn_gen_prime_basic 	RLC_PREFIX(bn_gen_prime_basic)
 #define bn_gen_prime_safep 	RLC_PREFIX(bn_gen_prime_safep)
 #define bn_gen_prime_stron 	RLC_PREFIX(bn_gen_prime_stron)
@@ -395,8 +462,13 @@
 #define bn_rec_jsf 	RLC_PREFIX(bn_rec_jsf)
 #define bn_rec_glv 	RLC_PREFIX(bn_rec_glv)
 #define bn_rec_frb 	RLC_PREFIX(bn_rec_frb)
+#define bn_rec_bkt 	RLC_PREFIX(bn_rec_bkt)
+#define bn_rec_get 	RLC_PREFIX(bn_rec_get)
 #define bn_lag 	RLC_PREFIX(bn_lag)
 #define bn_evl 	RLC_PREFIX(bn_evl)
+#define bn_lag_fast 	RLC_PREFIX(bn_lag_fast)
+#define bn_evl_sim 	RLC_PREFIX(bn_evl_sim)
+#define bn_itp 	RLC_PREFIX(bn_itp)
 
 #undef bn_add1_low
 #undef bn_addn_low
@@ -419,6 +491,8 @@
 #undef bn_divn_low
 #undef bn_div1_low
 #undef bn_modn_low
+#undef bn_mulm_x8_low
+#undef bn_rdcm_x8_low
 
 #define bn_add1_low 	RLC_PREFIX(bn_add1_low)
 #define bn_addn_low 	RLC_PREFIX(bn_addn_low)
@@ -441,6 +515,8 @@
 #define bn_divn_low 	RLC_PREFIX(bn_divn_low)
 #define bn_div1_low 	RLC_PREFIX(bn_div1_low)
 #define bn_modn_low 	RLC_PREFIX(bn_modn_low)
+#define bn_mulm_x8_low 	RLC_PREFIX(bn_mulm_x8_low)
+#define bn_rdcm_x8_low 	RLC_PREFIX(bn_rdcm_x8_low)
 
 #undef fp_st
 #undef fp_t
@@ -495,9 +571,11 @@
 #undef fp_add_basic
 #undef fp_add_integ
 #undef fp_add_dig
+#undef fp_add_many
 #undef fp_sub_basic
 #undef fp_sub_integ
 #undef fp_sub_dig
+#undef fp_sub_many
 #undef fp_neg_basic
 #undef fp_neg_integ
 #undef fp_dbl_basic
@@ -509,16 +587,20 @@
 #undef fp_mul_integ
 #undef fp_mul_karat
 #undef fp_mul_dig
+#undef fp_mul_x8
+#undef fp_mul_many
 #undef fp_sqr_basic
 #undef fp_sqr_comba
 #undef fp_sqr_integ
 #undef fp_sqr_karat
+#undef fp_sqr_many
 #undef fp_lsh
 #undef fp_rsh
 #undef fp_rdc_basic
 #undef fp_rdc_monty_basic
 #undef fp_rdc_monty_comba
 #undef fp_rdc_quick
+#undef fp_rdc_many
 #undef fp_inv_basic
 #undef fp_inv_binar
 #undef fp_inv_monty
@@ -535,7 +617,9 @@
 #undef fp_exp_basic
 #undef fp_exp_slide
 #undef fp_exp_monty
+#undef fp_exp_many
 #undef fp_srt
+#undef fp_srt_many
 
 #define fp_prime_init 	RLC_PREFIX(fp_prime_init)
 #define fp_prime_clean 	RLC_PREFIX(fp_prime_clean)
@@ -585,9 +669,11 @@
 #define fp_add_basic 	RLC_PREFIX(fp_add_basic)
 #define fp_add_integ 	RLC_PREFIX(fp_add_integ)
 #define fp_add_dig 	RLC_PREFIX(fp_add_dig)
+#define fp_add_many 	RLC_PREFIX(fp_add_many)
 #define fp_sub_basic 	RLC_PREFIX(fp_sub_basic)
 #define fp_sub_integ 	RLC_PREFIX(fp_sub_integ)
 #define fp_sub_dig 	RLC_PREFIX(fp_sub_dig)
+#define fp_sub_many 	RLC_PREFIX(fp_sub_many)
 #define fp_neg_basic 	RLC_PREFIX(fp_neg_basic)
 #define fp_neg_integ 	RLC_PREFIX(fp_neg_integ)
 #define fp_dbl_basic 	RLC_PREFIX(fp_dbl_basic)
@@ -599,16 +685,20 @@
 #define fp_mul_integ 	RLC_PREFIX(fp_mul_integ)
 #define fp_mul_karat 	RLC_PREFIX(fp_mul_karat)
 #define fp_mul_dig 	RLC_PREFIX(fp_mul_dig)
+#define fp_mul_x8 	RLC_PREFIX(fp_mul_x8)
+#define fp_mul_many 	RLC_PREFIX(fp_mul_many)
 #define fp_sqr_basic 	RLC_PREFIX(fp_sqr_basic)
 #define fp_sqr_comba 	RLC_PREFIX(fp_sqr_comba)
 #define fp_sqr_integ 	RLC_PREFIX(fp_sqr_integ)
 #define fp_sqr_karat 	RLC_PREFIX(fp_sqr_karat)
+#define fp_sqr_many 	RLC_PREFIX(fp_sqr_many)
 #define fp_lsh 	RLC_PREFIX(fp_lsh)
 #define fp_rsh 	RLC_PREFIX(fp_rsh)
 #define fp_rdc_basic 	RLC_PREFIX(fp_rdc_basic)
 #define fp_rdc_monty_basic 	RLC_PREFIX(fp_rdc_monty_basic)
 #define fp_rdc_monty_comba 	RLC_PREFIX(fp_rdc_monty_comba)
 #define fp_rdc_quick 	RLC_PREFIX(fp_rdc_quick)
+#define fp_rdc_many 	RLC_PREFIX(fp_rdc_many)
 #define fp_inv_basic 	RLC_PREFIX(fp_inv_basic)
 #define fp_inv_binar 	RLC_PREFIX(fp_inv_binar)
 #define fp_inv_monty 	RLC_PREFIX(fp_inv_monty)
@@ -625,16 +715,20 @@
 #define fp_exp_basic 	RLC_PREFIX(fp_exp_basic)
 #define fp_exp_slide 	RLC_PREFIX(fp_exp_slide)
 #define fp_exp_monty 	RLC_PREFIX(fp_exp_monty)
+#define fp_exp_many 	RLC_PREFIX(fp_exp_many)
 #define fp_srt 	RLC_PREFIX(fp_srt)
+#define fp_srt_many 	RLC_PREFIX(fp_srt_many)
 
 #undef fp_add1_low
 #undef fp_addn_low
 #undef fp_addm_low
+#undef fp_addm_x8_low
 #undef fp_addd_low
 #undef fp_addc_low
 #undef fp_sub1_low
 #undef fp_subn_low
 #undef fp_subm_low
+#undef fp_subm_x8_low
 #undef fp_subd_low
 #undef fp_subc_low
 #undef fp_negm_low
@@ -650,21 +744,28 @@
 #undef fp_mul1_low
 #undef fp_muln_low
 #undef fp_mulm_low
+#undef fp_mulm_x8_low
+#undef fp_sqrm_x8_low
 #undef fp_sqrn_low
 #undef fp_sqrm_low
 #undef fp_rdcs_low
 #undef fp_rdcn_low
+#undef fp_rdcn_x8_low
 #undef fp_invm_low
 #undef fp_smbm_low
+#undef fp_invds_low
+#undef fp_smbds_low
 
 #define fp_add1_low 	RLC_PREFIX(fp_add1_low)
 #define fp_addn_low 	RLC_PREFIX(fp_addn_low)
 #define fp_addm_low 	RLC_PREFIX(fp_addm_low)
+#define fp_addm_x8_low 	RLC_PREFIX(fp_addm_x8_low)
 #define fp_addd_low 	RLC_PREFIX(fp_addd_low)
 #define fp_addc_low 	RLC_PREFIX(fp_addc_low)
 #define fp_sub1_low 	RLC_PREFIX(fp_sub1_low)
 #define fp_subn_low 	RLC_PREFIX(fp_subn_low)
 #define fp_subm_low 	RLC_PREFIX(fp_subm_low)
+#define fp_subm_x8_low 	RLC_PREFIX(fp_subm_x8_low)
 #define fp_subd_low 	RLC_PREFIX(fp_subd_low)
 #define fp_subc_low 	RLC_PREFIX(fp_subc_low)
 #define fp_negm_low 	RLC_PREFIX(fp_negm_low)
@@ -680,12 +781,17 @@
 #define fp_mul1_low 	RLC_PREFIX(fp_mul1_low)
 #define fp_muln_low 	RLC_PREFIX(fp_muln_low)
 #define fp_mulm_low 	RLC_PREFIX(fp_mulm_low)
+#define fp_mulm_x8_low 	RLC_PREFIX(fp_mulm_x8_low)
+#define fp_sqrm_x8_low 	RLC_PREFIX(fp_sqrm_x8_low)
 #define fp_sqrn_low 	RLC_PREFIX(fp_sqrn_low)
 #define fp_sqrm_low 	RLC_PREFIX(fp_sqrm_low)
 #define fp_rdcs_low 	RLC_PREFIX(fp_rdcs_low)
 #define fp_rdcn_low 	RLC_PREFIX(fp_rdcn_low)
+#define fp_rdcn_x8_low 	RLC_PREFIX(fp_rdcn_x8_low)
 #define fp_invm_low 	RLC_PREFIX(fp_invm_low)
 #define fp_smbm_low 	RLC_PREFIX(fp_smbm_low)
+#define fp_invds_low 	RLC_PREFIX(fp_invds_low)
+#define fp_smbds_low 	RLC_PREFIX(fp_smbds_low)
 
 #undef fp_st
 #undef fp_t
@@ -934,6 +1040,9 @@
 #undef ep_size_bin
 #undef ep_read_bin
 #undef ep_write_bin
+#undef ep_size_pre
+#undef ep_read_pre
+#undef ep_write_pre
 #undef ep_neg
 #undef ep_add_basic
 #undef ep_add_slp_basic
@@ -969,6 +1078,8 @@
 #undef ep_mul_sim_inter
 #undef ep_mul_sim_joint
 #undef ep_mul_sim_lot
+#undef ep_mul_sim_lot_inter
+#undef ep_mul_sim_lot_bucket
 #undef ep_mul_sim_gen
 #undef ep_mul_sim_dig
 #undef ep_norm
@@ -976,8 +1087,10 @@
 #undef ep_map_from_field
 #undef ep_map
 #undef ep_map_dst
+#undef ep_map_dst_many
 #undef ep_pck
 #undef ep_upk
+#undef ep_upk_many
 
 #define ep_curve_init 	RLC_PREFIX(ep_curve_init)
 #define ep_curve_clean 	RLC_PREFIX(ep_curve_clean)
@@ -1028,6 +1141,9 @@
 #define ep_size_bin 	RLC_PREFIX(ep_size_bin)
 #define ep_read_bin 	RLC_PREFIX(ep_read_bin)
 #define ep_write_bin 	RLC_PREFIX(ep_write_bin)
+#define ep_size_pre 	RLC_PREFIX(ep_size_pre)
+#define ep_read_pre 	RLC_PREFIX(ep_read_pre)
+#define ep_write_pre 	RLC_PREFIX(ep_write_pre)
 #define ep_neg 	RLC_PREFIX(ep_neg)
 #define ep_add_basic 	RLC_PREFIX(ep_add_basic)
 #define ep_add_slp_basic 	RLC_PREFIX(ep_add_slp_basic)
@@ -1063,6 +1179,8 @@
 #define ep_mul_sim_inter 	RLC_PREFIX(ep_mul_sim_inter)
 #define ep_mul_sim_joint 	RLC_PREFIX(ep_mul_sim_joint)
 #define ep_mul_sim_lot 	RLC_PREFIX(ep_mul_sim_lot)
+#define ep_mul_sim_lot_inter 	RLC_PREFIX(ep_mul_sim_lot_inter)
+#define ep_mul_sim_lot_bucket 	RLC_PREFIX(ep_mul_sim_lot_bucket)
 #define ep_mul_sim_gen 	RLC_PREFIX(ep_mul_sim_gen)
 #define ep_mul_sim_dig 	RLC_PREFIX(ep_mul_sim_dig)
 #define ep_norm 	RLC_PREFIX(ep_norm)
@@ -1070,8 +1188,10 @@
 #define ep_map_from_field 	RLC_PREFIX(ep_map_from_field)
 #define ep_map 	RLC_PREFIX(ep_map)
 #define ep_map_dst 	RLC_PREFIX(ep_map_dst)
+#define ep_map_dst_many 	RLC_PREFIX(ep_map_dst_many)
 #define ep_pck 	RLC_PREFIX(ep_pck)
 #define ep_upk 	RLC_PREFIX(ep_upk)
+#define ep_upk_many 	RLC_PREFIX(ep_upk_many)
 
 #undef ed_st
 #undef ed_t
@@ -1132,6 +1252,8 @@
 #undef ed_mul_sim_inter
 #undef ed_mul_sim_joint
 #undef ed_mul_sim_lot
+#undef ed_mul_sim_lot_inter
+#undef ed_mul_sim_lot_bucket
 #undef ed_mul_sim_gen
 #undef ed_tab
 #undef ed_print
@@ -1201,6 +1323,8 @@
 #define ed_mul_sim_inter 	RLC_PREFIX(ed_mul_sim_inter)
 #define ed_mul_sim_joint 	RLC_PREFIX(ed_mul_sim_joint)
 #define ed_mul_sim_lot 	RLC_PREFIX(ed_mul_sim_lot)
+#define ed_mul_sim_lot_inter 	RLC_PREFIX(ed_mul_sim_lot_inter)
+#define ed_mul_sim_lot_bucket 	RLC_PREFIX(ed_mul_sim_lot_bucket)
 #define ed_mul_sim_gen 	RLC_PREFIX(ed_mul_sim_gen)
 #define ed_tab 	RLC_PREFIX(ed_tab)
 #define ed_print 	RLC_PREFIX(ed_print)
@@ -1399,6 +1523,9 @@
 #undef ep2_size_bin
 #undef ep2_read_bin
 #undef ep2_write_bin
+#undef ep2_size_pre
+#undef ep2_read_pre
+#undef ep2_write_pre
 #undef ep2_neg
 #undef ep2_add_basic
 #undef ep2_add_slp_basic
@@ -1432,6 +1559,8 @@
 #undef ep2_mul_sim_inter
 #undef ep2_mul_sim_joint
 #undef ep2_mul_sim_lot
+#undef ep2_mul_sim_lot_inter
+#undef ep2_mul_sim_lot_bucket
 #undef ep2_mul_sim_gen
 #undef ep2_mul_sim_dig
 #undef ep2_norm
@@ -1439,9 +1568,11 @@
 #undef ep2_map_from_field
 #undef ep2_map
 #undef ep2_map_dst
+#undef ep2_map_dst_many
 #undef ep2_frb
 #undef ep2_pck
 #undef ep2_upk
+#undef ep2_upk_many
 
 #define ep2_curve_init 	RLC_PREFIX(ep2_curve_init)
 #define ep2_curve_clean 	RLC_PREFIX(ep2_curve_clean)
@@ -1472,6 +1603,9 @@
 #define ep2_size_bin 	RLC_PREFIX(ep2_size_bin)
 #define ep2_read_bin 	RLC_PREFIX(ep2_read_bin)
 #define ep2_write_bin 	RLC_PREFIX(ep2_write_bin)
+#define ep2_size_pre 	RLC_PREFIX(ep2_size_pre)
+#define ep2_read_pre 	RLC_PREFIX(ep2_read_pre)
+#define ep2_write_pre 	RLC_PREFIX(ep2_write_pre)
 #define ep2_neg 	RLC_PREFIX(ep2_neg)
 #define ep2_add_basic 	RLC_PREFIX(ep2_add_basic)
 #define ep2_add_slp_basic 	RLC_PREFIX(ep2_add_slp_basic)
@@ -1505,6 +1639,8 @@
 #define ep2_mul_sim_inter 	RLC_PREFIX(ep2_mul_sim_inter)
 #define ep2_mul_sim_joint 	RLC_PREFIX(ep2_mul_sim_joint)
 #define ep2_mul_sim_lot 	RLC_PREFIX(ep2_mul_sim_lot)
+#define ep2_mul_sim_lot_inter 	RLC_PREFIX(ep2_mul_sim_lot_inter)
+#define ep2_mul_sim_lot_bucket 	RLC_PREFIX(ep2_mul_sim_lot_bucket)
 #define ep2_mul_sim_gen 	RLC_PREFIX(ep2_mul_sim_gen)
 #define ep2_mul_sim_dig 	RLC_PREFIX(ep2_mul_sim_dig)
 #define ep2_norm 	RLC_PREFIX(ep2_norm)
@@ -1512,9 +1648,11 @@
 #define ep2_map_from_field 	RLC_PREFIX(ep2_map_from_field)
 #define ep2_map 	RLC_PREFIX(ep2_map)
 #define ep2_map_dst 	RLC_PREFIX(ep2_map_dst)
+#define ep2_map_dst_many 	RLC_PREFIX(ep2_map_dst_many)
 #define ep2_frb 	RLC_PREFIX(ep2_frb)
 #define ep2_pck 	RLC_PREFIX(ep2_pck)
 #define ep2_upk 	RLC_PREFIX(ep2_upk)
+#define ep2_upk_many 	RLC_PREFIX(ep2_upk_many)
 
 #undef ep4_st
 #undef ep4_t
@@ -1581,6 +1719,8 @@
 #undef ep4_mul_sim_inter
 #undef ep4_mul_sim_joint
 #undef ep4_mul_sim_lot
+#undef ep4_mul_sim_lot_inter
+#undef ep4_mul_sim_lot_bucket
 #undef ep4_mul_sim_gen
 #undef ep4_mul_sim_dig
 #undef ep4_norm
@@ -1651,6 +1791,8 @@
 #define ep4_mul_sim_inter 	RLC_PREFIX(ep4_mul_sim_inter)
 #define ep4_mul_sim_joint 	RLC_PREFIX(ep4_mul_sim_joint)
 #define ep4_mul_sim_lot 	RLC_PREFIX(ep4_mul_sim_lot)
+#define ep4_mul_sim_lot_inter 	RLC_PREFIX(ep4_mul_sim_lot_inter)
+#define ep4_mul_sim_lot_bucket 	RLC_PREFIX(ep4_mul_sim_lot_bucket)
 #define ep4_mul_sim_gen 	RLC_PREFIX(ep4_mul_sim_gen)
 #define ep4_mul_sim_dig 	RLC_PREFIX(ep4_mul_sim_dig)
 #define ep4_norm 	RLC_PREFIX(ep4_norm)
@@ -1753,6 +1895,7 @@
 #undef fp2_mul_dig
 #undef fp2_sqr_basic
 #undef fp2_sqr_integ
+#undef fp2_sqr_cyc
 #undef fp2_inv
 #undef fp2_inv_cyc
 #undef fp2_inv_sim
@@ -1763,9 +1906,11 @@
 #undef fp2_exp_cyc
 #undef fp2_frb
 #undef fp2_srt
+#undef fp2_srt_many
 #undef fp2_pck
 #undef fp2_upk
 #undef fp2_exp_cyc_sim
+#undef fp2_exp_cyc_lot
 
 #define fp2_add_dig 	RLC_PREFIX(fp2_add_dig)
 #define fp2_sub_dig 	RLC_PREFIX(fp2_sub_dig)
@@ -1798,6 +1943,7 @@
 #define fp2_mul_dig 	RLC_PREFIX(fp2_mul_dig)
 #define fp2_sqr_basic 	RLC_PREFIX(fp2_sqr_basic)
 #define fp2_sqr_integ 	RLC_PREFIX(fp2_sqr_integ)
+#define fp2_sqr_cyc 	RLC_PREFIX(fp2_sqr_cyc)
 #define fp2_inv 	RLC_PREFIX(fp2_inv)
 #define fp2_inv_cyc 	RLC_PREFIX(fp2_inv_cyc)
 #define fp2_inv_sim 	RLC_PREFIX(fp2_inv_sim)
@@ -1808,9 +1954,11 @@
 #define fp2_exp_cyc 	RLC_PREFIX(fp2_exp_cyc)
 #define fp2_frb 	RLC_PREFIX(fp2_frb)
 #define fp2_srt 	RLC_PREFIX(fp2_srt)
+#define fp2_srt_many 	RLC_PREFIX(fp2_srt_many)
 #define fp2_pck 	RLC_PREFIX(fp2_pck)
 #define fp2_upk 	RLC_PREFIX(fp2_upk)
 #define fp2_exp_cyc_sim 	RLC_PREFIX(fp2_exp_cyc_sim)
+#define fp2_exp_cyc_lot 	RLC_PREFIX(fp2_exp_cyc_lot)
 
 #undef fp2_addn_low
 #undef fp2_addm_low
@@ -2224,11 +2372,13 @@
 #undef fp12_back_cyc_sim
 #undef fp12_inv
 #undef fp12_inv_cyc
+#undef fp12_inv_sim
 #undef fp12_frb
 #undef fp12_exp
 #undef fp12_exp_dig
 #undef fp12_exp_cyc
 #undef fp12_exp_cyc_sim
+#undef fp12_exp_cyc_lot
 #undef fp12_exp_cyc_sps
 #undef fp12_pck
 #undef fp12_upk
@@ -2269,11 +2419,13 @@
 #define fp12_back_cyc_sim 	RLC_PREFIX(fp12_back_cyc_sim)
 #define fp12_inv 	RLC_PREFIX(fp12_inv)
 #define fp12_inv_cyc 	RLC_PREFIX(fp12_inv_cyc)
+#define fp12_inv_sim 	RLC_PREFIX(fp12_inv_sim)
 #define fp12_frb 	RLC_PREFIX(fp12_frb)
 #define fp12_exp 	RLC_PREFIX(fp12_exp)
 #define fp12_exp_dig 	RLC_PREFIX(fp12_exp_dig)
 #define fp12_exp_cyc 	RLC_PREFIX(fp12_exp_cyc)
 #define fp12_exp_cyc_sim 	RLC_PREFIX(fp12_exp_cyc_sim)
+#define fp12_exp_cyc_lot 	RLC_PREFIX(fp12_exp_cyc_lot)
 #define fp12_exp_cyc_sps 	RLC_PREFIX(fp12_exp_cyc_sps)
 #define fp12_pck 	RLC_PREFIX(fp12_pck)
 #define fp12_upk 	RLC_PREFIX(fp12_upk)
@@ -2373,11 +2525,13 @@
 #undef fp24_back_cyc_sim
 #undef fp24_inv
 #undef fp24_inv_cyc
+#undef fp24_inv_sim
 #undef fp24_frb
 #undef fp24_exp
 #undef fp24_exp_dig
 #undef fp24_exp_cyc
 #undef fp24_exp_cyc_sim
+#undef fp24_exp_cyc_lot
 #undef fp24_exp_cyc_sps
 #undef fp24_pck
 #undef fp24_upk
@@ -2415,11 +2569,13 @@
 #define fp24_back_cyc_sim 	RLC_PREFIX(fp24_back_cyc_sim)
 #define fp24_inv 	RLC_PREFIX(fp24_inv)
 #define fp24_inv_cyc 	RLC_PREFIX(fp24_inv_cyc)
+#define fp24_inv_sim 	RLC_PREFIX(fp24_inv_sim)
 #define fp24_frb 	RLC_PREFIX(fp24_frb)
 #define fp24_exp 	RLC_PREFIX(fp24_exp)
 #define fp24_exp_dig 	RLC_PREFIX(fp24_exp_dig)
 #define fp24_exp_cyc 	RLC_PREFIX(fp24_exp_cyc)
 #define fp24_exp_cyc_sim 	RLC_PREFIX(fp24_exp_cyc_sim)
+#define fp24_exp_cyc_lot 	RLC_PREFIX(fp24_exp_cyc_lot)
 #define fp24_exp_cyc_sps 	RLC_PREFIX(fp24_exp_cyc_sps)
 #define fp24_pck 	RLC_PREFIX(fp24_pck)
 #define fp24_upk 	RLC_PREFIX(fp24_upk)
@@ -2455,6 +2611,7 @@
 #undef fp48_back_cyc_sim
 #undef fp48_inv
 #undef fp48_inv_cyc
+#undef fp48_inv_sim
 #undef fp48_frb
 #undef fp48_exp
 #undef fp48_exp_dig
@@ -2494,6 +2651,7 @@
 #define fp48_back_cyc_sim 	RLC_PREFIX(fp48_back_cyc_sim)
 #define fp48_inv 	RLC_PREFIX(fp48_inv)
 #define fp48_inv_cyc 	RLC_PREFIX(fp48_inv_cyc)
+#define fp48_inv_sim 	RLC_PREFIX(fp48_inv_sim)
 #define fp48_frb 	RLC_PREFIX(fp48_frb)
 #define fp48_exp 	RLC_PREFIX(fp48_exp)
 #define fp48_exp_dig 	RLC_PREFIX(fp48_exp_dig)
@@ -2631,8 +2789,11 @@
 #undef pp_exp_k2
 #undef pp_exp_k8
 #undef pp_exp_k12
+#undef pp_exp_k12_many
 #undef pp_exp_k24
+#undef pp_exp_k24_many
 #undef pp_exp_k48
+#undef pp_exp_k48_many
 #undef pp_exp_k54
 #undef pp_norm_k2
 #undef pp_norm_k8
@@ -2649,9 +2810,19 @@
 #undef pp_map_sim_weilp_k12
 #undef pp_map_oatep_k12
 #undef pp_map_sim_oatep_k12
+#undef pp_map_sim_oatep_k12_aff
+#undef pp_map_pre_k12
+#undef pp_map_oatep_k12_pre
+#undef pp_map_sim_oatep_k12_pre
 #undef pp_map_k24
 #undef pp_map_sim_k24
+#undef pp_map_pre_k24
+#undef pp_map_k24_pre
+#undef pp_map_sim_k24_pre
 #undef pp_map_k48
+#undef pp_map_pre_k48
+#undef pp_map_k48_pre
+#undef pp_map_sim_k48_pre
 #undef pp_map_k54
 
 #define pp_map_init 	RLC_PREFIX(pp_map_init)
@@ -2691,8 +2862,11 @@
 #define pp_exp_k2 	RLC_PREFIX(pp_exp_k2)
 #define pp_exp_k8 	RLC_PREFIX(pp_exp_k8)
 #define pp_exp_k12 	RLC_PREFIX(pp_exp_k12)
+#define pp_exp_k12_many 	RLC_PREFIX(pp_exp_k12_many)
 #define pp_exp_k24 	RLC_PREFIX(pp_exp_k24)
+#define pp_exp_k24_many 	RLC_PREFIX(pp_exp_k24_many)
 #define pp_exp_k48 	RLC_PREFIX(pp_exp_k48)
+#define pp_exp_k48_many 	RLC_PREFIX(pp_exp_k48_many)
 #define pp_exp_k54 	RLC_PREFIX(pp_exp_k54)
 #define pp_norm_k2 	RLC_PREFIX(pp_norm_k2)
 #define pp_norm_k8 	RLC_PREFIX(pp_norm_k8)
@@ -2709,9 +2883,19 @@
 #define pp_map_sim_weilp_k12 	RLC_PREFIX(pp_map_sim_weilp_k12)
 #define pp_map_oatep_k12 	RLC_PREFIX(pp_map_oatep_k12)
 #define pp_map_sim_oatep_k12 	RLC_PREFIX(pp_map_sim_oatep_k12)
+#define pp_map_sim_oatep_k12_aff 	RLC_PREFIX(pp_map_sim_oatep_k12_aff)
+#define pp_map_pre_k12 	RLC_PREFIX(pp_map_pre_k12)
+#define pp_map_oatep_k12_pre 	RLC_PREFIX(pp_map_oatep_k12_pre)
+#define pp_map_sim_oatep_k12_pre 	RLC_PREFIX(pp_map_sim_oatep_k12_pre)
 #define pp_map_k24 	RLC_PREFIX(pp_map_k24)
 #define pp_map_sim_k24 	RLC_PREFIX(pp_map_sim_k24)
+#define pp_map_pre_k24 	RLC_PREFIX(pp_map_pre_k24)
+#define pp_map_k24_pre 	RLC_PREFIX(pp_map_k24_pre)
+#define pp_map_sim_k24_pre 	RLC_PREFIX(pp_map_sim_k24_pre)
 #define pp_map_k48 	RLC_PREFIX(pp_map_k48)
+#define pp_map_pre_k48 	RLC_PREFIX(pp_map_pre_k48)
+#define pp_map_k48_pre 	RLC_PREFIX(pp_map_k48_pre)
+#define pp_map_sim_k48_pre 	RLC_PREFIX(pp_map_sim_k48_pre)
 #define pp_map_k54 	RLC_PREFIX(pp_map_k54)
 
 #undef pc_core_init
@@ -2752,7 +2936,9 @@
 #undef cp_rsa_gen
 #undef cp_rsa_enc
 #undef cp_rsa_dec
+#undef cp_rsa_dec_many
 #undef cp_rsa_sig
+#undef cp_rsa_sig_many
 #undef cp_rsa_ver
 #undef cp_rabin_gen
 #undef cp_rabin_enc
@@ -2762,6 +2948,8 @@
 #undef cp_bdpe_dec
 #undef cp_phpe_gen
 #undef cp_phpe_enc
+#undef cp_phpe_ctx
+#undef cp_phpe_enc_ctx
 #undef cp_phpe_add
 #undef cp_phpe_dec
 #undef cp_shpe_gen
@@ -2770,6 +2958,8 @@
 #undef cp_shpe_dec
 #undef cp_ghpe_gen
 #undef cp_ghpe_enc
+#undef cp_ghpe_ctx
+#undef cp_ghpe_enc_ctx
 #undef cp_ghpe_dec
 #undef cp_ecdh_gen
 #undef cp_ecdh_key
@@ -2781,9 +2971,14 @@
 #undef cp_ecdsa_gen
 #undef cp_ecdsa_sig
 #undef cp_ecdsa_ver
+#undef cp_ecdsa_ver_batch
 #undef cp_ecss_gen
 #undef cp_ecss_sig
 #undef cp_ecss_ver
+#undef cp_eddsa_gen
+#undef cp_eddsa_sig
+#undef cp_eddsa_ver
+#undef cp_eddsa_ver_batch
 #undef cp_pdpub_gen
 #undef cp_pdpub_ask
 #undef cp_pdpub_ans
@@ -2818,6 +3013,10 @@
 #undef cp_bls_gen
 #undef cp_bls_sig
 #undef cp_bls_ver
+#undef cp_bls_agg_sig
+#undef cp_bls_agg_ver
+#undef cp_bls_fast_ver
+#undef cp_bls_ver_batch
 #undef cp_bbs_gen
 #undef cp_bbs_sig
 #undef cp_bbs_ver
@@ -2902,7 +3101,9 @@
 #define cp_rsa_gen 	RLC_PREFIX(cp_rsa_gen)
 #define cp_rsa_enc 	RLC_PREFIX(cp_rsa_enc)
 #define cp_rsa_dec 	RLC_PREFIX(cp_rsa_dec)
+#define cp_rsa_dec_many 	RLC_PREFIX(cp_rsa_dec_many)
 #define cp_rsa_sig 	RLC_PREFIX(cp_rsa_sig)
+#define cp_rsa_sig_many 	RLC_PREFIX(cp_rsa_sig_many)
 #define cp_rsa_ver 	RLC_PREFIX(cp_rsa_ver)
 #define cp_rabin_gen 	RLC_PREFIX(cp_rabin_gen)
 #define cp_rabin_enc 	RLC_PREFIX(cp_rabin_enc)
@@ -2912,6 +3113,8 @@
 #define cp_bdpe_dec 	RLC_PREFIX(cp_bdpe_dec)
 #define cp_phpe_gen 	RLC_PREFIX(cp_phpe_gen)
 #define cp_phpe_enc 	RLC_PREFIX(cp_phpe_enc)
+#define cp_phpe_ctx 	RLC_PREFIX(cp_phpe_ctx)
+#define cp_phpe_enc_ctx 	RLC_PREFIX(cp_phpe_enc_ctx)
 #define cp_phpe_add 	RLC_PREFIX(cp_phpe_add)
 #define cp_phpe_dec 	RLC_PREFIX(cp_phpe_dec)
 #define cp_shpe_gen 	RLC_PREFIX(cp_shpe_gen)
@@ -2920,6 +3123,8 @@
 #define cp_shpe_dec 	RLC_PREFIX(cp_shpe_dec)
 #define cp_ghpe_gen 	RLC_PREFIX(cp_ghpe_gen)
 #define cp_ghpe_enc 	RLC_PREFIX(cp_ghpe_enc)
+#define cp_ghpe_ctx 	RLC_PREFIX(cp_ghpe_ctx)
+#define cp_ghpe_enc_ctx 	RLC_PREFIX(cp_ghpe_enc_ctx)
 #define cp_ghpe_dec 	RLC_PREFIX(cp_ghpe_dec)
 #define cp_ecdh_gen 	RLC_PREFIX(cp_ecdh_gen)
 #define cp_ecdh_key 	RLC_PREFIX(cp_ecdh_key)
@@ -2931,9 +3136,14 @@
 #define cp_ecdsa_gen 	RLC_PREFIX(cp_ecdsa_gen)
 #define cp_ecdsa_sig 	RLC_PREFIX(cp_ecdsa_sig)
 #define cp_ecdsa_ver 	RLC_PREFIX(cp_ecdsa_ver)
+#define cp_ecdsa_ver_batch 	RLC_PREFIX(cp_ecdsa_ver_batch)
 #define cp_ecss_gen 	RLC_PREFIX(cp_ecss_gen)
 #define cp_ecss_sig 	RLC_PREFIX(cp_ecss_sig)
 #define cp_ecss_ver 	RLC_PREFIX(cp_ecss_ver)
+#define cp_eddsa_gen 	RLC_PREFIX(cp_eddsa_gen)
+#define cp_eddsa_sig 	RLC_PREFIX(cp_eddsa_sig)
+#define cp_eddsa_ver 	RLC_PREFIX(cp_eddsa_ver)
+#define cp_eddsa_ver_batch 	RLC_PREFIX(cp_eddsa_ver_batch)
 #define cp_pdpub_gen 	RLC_PREFIX(cp_pdpub_gen)
 #define cp_pdpub_ask 	RLC_PREFIX(cp_pdpub_ask)
 #define cp_pdpub_ans 	RLC_PREFIX(cp_pdpub_ans)
@@ -2968,6 +3178,10 @@
 #define cp_bls_gen 	RLC_PREFIX(cp_bls_gen)
 #define cp_bls_sig 	RLC_PREFIX(cp_bls_sig)
 #define cp_bls_ver 	RLC_PREFIX(cp_bls_ver)
+#define cp_bls_agg_sig 	RLC_PREFIX(cp_bls_agg_sig)
+#define cp_bls_agg_ver 	RLC_PREFIX(cp_bls_agg_ver)
+#define cp_bls_fast_ver 	RLC_PREFIX(cp_bls_fast_ver)
+#define cp_bls_ver_batch 	RLC_PREFIX(cp_bls_ver_batch)
 #define cp_bbs_gen 	RLC_PREFIX(cp_bbs_gen)
 #define cp_bbs_sig 	RLC_PREFIX(cp_bbs_sig)
 #define cp_bbs_ver 	RLC_PREFIX(cp_bbs_ver)
@@ -3050,7 +3264,9 @@
 #define cp_pbpsi_int 	RLC_PREFIX(cp_pbpsi_int)
 
 #undef md_map_sh224
+#undef md_sh256_set
 #undef md_map_sh256
+#undef md_map_sh256_many
 #undef md_map_sh384
 #undef md_map_sh512
 #undef md_map_b2s160
@@ -3060,11 +3276,14 @@
 #undef md_hmac
 #undef md_xmd_sh224
 #undef md_xmd_sh256
+#undef md_xmd_sh256_many
 #undef md_xmd_sh384
 #undef md_xmd_sh512
 
 #define md_map_sh224 	RLC_PREFIX(md_map_sh224)
+#define md_sh256_set 	RLC_PREFIX(md_sh256_set)
 #define md_map_sh256 	RLC_PREFIX(md_map_sh256)
+#define md_map_sh256_many 	RLC_PREFIX(md_map_sh256_many)
 #define md_map_sh384 	RLC_PREFIX(md_map_sh384)
 #define md_map_sh512 	RLC_PREFIX(md_map_sh512)
 #define md_map_b2s160 	RLC_PREFIX(md_map_b2s160)
@@ -3074,6 +3293,7 @@
 #define md_hmac 	RLC_PREFIX(md_hmac)
 #define md_xmd_sh224 	RLC_PREFIX(md_xmd_sh224)
 #define md_xmd_sh256 	RLC_PREFIX(md_xmd_sh256)
+#define md_xmd_sh256_many 	RLC_PREFIX(md_xmd_sh256_many)
 #define md_xmd_sh384 	RLC_PREFIX(md_xmd_sh384)
 #define md_xmd_sh512 	RLC_PREFIX(md_xmd_sh512)
 
@@ -59,6 +59,22 @@ enum {
 	RLC_MD_LEN_B2S256 = 32
 };
 
+/**
+ * Implementations of SHA-256 that can be enabled with md_sh256_set().
+ */
+enum {
+	/** Single stream with the SHA extensions on x86-64. */
+	RLC_MD_SH256_NI = 1,
+	/** Eight lanes with AVX2 on x86-64. */
+	RLC_MD_SH256_AVX2 = 2,
+	/** Sixteen lanes with AVX-512 on x86-64. */
+	RLC_MD_SH256_AVX512 = 4,
+	/** Four lanes with SSE2 on x86-64. */
+	RLC_MD_SH256_SSE2 = 8,
+	/** All the implementations. */
+	RLC_MD_SH256_ALL = 15
+};
+
 /**
  * Length in bytes of default hash function output.
  */
@@ -136,6 +152,17 @@ enum {
  */
 void md_map_sh224(uint8_t *hash, const uint8_t *msg, int len);
 
+/**
+ * Restricts the implementations used by the SHA-256 functions, so that each
+ * one can be tested. The portable implementation is always available. Must
+ * not be called while other threads are hashing.
+ *
+ * @param[in] mask				- the implementations to enable, a combination
+ * 								  of the RLC_MD_SH256_* flags.
+ * @return the enabled implementations supported by the processor.
+ */
+int md_sh256_set(int mask);
+
 /**
  * Computes the SHA-256 hash function.
  *
@@ -145,6 +172,20 @@ void md_map_sh224(uint8_t *hash, const uint8_t *msg, int len);
  */
 void md_map_sh256(uint8_t *hash, const uint8_t *msg, int len);
 
+/**
+ * Computes the SHA-256 hash function of several messages at once. On x86-64,
+ * groups of messages are processed in parallel in the lanes of AVX-512 or AVX2
+ * registers when available, and the remaining messages with the SHA
+ * extensions or the portable implementation.
+ *
+ * @param[out] out				- the digests.
+ * @param[in] in				- the messages to hash.
+ * @param[in] len				- the message lengths in bytes.
+ * @param[in] n					- the number of messages.
+ */
+void md_map_sh256_many(uint8_t *out[], const uint8_t *in[], const int len[],
+		int n);
+
 /**
  * Computes the SHA-384 hash function.
  *
@@ -243,6 +284,22 @@ void md_xmd_sh224(uint8_t *buf, int buf_len, const uint8_t *in, int in_len,
 void md_xmd_sh256(uint8_t *buf, int buf_len, const uint8_t *in, int in_len,
 		const uint8_t *dst, int dst_len);
 
+/**
+ * Map several byte vectors and a common domain separation tag to
+ * arbitrary-length pseudorandom outputs using the SHA-256 hash function,
+ * hashing the messages in parallel with md_map_sh256_many().
+ *
+ * @param[out] buf					- the output buffers.
+ * @param[in] buf_len				- the requested size of each output.
+ * @param[in] in					- the messages to hash.
+ * @param[in] in_len				- the message lengths in bytes.
+ * @param[in] n						- the number of messages.
+ * @param[in] dst					- the domain separation tag.
+ * @param[in] dst_len				- the domain separation tag length in bytes.
+ */
+void md_xmd_sh256_many(uint8_t *buf[], int buf_len, const uint8_t *in[],
+		const int in_len[], int n, const uint8_t *dst, int dst_len);
+
 /**
  * Map a byte vector and optional domain separation tag to an arbitrary-length
  * pseudorandom output using the SHA-384 hash function.
@@ -118,7 +118,7 @@ typedef pt_st *pt_t;
  */
 #if ALLOC == DYNAMIC
 #define mt_new(A)															\
-	A = (mt_t)calloc(1, sizeof(mt_st));										\
+	A = (mt_t)alloc_calloc(1, sizeof(mt_st));								\
 	if ((A) == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -148,7 +148,7 @@ typedef pt_st *pt_t;
 		bn_free((A)->a);													\
 		bn_free((A)->b);													\
 		bn_free((A)->c);													\
-		free(A);															\
+		alloc_free(A);														\
 		A = NULL;															\
 	}
 
@@ -175,7 +175,7 @@ typedef pt_st *pt_t;
  */
 #if ALLOC == DYNAMIC
 #define pt_new(A)															\
-	A = (pt_t)calloc(1, sizeof(pt_st));										\
+	A = (pt_t)alloc_calloc(1, sizeof(pt_st));								\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -199,7 +199,7 @@ typedef pt_st *pt_t;
 		g1_free((A)->a);													\
 		g2_free((A)->b);													\
 		gt_free((A)->c);													\
-		free(A);															\
+		alloc_free(A);														\
 		A = NULL;															\
 	}
 
@@ -78,8 +78,13 @@ extern rlc_thread ctx_t first_ctx;
  */
 extern rlc_thread ctx_t *core_ctx;
 
+/**
+ * Pointer to active parameter set, only visible inside the library.
+ */
+extern rlc_thread ctx_t *core_par;
+
 #if !defined(_MSC_VER)
-#pragma omp threadprivate(first_ctx, core_ctx)
+#pragma omp threadprivate(first_ctx, core_ctx, core_par)
 #endif
 #endif
 
@@ -72,6 +72,12 @@
 #define RLC_GT_LOWER			fp12_
 #endif
 
+#if FP_PRIME == 315 || FP_PRIME == 317 || FP_PRIME == 509
+#define RLC_LN_LOWER			fp4_
+#else
+#define RLC_LN_LOWER			fp2_
+#endif
+
 #define RLC_PC_LOWER			pp_
 
 #else
@@ -99,6 +105,17 @@
  */
 #define RLC_G2_TABLE			RLC_CAT(RLC_CAT(RLC_, RLC_G2_UPPER), _TABLE)
 
+#if FP_PRIME < 1536
+/**
+ * Represents the number of line coefficients precomputed for a G_2 element.
+ */
+#if FP_PRIME == 315 || FP_PRIME == 317 || FP_PRIME == 509
+#define RLC_PC_TABLE			RLC_PP_TABLE_K24
+#else
+#define RLC_PC_TABLE			RLC_PP_TABLE_K12
+#endif
+#endif
+
 /*============================================================================*/
 /* Type definitions                                                           */
 /*============================================================================*/
@@ -128,6 +145,13 @@ typedef RLC_CAT(RLC_G2_LOWER, st) g2_st;
  */
 typedef RLC_CAT(RLC_GT_LOWER, t) gt_t;
 
+#if FP_PRIME < 1536
+/**
+ * Represents a line coefficient precomputed for a G_2 element.
+ */
+typedef RLC_CAT(RLC_LN_LOWER, t) ln_t;
+#endif
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -153,6 +177,13 @@ typedef RLC_CAT(RLC_GT_LOWER, t) gt_t;
  */
 #define gt_null(A)			RLC_CAT(RLC_GT_LOWER, null)(A)
 
+/**
+ * Initializes a precomputed line coefficient with a null value.
+ *
+ * @param[out] A			- the coefficient to initialize.
+ */
+#define ln_null(A)			RLC_CAT(RLC_LN_LOWER, null)(A)
+
 /**
  * Calls a function to allocate a G_1 element.
  *
@@ -177,6 +208,14 @@ typedef RLC_CAT(RLC_GT_LOWER, t) gt_t;
  */
 #define gt_new(A)			RLC_CAT(RLC_GT_LOWER, new)(A)
 
+/**
+ * Calls a function to allocate a precomputed line coefficient.
+ *
+ * @param[out] A			- the new coefficient.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ */
+#define ln_new(A)			RLC_CAT(RLC_LN_LOWER, new)(A)
+
 /**
  * Calls a function to clean and free a G_1 element.
  *
@@ -198,6 +237,13 @@ typedef RLC_CAT(RLC_GT_LOWER, t) gt_t;
  */
 #define gt_free(A)			RLC_CAT(RLC_GT_LOWER, free)(A)
 
+/**
+ * Calls a function to clean and free a precomputed line coefficient.
+ *
+ * @param[out] A			- the coefficient to clean and free.
+ */
+#define ln_free(A)			RLC_CAT(RLC_LN_LOWER, free)(A)
+
 
 
 /**
@@ -883,6 +929,42 @@ typedef RLC_CAT(RLC_GT_LOWER, t) gt_t;
 #define pc_map_sim(R, P, Q, M);	RLC_CAT(RLC_PC_LOWER, map_sim_k2)(R, P, Q, M)
 #endif
 
+/**
+ * Precomputes the lines of the optimal ate pairing for a fixed G_2 element.
+ * Only available for asymmetric pairings.
+ *
+ * @param[out] T			- the table of RLC_PC_TABLE line coefficients.
+ * @param[in] Q				- the G_2 element to fix.
+ */
+#if FP_PRIME < 1536
+
+#if FP_PRIME == 315 || FP_PRIME == 317 || FP_PRIME == 509
+#define pc_map_pre(T, Q);		RLC_CAT(RLC_PC_LOWER, map_pre_k24)(T, Q)
+#else
+#define pc_map_pre(T, Q);		RLC_CAT(RLC_PC_LOWER, map_pre_k12)(T, Q)
+#endif
+
+#endif
+
+/**
+ * Computes the optimal ate pairing of a G_1 element and a fixed G_2 element
+ * with precomputed lines. Computes R = e(P, Q), where T was computed by
+ * pc_map_pre() from Q. Only available for asymmetric pairings.
+ *
+ * @param[out] R			- the result.
+ * @param[in] P				- the first element.
+ * @param[in] T				- the precomputed lines of the second element.
+ */
+#if FP_PRIME < 1536
+
+#if FP_PRIME == 315 || FP_PRIME == 317 || FP_PRIME == 509
+#define pc_map_fix(R, P, T);	RLC_CAT(RLC_PC_LOWER, map_k24_pre)(R, P, T)
+#else
+#define pc_map_fix(R, P, T);	RLC_CAT(RLC_PC_LOWER, map_oatep_k12_pre)(R, P, T)
+#endif
+
+#endif
+
 /**
  * Computes the final exponentiation of the pairing.
  *
@@ -992,6 +1074,18 @@ void gt_exp_dig(gt_t c, gt_t a, dig_t b);
  */
 void gt_exp_sim(gt_t e, gt_t a, bn_t b, gt_t c, bn_t d);
 
+/**
+ * Exponentiates many elements from G_T by integers simultaneously using the
+ * bucket method. Computes r = \Prod_i=0..n a_i^k_i, with the exponents
+ * reduced modulo the group order.
+ *
+ * @param[out] r			- the result.
+ * @param[in] a				- the elements to exponentiate.
+ * @param[in] k				- the integer exponents.
+ * @param[in] n				- the number of elements to exponentiate.
+ */
+void gt_exp_sim_lot(gt_t r, gt_t a[], bn_t k[], int n);
+
 /**
  * Exponentiates a generator from G_T by an integer. Computes c = a^b.
  *
@@ -1021,6 +1115,33 @@ int g1_is_valid(g1_t a);
  */
 int g2_is_valid(g2_t a);
 
+/**
+ * Decompresses many elements from G_1, optionally checking their order. The
+ * square roots are extracted together and the checks stop at the first
+ * invalid element.
+ *
+ * @param[out] r			- the results.
+ * @param[in] p				- the elements to decompress.
+ * @param[in] n				- the number of elements.
+ * @param[in] check			- the flag to also check the order of the results.
+ * @return 1 if all elements are valid, 0 otherwise.
+ */
+int g1_upk_many(g1_t *r, const g1_t *p, int n, int check);
+
+/**
+ * Decompresses many elements from G_2, optionally checking their order. The
+ * square roots are extracted together and the checks stop at the first
+ * invalid element.
+ *
+ * @param[out] r			- the results.
+ * @param[in] p				- the elements to decompress.
+ * @param[in] n				- the number of elements.
+ * @param[in] check			- the flag to also check the order of the results.
+ * @return 1 if all elements are valid, 0 otherwise.
+ * @throw ERR_NO_CONFIG		- if G_2 is defined over a quartic extension.
+ */
+int g2_upk_many(g2_t *r, const g2_t *p, int n, int check);
+
 /**
  * Checks if an element form G_T is valid (has the right order).
  *
@@ -41,6 +41,54 @@
 #include "relic_epx.h"
 #include "relic_types.h"
 
+/*============================================================================*/
+/* Constant definitions                                                       */
+/*============================================================================*/
+
+/**
+ * Bound on the number of bits of the Miller loop parameter, for pairings with
+ * embedding degree K over a prime field.
+ */
+#define RLC_PP_LOOP(K)			(RLC_FP_BITS / ((K) / 3) + 4)
+
+/**
+ * Number of coefficients of the precomputed lines of a G_2 element, for
+ * pairings with embedding degree K. Each line takes three coefficients and
+ * there is at most one doubling and half an addition for each bit of the
+ * loop parameter, plus the final lines.
+ */
+#define RLC_PP_TABLE(K)			(3 * (3 * RLC_PP_LOOP(K) / 2 + 4))
+
+/**
+ * Number of coefficients of precomputed lines for pairings with embedding
+ * degree 12.
+ */
+#define RLC_PP_TABLE_K12		RLC_PP_TABLE(12)
+
+/**
+ * Number of coefficients of precomputed lines for pairings with embedding
+ * degree 24.
+ */
+#define RLC_PP_TABLE_K24		RLC_PP_TABLE(24)
+
+/**
+ * Number of coefficients of precomputed lines for pairings with embedding
+ * degree 48.
+ */
+#define RLC_PP_TABLE_K48		RLC_PP_TABLE(48)
+
+/**
+ * Minimum number of pairs for which multi-pairings keep the points of the
+ * Miller loop in affine coordinates.
+ */
+#define RLC_PP_AFF_MIN			128
+
+/**
+ * Maximum number of final exponentiations computed together when sharing
+ * inversions among them.
+ */
+#define RLC_PP_EXP_BLK			16
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -805,6 +853,16 @@ void pp_exp_k8(fp8_t c, fp8_t a);
  */
 void pp_exp_k12(fp12_t c, fp12_t a);
 
+/**
+ * Computes the final exponentiation of multiple pairings defined over curves
+ * of embedding degree 12, sharing the inversions among them.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the extension field elements to exponentiate.
+ * @param[in] n				- the number of elements.
+ */
+void pp_exp_k12_many(fp12_t *c, fp12_t *a, int n);
+
 /**
  * Computes the final exponentiation for a pairing defined over curves of
  * embedding degree 24. Computes c = a^(p^24 - 1)/r.
@@ -814,6 +872,16 @@ void pp_exp_k12(fp12_t c, fp12_t a);
  */
 void pp_exp_k24(fp24_t c, fp24_t a);
 
+/**
+ * Computes the final exponentiation of multiple pairings defined over curves
+ * of embedding degree 24, sharing the inversions among them.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the extension field elements to exponentiate.
+ * @param[in] n				- the number of elements.
+ */
+void pp_exp_k24_many(fp24_t *c, fp24_t *a, int n);
+
 /**
  * Computes the final exponentiation for a pairing defined over curves of
  * embedding degree 48. Computes c = a^(p^48 - 1)/r.
@@ -823,6 +891,16 @@ void pp_exp_k24(fp24_t c, fp24_t a);
  */
 void pp_exp_k48(fp48_t c, fp48_t a);
 
+/**
+ * Computes the final exponentiation of multiple pairings defined over curves
+ * of embedding degree 48, sharing the inversions among them.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the extension field elements to exponentiate.
+ * @param[in] n				- the number of elements.
+ */
+void pp_exp_k48_many(fp48_t *c, fp48_t *a, int n);
+
 /**
  * Computes the final exponentiation for a pairing defined over curves of
  * embedding degree 54. Computes c = a^(p^54 - 1)/r.
@@ -983,6 +1061,53 @@ void pp_map_oatep_k12(fp12_t r, ep_t p, ep2_t q);
  */
 void pp_map_sim_oatep_k12(fp12_t r, ep_t *p, ep2_t *q, int m);
 
+/**
+ * Computes the optimal ate multi-pairing in a parameterized elliptic curve
+ * with embedding degree 12, keeping the points of the Miller loop in affine
+ * coordinates. The inversions of each step are shared among all pairs, so
+ * this is faster for a large number of pairings. Pairs with a point at
+ * infinity are skipped. The second arguments must lie in G_2, otherwise a
+ * slope denominator may vanish and ERR_NO_VALID is raised.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments.
+ * @param[in] q				- the second pairing arguments.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+void pp_map_sim_oatep_k12_aff(fp12_t r, ep_t *p, ep2_t *q, int m);
+
+/**
+ * Precomputes the lines of the optimal ate pairing in a parameterized elliptic
+ * curve with embedding degree 12, for a fixed point in G_2. The lines depend
+ * only on the point, so they can be reused for any point in G_1.
+ *
+ * @param[out] t			- the table of RLC_PP_TABLE_K12 line coefficients.
+ * @param[in] q				- the elliptic curve point to fix.
+ */
+void pp_map_pre_k12(fp2_t *t, ep2_t q);
+
+/**
+ * Computes the optimal ate pairing of two points in a parameterized elliptic
+ * curve with embedding degree 12, using precomputed lines for the point
+ * in G_2.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first elliptic curve point.
+ * @param[in] t				- the precomputed lines of the second point.
+ */
+void pp_map_oatep_k12_pre(fp12_t r, ep_t p, fp2_t *t);
+
+/**
+ * Computes the optimal ate multi-pairing in a parameterized elliptic curve
+ * with embedding degree 12, using precomputed lines for the points in G_2.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments.
+ * @param[in] t				- the precomputed lines of the second arguments.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+void pp_map_sim_oatep_k12_pre(fp12_t r, ep_t *p, fp2_t **t, int m);
+
 /**
  * Computes the Optimal Ate pairing of two points in a parameterized elliptic
  * curve with embedding degree 24.
@@ -1004,6 +1129,37 @@ void pp_map_k24(fp24_t r, ep_t p, ep4_t q);
  */
 void pp_map_sim_k24(fp24_t r, ep_t *p, ep4_t *q, int m);
 
+/**
+ * Precomputes the lines of the optimal ate pairing in a parameterized elliptic
+ * curve with embedding degree 24, for a fixed point in G_2.
+ *
+ * @param[out] t			- the table of RLC_PP_TABLE_K24 line coefficients.
+ * @param[in] q				- the elliptic curve point to fix.
+ */
+void pp_map_pre_k24(fp4_t *t, ep4_t q);
+
+/**
+ * Computes the optimal ate pairing of two points in a parameterized elliptic
+ * curve with embedding degree 24, using precomputed lines for the point
+ * in G_2.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first elliptic curve point.
+ * @param[in] t				- the precomputed lines of the second point.
+ */
+void pp_map_k24_pre(fp24_t r, ep_t p, fp4_t *t);
+
+/**
+ * Computes the optimal ate multi-pairing in a parameterized elliptic curve
+ * with embedding degree 24, using precomputed lines for the points in G_2.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments.
+ * @param[in] t				- the precomputed lines of the second arguments.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+void pp_map_sim_k24_pre(fp24_t r, ep_t *p, fp4_t **t, int m);
+
 /**
  * Computes the Optimal Ate pairing of two points in a parameterized elliptic
  * curve with embedding degree 48.
@@ -1014,6 +1170,38 @@ void pp_map_sim_k24(fp24_t r, ep_t *p, ep4_t *q, int m);
  */
 void pp_map_k48(fp48_t r, ep_t p, fp8_t qx, fp8_t qy);
 
+/**
+ * Precomputes the lines of the optimal ate pairing in a parameterized elliptic
+ * curve with embedding degree 48, for a fixed point in G_2.
+ *
+ * @param[out] t			- the table of RLC_PP_TABLE_K48 line coefficients.
+ * @param[in] qx			- the x-coordinate of the point to fix.
+ * @param[in] qy			- the y-coordinate of the point to fix.
+ */
+void pp_map_pre_k48(fp8_t *t, fp8_t qx, fp8_t qy);
+
+/**
+ * Computes the optimal ate pairing of two points in a parameterized elliptic
+ * curve with embedding degree 48, using precomputed lines for the point
+ * in G_2.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first elliptic curve point.
+ * @param[in] t				- the precomputed lines of the second point.
+ */
+void pp_map_k48_pre(fp48_t r, ep_t p, fp8_t *t);
+
+/**
+ * Computes the optimal ate multi-pairing in a parameterized elliptic curve
+ * with embedding degree 48, using precomputed lines for the points in G_2.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments.
+ * @param[in] t				- the precomputed lines of the second arguments.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+void pp_map_sim_k48_pre(fp48_t r, ep_t *p, fp8_t **t, int m);
+
 /**
  * Computes the Optimal Ate pairing of two points in a parameterized elliptic
  * curve with embedding degree 54.
@@ -32,6 +32,7 @@
 #ifndef RLC_TYPES_H
 #define RLC_TYPES_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "relic_conf.h"
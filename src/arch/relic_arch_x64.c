@@ -47,17 +47,17 @@
 /*============================================================================*/
 
 void arch_init(void) {
-	ctx_t *ctx = core_get();
+	ctx_t *ctx = core_state();
 	if (ctx != NULL) {
-		core_get()->lzcnt_ptr =
+		core_state()->lzcnt_ptr =
 			(has_lzcnt_hard() ? lzcnt64_hard : lzcnt64_soft);
 	}
 }
 
 void arch_clean(void) {
-	ctx_t *ctx = core_get();
+	ctx_t *ctx = core_state();
 	if (ctx != NULL) {
-		core_get()->lzcnt_ptr = NULL;
+		core_state()->lzcnt_ptr = NULL;
 	}
 }
 
@@ -80,18 +80,18 @@ ull_t arch_cycles(void) {
 ull_t arch_cycles(void) {
 	unsigned int seq;
 	ull_t index, offset, result = 0;
-	if (core_get()->perf_buf != NULL) {
+	if (core_state()->perf_buf != NULL) {
 		do {
-			seq = core_get()->perf_buf->lock;
+			seq = core_state()->perf_buf->lock;
 			asm("" ::: "memory");
-			index = core_get()->perf_buf->index;
-			offset = core_get()->perf_buf->offset;
+			index = core_state()->perf_buf->index;
+			offset = core_state()->perf_buf->offset;
 			asm(
 				"rdpmc; shlq $32, %%rdx; orq %%rdx,%%rax"
 				: "=a" (result) : "c" (index - 1) : "%rdx"
 			);
 			asm("" ::: "memory");
-		} while (core_get()->perf_buf->lock != seq);
+		} while (core_state()->perf_buf->lock != seq);
 
 		result += offset;
 		result &= RLC_MASK(48); /* Get lower 48 bits only. */
@@ -101,5 +101,5 @@ ull_t arch_cycles(void) {
 #endif
 
 unsigned int arch_lzcnt(dig_t x) {
-	return core_get()->lzcnt_ptr((ull_t)x) - (8 * sizeof(ull_t) - WSIZE);
+	return core_state()->lzcnt_ptr((ull_t)x) - (8 * sizeof(ull_t) - WSIZE);
 }
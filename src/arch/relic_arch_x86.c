@@ -42,11 +42,11 @@
 /*============================================================================*/
 
 void arch_init(void) {
-	core_get()->lzcnt_ptr = (has_lzcnt_hard() ? lzcnt32_hard : lzcnt32_soft);
+	core_state()->lzcnt_ptr = (has_lzcnt_hard() ? lzcnt32_hard : lzcnt32_soft);
 }
 
 void arch_clean(void) {
-	core_get()->lzcnt_ptr = NULL;
+	core_state()->lzcnt_ptr = NULL;
 }
 
 ull_t arch_cycles(void) {
@@ -62,5 +62,5 @@ ull_t arch_cycles(void) {
 }
 
 unsigned int arch_lzcnt(dig_t x) {
-	return core_get()->lzcnt_ptr((uint32_t)x) - (8 * sizeof(uint32_t) - WSIZE);
+	return core_state()->lzcnt_ptr((uint32_t)x) - (8 * sizeof(uint32_t) - WSIZE);
 }
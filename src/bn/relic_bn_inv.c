@@ -66,7 +66,7 @@ void bn_mod_inv(bn_t c, const bn_t a, const bn_t b) {
 
 void bn_mod_inv_sim(bn_t *c, const bn_t *a, const bn_t b, int n) {
 	int i;
-	bn_t u, *t = RLC_ALLOCA(bn_t, n);
+	bn_t u, *t = RLC_MALLOC(bn_t, n);
 
 	bn_null(u);
 
@@ -103,10 +103,10 @@ void bn_mod_inv_sim(bn_t *c, const bn_t *a, const bn_t b, int n) {
 		RLC_THROW(ERR_CAUGHT);
 	}
 	RLC_FINALLY {
-		for (i = 0; i < n; i++) {
+		for (i = 0; t != NULL && i < n; i++) {
 			bn_free(t[i]);
 		}
 		bn_free(u);
-		RLC_FREE(t);
+		alloc_free((void *)t);
 	}
 }
@@ -32,6 +32,335 @@
 #include "relic_core.h"
 #include "relic_bn.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Number of coefficients below which polynomials are multiplied by the
+ * schoolbook method instead of Karatsuba.
+ */
+#define POLY_KARAT		16
+
+/**
+ * Number of points below which a remainder is evaluated by Horner's rule.
+ */
+#define POLY_HORNER		16
+
+/**
+ * Number of temporary integers needed by the polynomial routines on inputs
+ * with at most N coefficients.
+ */
+#define POLY_TMP(N)		(16 * (N) + 64)
+
+/**
+ * Adds two integers reduced modulo another.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first integer to add.
+ * @param[in] b				- the second integer to add.
+ * @param[in] m				- the modulus.
+ */
+static void poly_add(bn_t c, const bn_t a, const bn_t b, const bn_t m) {
+	bn_add(c, a, b);
+	if (bn_cmp(c, m) != RLC_LT) {
+		bn_sub(c, c, m);
+	}
+}
+
+/**
+ * Subtracts two integers reduced modulo another.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the integer to subtract from.
+ * @param[in] b				- the integer to subtract.
+ * @param[in] m				- the modulus.
+ */
+static void poly_sub(bn_t c, const bn_t a, const bn_t b, const bn_t m) {
+	bn_sub(c, a, b);
+	if (bn_sign(c) == RLC_NEG) {
+		bn_add(c, c, m);
+	}
+}
+
+/**
+ * Multiplies two polynomials with coefficients reduced modulo an integer,
+ * using Karatsuba's method for the larger operands. The result has
+ * na + nb - 1 coefficients and must not overlap the operands.
+ *
+ * @param[out] c			- the coefficients of the result.
+ * @param[in] a				- the coefficients of the first polynomial.
+ * @param[in] na			- the number of coefficients of the first polynomial.
+ * @param[in] b				- the coefficients of the second polynomial.
+ * @param[in] nb			- the number of coefficients of the second polynomial.
+ * @param[in] m				- the modulus.
+ * @param[in] t				- the temporary integers.
+ */
+static void poly_mul(bn_t *c, const bn_t *a, int na, const bn_t *b, int nb,
+		const bn_t m, bn_t *t) {
+	const bn_t *u;
+	int i, j, h, l;
+
+	if (na < nb) {
+		u = a;
+		a = b;
+		b = u;
+		i = na;
+		na = nb;
+		nb = i;
+	}
+	h = (na + 1) / 2;
+
+	if (nb < POLY_KARAT) {
+		/* Accumulate the products and reduce each coefficient once. */
+		for (i = 0; i < na + nb - 1; i++) {
+			bn_zero(t[0]);
+			for (j = RLC_MAX(0, i - nb + 1); j <= RLC_MIN(i, na - 1); j++) {
+				bn_mul(t[1], a[j], b[i - j]);
+				bn_add(t[0], t[0], t[1]);
+			}
+			bn_mod(c[i], t[0], m);
+		}
+		return;
+	}
+
+	if (nb <= h) {
+		/* Split the longer operand in pieces as long as the shorter one. */
+		for (i = 0; i < na + nb - 1; i++) {
+			bn_zero(c[i]);
+		}
+		for (i = 0; i < na; i += nb) {
+			l = RLC_MIN(nb, na - i);
+			poly_mul(t, a + i, l, b, nb, m, t + 2 * nb - 1);
+			for (j = 0; j < l + nb - 1; j++) {
+				poly_add(c[i + j], c[i + j], t[j], m);
+			}
+		}
+		return;
+	}
+
+	/* c = a0 * b0 + x^h * ((a0 + a1)(b0 + b1) - a0 * b0 - a1 * b1) + x^2h a1 * b1. */
+	poly_mul(c, a, h, b, h, m, t);
+	bn_zero(c[2 * h - 1]);
+	poly_mul(c + 2 * h, a + h, na - h, b + h, nb - h, m, t);
+	for (i = 0; i < h; i++) {
+		bn_copy(t[i], a[i]);
+		if (i < na - h) {
+			poly_add(t[i], t[i], a[h + i], m);
+		}
+		bn_copy(t[h + i], b[i]);
+		if (i < nb - h) {
+			poly_add(t[h + i], t[h + i], b[h + i], m);
+		}
+	}
+	poly_mul(t + 2 * h, t, h, t + h, h, m, t + 4 * h - 1);
+	for (i = 0; i < 2 * h - 1; i++) {
+		poly_sub(t[2 * h + i], t[2 * h + i], c[i], m);
+		if (i < na + nb - 2 * h - 1) {
+			poly_sub(t[2 * h + i], t[2 * h + i], c[2 * h + i], m);
+		}
+	}
+	for (i = 0; i < 2 * h - 1; i++) {
+		poly_add(c[h + i], c[h + i], t[2 * h + i], m);
+	}
+}
+
+/**
+ * Computes the inverse of a power series with unit constant term modulo x^k,
+ * using Newton iteration.
+ *
+ * @param[out] g			- the k coefficients of the inverse.
+ * @param[in] f				- the coefficients of the power series.
+ * @param[in] nf			- the number of coefficients of the power series.
+ * @param[in] k				- the precision.
+ * @param[in] m				- the modulus.
+ * @param[in] t				- the temporary integers.
+ */
+static void poly_inv(bn_t *g, const bn_t *f, int nf, int k, const bn_t m,
+		bn_t *t) {
+	int i, l, n, p;
+
+	bn_set_dig(g[0], 1);
+	for (l = 1; l < k; l = n) {
+		n = RLC_MIN(2 * l, k);
+		/* Since f * g = 1 mod x^l, only the coefficients l..n-1 matter. */
+		p = RLC_MIN(nf, n);
+		poly_mul(t, f, p, g, l, m, t + n + l);
+		for (i = p + l - 1; i < n; i++) {
+			bn_zero(t[i]);
+		}
+		poly_mul(t + n + l, g, RLC_MIN(l, n - l), t + l, n - l, m,
+				t + 2 * n + l);
+		for (i = 0; i < n - l; i++) {
+			bn_sub(g[l + i], m, t[n + l + i]);
+			bn_mod(g[l + i], g[l + i], m);
+		}
+	}
+}
+
+/**
+ * Reduces a polynomial modulo a monic polynomial, using the reversed
+ * polynomials to replace the division by a power series inversion.
+ *
+ * @param[out] r			- the d coefficients of the remainder.
+ * @param[in] a				- the coefficients of the dividend.
+ * @param[in] na			- the number of coefficients of the dividend.
+ * @param[in] b				- the d coefficients of the divisor, except the leading one.
+ * @param[in] d				- the degree of the divisor.
+ * @param[in] m				- the modulus.
+ * @param[in] t				- the temporary integers.
+ */
+static void poly_rem(bn_t *r, const bn_t *a, int na, const bn_t *b, int d,
+		const bn_t m, bn_t *t) {
+	int i, nq = na - d, nb = RLC_MIN(d + 1, nq);
+	bn_t *rb = t, *inv = rb + nb, *ra = inv + nq, *q = ra + nq;
+
+	if (na <= d) {
+		for (i = 0; i < d; i++) {
+			if (i < na) {
+				bn_copy(r[i], a[i]);
+			} else {
+				bn_zero(r[i]);
+			}
+		}
+		return;
+	}
+
+	/* rev(a) / rev(b) mod x^nq is the reversed quotient. */
+	bn_set_dig(rb[0], 1);
+	for (i = 1; i < nb; i++) {
+		bn_copy(rb[i], b[d - i]);
+	}
+	poly_inv(inv, rb, nb, nq, m, q);
+	for (i = 0; i < nq; i++) {
+		bn_copy(ra[i], a[na - 1 - i]);
+	}
+	poly_mul(q, ra, nq, inv, nq, m, q + 2 * nq - 1);
+	for (i = 0; i < nq / 2; i++) {
+		bn_copy(ra[0], q[i]);
+		bn_copy(q[i], q[nq - 1 - i]);
+		bn_copy(q[nq - 1 - i], ra[0]);
+	}
+
+	/* Only the low coefficients of b * q contribute to the remainder. */
+	poly_mul(q + nq, b, d, q, nq, m, q + d + 2 * nq - 1);
+	for (i = 0; i < d; i++) {
+		poly_sub(r[i], a[i], q[nq + i], m);
+	}
+}
+
+/**
+ * Computes a level of the subproduct tree of a set of points. Each node is a
+ * monic polynomial stored without its leading coefficient, in the positions
+ * of the points it covers.
+ *
+ * @param[out] c			- the nodes at the level.
+ * @param[in] a				- the nodes at the level below.
+ * @param[in] n				- the number of points.
+ * @param[in] w				- the number of points covered by each node.
+ * @param[in] m				- the modulus.
+ * @param[in] t				- the temporary integers.
+ */
+static void poly_level(bn_t *c, const bn_t *a, int n, int w, const bn_t m,
+		bn_t *t) {
+	int i, j, d1, d2;
+
+	for (i = 0; i < n; i += w) {
+		d1 = RLC_MIN(w / 2, n - i);
+		d2 = RLC_MIN(w, n - i) - d1;
+		if (d2 == 0) {
+			for (j = 0; j < d1; j++) {
+				bn_copy(c[i + j], a[i + j]);
+			}
+			continue;
+		}
+		/* (x^d1 + A)(x^d2 + B) = A * B + x^d1 * B + x^d2 * A + x^(d1 + d2). */
+		poly_mul(c + i, a + i, d1, a + i + d1, d2, m, t);
+		bn_zero(c[i + d1 + d2 - 1]);
+		for (j = 0; j < d2; j++) {
+			poly_add(c[i + d1 + j], c[i + d1 + j], a[i + d1 + j], m);
+		}
+		for (j = 0; j < d1; j++) {
+			poly_add(c[i + d2 + j], c[i + d2 + j], a[i + j], m);
+		}
+	}
+}
+
+/**
+ * Builds the subproduct tree of a set of points, with level j holding the
+ * products of 2^j consecutive factors (x - x_i).
+ *
+ * @param[out] tree			- the levels of the tree.
+ * @param[in] x				- the points.
+ * @param[in] n				- the number of points.
+ * @param[in] l				- the number of levels.
+ * @param[in] m				- the modulus.
+ * @param[in] t				- the temporary integers.
+ */
+static void poly_tree(bn_t *tree, const bn_t *x, int n, int l, const bn_t m,
+		bn_t *t) {
+	for (int i = 0; i < n; i++) {
+		bn_mod(tree[i], x[i], m);
+		bn_sub(tree[i], m, tree[i]);
+		bn_mod(tree[i], tree[i], m);
+	}
+	for (int j = 1; j < l; j++) {
+		poly_level(tree + j * n, tree + (j - 1) * n, n, 1 << j, m, t);
+	}
+}
+
+/**
+ * Evaluates a polynomial reduced modulo a node of the subproduct tree at the
+ * points covered by the node, going down the remainder tree.
+ *
+ * @param[out] c			- the evaluations.
+ * @param[in] a				- the coefficients of the reduced polynomial.
+ * @param[in] x				- the points covered by the node.
+ * @param[in] tree			- the levels of the subproduct tree.
+ * @param[in] n				- the total number of points.
+ * @param[in] j				- the level of the node.
+ * @param[in] d				- the number of points covered by the node.
+ * @param[in] m				- the modulus.
+ * @param[in] t				- the temporary integers.
+ */
+static void poly_down(bn_t *c, const bn_t *a, const bn_t *x, const bn_t *tree,
+		int n, int j, int d, const bn_t m, bn_t *t) {
+	int d1 = RLC_MIN(1 << (j - 1), d);
+
+	if (d <= POLY_HORNER) {
+		for (int i = 0; i < d; i++) {
+			bn_evl(c[i], a, x[i], m, d);
+		}
+		return;
+	}
+	if (d1 == d) {
+		/* The node has a single child, which is the same polynomial. */
+		poly_down(c, a, x, tree, n, j - 1, d, m, t);
+		return;
+	}
+
+	/* The children cover the first d1 and the last d - d1 points. */
+	poly_rem(t, a, d, tree + (j - 1) * n, d1, m, t + d);
+	poly_down(c, t, x, tree, n, j - 1, d1, m, t + d);
+	poly_rem(t, a, d, tree + (j - 1) * n + d1, d - d1, m, t + d);
+	poly_down(c + d1, t, x + d1, tree + d1, n, j - 1, d - d1, m, t + d);
+}
+
+/**
+ * Returns the number of levels of the subproduct tree of a set of points.
+ *
+ * @param[in] n				- the number of points.
+ * @return the number of levels.
+ */
+static int poly_depth(int n) {
+	int l = 1;
+
+	while ((1 << (l - 1)) < n) {
+		l++;
+	}
+	return l;
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -94,3 +423,181 @@ void bn_evl(bn_t c, const bn_t *a, const bn_t x, const bn_t b, int n) {
         bn_mod(c, c, b);
     }
 }
+
+void bn_lag_fast(bn_t *c, const bn_t *a, const bn_t b, int n) {
+	int i, j, l, s = 2 * n + POLY_TMP(n);
+	bn_t *u, *v, *w, *t;
+
+	if (n < POLY_KARAT) {
+		bn_lag(c, a, b, n);
+		return;
+	}
+
+	w = RLC_MALLOC(bn_t, s);
+
+	RLC_TRY {
+		if (w == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < s; i++) {
+			bn_null(w[i]);
+			bn_new(w[i]);
+		}
+		u = w;
+		v = w + n;
+		t = w + 2 * n;
+
+		/* Only two levels of the subproduct tree are kept at a time. */
+		l = poly_depth(n);
+		poly_tree(u, a, n, 1, b, t);
+		for (j = 1; j < l; j++) {
+			poly_level(v, u, n, 1 << j, b, t);
+			u = (u == w ? w + n : w);
+			v = (v == w ? w + n : w);
+		}
+		for (i = 0; i < n; i++) {
+			bn_copy(c[i], u[i]);
+		}
+		bn_set_dig(c[n], 1);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; w != NULL && i < s; i++) {
+			bn_free(w[i]);
+		}
+		alloc_free((void *)w);
+	}
+}
+
+void bn_evl_sim(bn_t *c, const bn_t *a, const bn_t *x, const bn_t b, int n,
+		int m) {
+	int i, l, s;
+	bn_t *w, *r, *t;
+
+	if (m <= POLY_HORNER) {
+		for (i = 0; i < m; i++) {
+			bn_evl(c[i], a, x[i], b, n);
+		}
+		return;
+	}
+
+	l = poly_depth(m);
+	s = l * m + m + n + POLY_TMP(RLC_MAX(n, m));
+	w = RLC_MALLOC(bn_t, s);
+
+	RLC_TRY {
+		if (w == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < s; i++) {
+			bn_null(w[i]);
+			bn_new(w[i]);
+		}
+		r = w + l * m;
+		t = r + m + n;
+
+		poly_tree(w, x, m, l, b, t);
+		for (i = 0; i < n; i++) {
+			bn_mod(r[m + i], a[i], b);
+		}
+		poly_rem(r, r + m, n, w + (l - 1) * m, m, b, t);
+		poly_down(c, r, x, w, m, l - 1, m, b, t);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; w != NULL && i < s; i++) {
+			bn_free(w[i]);
+		}
+		alloc_free((void *)w);
+	}
+}
+
+void bn_itp(bn_t *c, const bn_t *x, const bn_t *y, const bn_t b, int n) {
+	int i, j, k, l, d, d1, d2, s;
+	bn_t *w, *u, *v, *z, *t;
+
+	if (n <= 0) {
+		return;
+	}
+
+	l = poly_depth(n);
+	s = l * n + 2 * n + POLY_TMP(n);
+	w = RLC_MALLOC(bn_t, s);
+
+	RLC_TRY {
+		if (w == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < s; i++) {
+			bn_null(w[i]);
+			bn_new(w[i]);
+		}
+		u = w + l * n;
+		v = u + n;
+		t = v + n;
+
+		/* Evaluate the derivative of the root polynomial at the points. */
+		poly_tree(w, x, n, l, b, t);
+		z = w + (l - 1) * n;
+		for (i = 0; i < n - 1; i++) {
+			bn_mul_dig(v[i], z[i + 1], i + 1);
+			bn_mod(v[i], v[i], b);
+		}
+		bn_set_dig(v[n - 1], n);
+		bn_mod(v[n - 1], v[n - 1], b);
+		poly_down(u, v, x, w, n, l - 1, n, b, t);
+		bn_mod_inv_sim(u, (const bn_t *)u, b, n);
+		for (i = 0; i < n; i++) {
+			bn_mod(v[i], y[i], b);
+			bn_mul(v[i], v[i], u[i]);
+			bn_mod(v[i], v[i], b);
+		}
+
+		/* Combine the weighted sums up the tree: P = P1 * M2 + P2 * M1. */
+		for (j = 1; j < l; j++) {
+			z = w + (j - 1) * n;
+			for (i = 0; i < n; i += (1 << j)) {
+				d1 = RLC_MIN(1 << (j - 1), n - i);
+				d = RLC_MIN(1 << j, n - i);
+				d2 = d - d1;
+				if (d2 == 0) {
+					for (k = 0; k < d1; k++) {
+						bn_copy(u[i + k], v[i + k]);
+					}
+					continue;
+				}
+				poly_mul(t, v + i, d1, z + i + d1, d2, b, t + 2 * d);
+				poly_mul(t + d, v + i + d1, d2, z + i, d1, b, t + 2 * d);
+				bn_zero(u[i + d - 1]);
+				for (k = 0; k < d - 1; k++) {
+					poly_add(u[i + k], t[k], t[d + k], b);
+				}
+				for (k = 0; k < d1; k++) {
+					poly_add(u[i + d2 + k], u[i + d2 + k], v[i + k], b);
+				}
+				for (k = 0; k < d2; k++) {
+					poly_add(u[i + d1 + k], u[i + d1 + k], v[i + d1 + k], b);
+				}
+			}
+			z = u;
+			u = v;
+			v = z;
+		}
+		for (i = 0; i < n; i++) {
+			bn_copy(c[i], v[i]);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; w != NULL && i < s; i++) {
+			bn_free(w[i]);
+		}
+		alloc_free((void *)w);
+	}
+}
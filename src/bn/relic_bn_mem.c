@@ -57,7 +57,7 @@ void bn_make(bn_t a, int digits) {
 	if (a != NULL) {
 		a->dp = NULL;
 #if ALIGN == 1
-		a->dp = (dig_t *)malloc(digits * sizeof(dig_t));
+		a->dp = (dig_t *)alloc_malloc(digits * sizeof(dig_t));
 #elif OPSYS == WINDOWS
 		a->dp = _aligned_malloc(digits * sizeof(dig_t), ALIGN);
 #else
@@ -72,7 +72,7 @@ void bn_make(bn_t a, int digits) {
 	}
 
 	if (a->dp == NULL) {
-		free((void *)a);
+		alloc_free((void *)a);
 		RLC_THROW(ERR_NO_MEMORY);
 	}
 #else
@@ -96,7 +96,9 @@ void bn_clean(bn_t a) {
 #if ALLOC == DYNAMIC
 	if (a != NULL) {
 		if (a->dp != NULL) {
-#if OPSYS == WINDOWS && ALIGN > 1
+#if ALIGN == 1
+			alloc_free(a->dp);
+#elif OPSYS == WINDOWS
 			_aligned_free(a->dp);
 #else
 			free(a->dp);
@@ -119,7 +121,11 @@ void bn_grow(bn_t a, int digits) {
 	if (a->alloc < digits) {
 		/* At least add RLC_BN_SIZE more digits. */
 		digits += (RLC_BN_SIZE * 2) - (digits % RLC_BN_SIZE);
+#if ALIGN == 1
+		t = (dig_t *)alloc_realloc(a->dp, (RLC_DIG / 8) * digits);
+#else
 		t = (dig_t *)realloc(a->dp, (RLC_DIG / 8) * digits);
+#endif
 		if (t == NULL) {
 			RLC_THROW(ERR_NO_MEMORY);
 			return;
@@ -33,6 +33,32 @@
 #include "relic_core.h"
 #include "relic_bn_low.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Reduces a multiple precision integer smaller than m * R with the Montgomery
+ * constant of a context. Computes c = a * R^(-1) mod m.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the multiple precision integer to reduce.
+ * @param[in] ctx			- the modulus context.
+ */
+static void bn_mod_ctx_monty(bn_t c, const bn_t a, const mod_t ctx) {
+	int digits = ctx->m->used;
+
+	bn_grow(c, digits);
+	/* The reduction only writes digits that were already read. */
+	bn_modn_low(c->dp, a->dp, a->used, ctx->m->dp, digits, ctx->u->dp[0]);
+	c->used = digits;
+	c->sign = RLC_POS;
+	bn_trim(c);
+	if (bn_cmp_abs(c, ctx->m) != RLC_LT) {
+		bn_sub(c, c, ctx->m);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -370,3 +396,121 @@ void bn_mod_pmers(bn_t c, const bn_t a, const bn_t m, const bn_t u) {
 }
 
 #endif /* BN_MOD == PMERS || !defined(STRIP) */
+
+void bn_mod_ctx(mod_t ctx, const bn_t m) {
+	if (bn_sign(m) != RLC_POS || bn_is_zero(m)) {
+		RLC_THROW(ERR_NO_VALID);
+		return;
+	}
+
+	bn_copy(ctx->m, m);
+	bn_zero(ctx->v);
+	if (bn_is_even(m)) {
+		bn_zero(ctx->u);
+		bn_zero(ctx->r2);
+#if BN_MOD == BARRT || !defined(STRIP)
+		/* Even moduli have no Montgomery form, so reduce them by Barrett. */
+		bn_mod_pre_barrt(ctx->v, m);
+#endif
+	} else {
+		bn_mod_pre_monty(ctx->u, m);
+		bn_set_2b(ctx->r2, m->used * 2 * RLC_DIG);
+		bn_mod(ctx->r2, ctx->r2, m);
+#if BN_MOD == BARRT
+		bn_mod_pre_barrt(ctx->v, m);
+#endif
+	}
+}
+
+void bn_mod_ctx_rdc(bn_t c, const bn_t a, const mod_t ctx) {
+#if BN_MOD == BARRT || !defined(STRIP)
+	if (!bn_is_zero(ctx->v)) {
+		bn_mod_barrt(c, a, ctx->m, ctx->v);
+		return;
+	}
+#endif
+	bn_mod_basic(c, a, ctx->m);
+}
+
+void bn_mod_ctx_conv(bn_t c, const bn_t a, const mod_t ctx) {
+	bn_t t;
+
+	if (bn_is_even(ctx->m)) {
+		RLC_THROW(ERR_NO_VALID);
+		return;
+	}
+
+	bn_null(t);
+
+	RLC_TRY {
+		bn_new_size(t, 2 * ctx->m->used);
+		if (bn_sign(a) == RLC_NEG || bn_cmp(a, ctx->m) != RLC_LT) {
+			bn_mod_ctx_rdc(t, a, ctx);
+			bn_mul(t, t, ctx->r2);
+		} else {
+			bn_mul(t, a, ctx->r2);
+		}
+		bn_mod_ctx_monty(c, t, ctx);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(t);
+	}
+}
+
+void bn_mod_ctx_back(bn_t c, const bn_t a, const mod_t ctx) {
+	if (bn_is_even(ctx->m)) {
+		RLC_THROW(ERR_NO_VALID);
+		return;
+	}
+
+	bn_mod_ctx_monty(c, a, ctx);
+}
+
+void bn_mod_ctx_mul(bn_t c, const bn_t a, const bn_t b, const mod_t ctx) {
+	bn_t t;
+
+	if (bn_is_even(ctx->m)) {
+		RLC_THROW(ERR_NO_VALID);
+		return;
+	}
+
+	bn_null(t);
+
+	RLC_TRY {
+		bn_new_size(t, 2 * ctx->m->used);
+		bn_mul(t, a, b);
+		bn_mod_ctx_monty(c, t, ctx);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(t);
+	}
+}
+
+void bn_mod_ctx_sqr(bn_t c, const bn_t a, const mod_t ctx) {
+	bn_t t;
+
+	if (bn_is_even(ctx->m)) {
+		RLC_THROW(ERR_NO_VALID);
+		return;
+	}
+
+	bn_null(t);
+
+	RLC_TRY {
+		bn_new_size(t, 2 * ctx->m->used);
+		bn_sqr(t, a);
+		bn_mod_ctx_monty(c, t, ctx);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(t);
+	}
+}
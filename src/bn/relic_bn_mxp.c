@@ -30,6 +30,7 @@
  */
 
 #include "relic_core.h"
+#include "relic_bn_low.h"
 
 /*============================================================================*/
 /* Private definitions                                                        */
@@ -465,3 +466,531 @@ void bn_mxp_dig(bn_t c, const bn_t a, dig_t b, const bn_t m) {
 		bn_free(r);
 	}
 }
+
+void bn_mxp_pre(bn_t *t, const bn_t g, const bn_t m) {
+	int i, j, l;
+	bn_t u;
+
+	bn_null(u);
+
+	RLC_TRY {
+		bn_new(u);
+		bn_mod_pre(u, m);
+
+		l = RLC_CEIL(bn_bits(m), BN_DEPTH);
+
+#if BN_MOD == MONTY
+		bn_set_dig(t[0], 1);
+		bn_mod_monty_conv(t[0], t[0], m);
+		bn_mod_monty_conv(t[1], g, m);
+#else
+		bn_set_dig(t[0], 1);
+		bn_mod(t[1], g, m);
+#endif
+
+		/* Entry i holds the product of g^(2^(jl)) for each bit j set in i. */
+		for (j = 1; j < BN_DEPTH; j++) {
+			bn_sqr(t[1 << j], t[1 << (j - 1)]);
+			bn_mod(t[1 << j], t[1 << j], m, u);
+			for (i = 1; i < l; i++) {
+				bn_sqr(t[1 << j], t[1 << j]);
+				bn_mod(t[1 << j], t[1 << j], m, u);
+			}
+			for (i = 1; i < (1 << j); i++) {
+				bn_mul(t[(1 << j) + i], t[i], t[1 << j]);
+				bn_mod(t[(1 << j) + i], t[(1 << j) + i], m, u);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(u);
+	}
+}
+
+void bn_mxp_fix(bn_t c, const bn_t *t, const bn_t e, const bn_t m) {
+	int i, j, l, w, n0, p0, p1;
+	bn_t u, r;
+
+	if (bn_cmp_dig(m, 1) == RLC_EQ) {
+		bn_zero(c);
+		return;
+	}
+
+	if (bn_is_zero(e)) {
+		bn_set_dig(c, 1);
+		return;
+	}
+
+	bn_null(u);
+	bn_null(r);
+
+	RLC_TRY {
+		bn_new(u);
+		bn_new(r);
+
+		l = RLC_CEIL(bn_bits(m), BN_DEPTH);
+		n0 = bn_bits(e);
+
+		if (n0 > BN_DEPTH * l) {
+			/* The table does not cover the exponent, so recover the base. */
+#if BN_MOD == MONTY
+			bn_mod_monty_back(r, t[1], m);
+#else
+			bn_copy(r, t[1]);
+#endif
+			bn_mxp(c, r, e, m);
+		} else {
+			bn_mod_pre(u, m);
+			p0 = BN_DEPTH * l - 1;
+
+			w = 0;
+			p1 = p0--;
+			for (j = BN_DEPTH - 1; j >= 0; j--, p1 -= l) {
+				w = w << 1;
+				if (p1 < n0 && bn_get_bit(e, p1)) {
+					w = w | 1;
+				}
+			}
+
+			bn_copy(r, t[w]);
+			for (i = l - 2; i >= 0; i--) {
+				bn_sqr(r, r);
+				bn_mod(r, r, m, u);
+
+				w = 0;
+				p1 = p0--;
+				for (j = BN_DEPTH - 1; j >= 0; j--, p1 -= l) {
+					w = w << 1;
+					if (p1 < n0 && bn_get_bit(e, p1)) {
+						w = w | 1;
+					}
+				}
+				if (w > 0) {
+					bn_mul(r, r, t[w]);
+					bn_mod(r, r, m, u);
+				}
+			}
+			bn_trim(r);
+#if BN_MOD == MONTY
+			bn_mod_monty_back(r, r, m);
+#endif
+
+			if (bn_sign(e) == RLC_NEG) {
+				bn_mod_inv(c, r, m);
+			} else {
+				bn_copy(c, r);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(u);
+		bn_free(r);
+	}
+}
+
+void bn_mxp_ctx(bn_t c, const bn_t a, const bn_t b, const mod_t ctx) {
+	bn_t tab[RLC_TABLE_SIZE], t, r;
+	int i, j, l, w = 1;
+	uint8_t *win;
+
+	if (bn_is_even(ctx->m)) {
+		RLC_THROW(ERR_NO_VALID);
+		return;
+	}
+
+	if (bn_cmp_dig(ctx->m, 1) == RLC_EQ) {
+		bn_zero(c);
+		return;
+	}
+
+	if (bn_is_zero(b)) {
+		/* The unity in Montgomery form is R mod m. */
+		bn_mod_ctx_back(c, ctx->r2, ctx);
+		return;
+	}
+
+	win = RLC_ALLOCA(uint8_t, bn_bits(b));
+	if (win == NULL) {
+		RLC_THROW(ERR_NO_MEMORY);
+		return;
+	}
+
+	bn_null(t);
+	bn_null(r);
+	for (i = 0; i < RLC_TABLE_SIZE; i++) {
+		bn_null(tab[i]);
+	}
+
+	/* Find window size. */
+	i = bn_bits(b);
+	if (i <= 21) {
+		w = 2;
+	} else if (i <= 32) {
+		w = 3;
+	} else if (i <= 128) {
+		w = 4;
+	} else if (i <= 256) {
+		w = 5;
+	} else if (i <= 512) {
+		w = 6;
+	} else {
+		w = 7;
+	}
+
+	RLC_TRY {
+		for (i = 0; i < (1 << (w - 1)); i++) {
+			bn_new(tab[i]);
+		}
+		bn_new(t);
+		bn_new(r);
+
+		bn_mod_ctx_back(r, ctx->r2, ctx);
+		bn_copy(tab[0], a);
+		bn_mod_ctx_sqr(t, tab[0], ctx);
+		for (i = 1; i < 1 << (w - 1); i++) {
+			bn_mod_ctx_mul(tab[i], tab[i - 1], t, ctx);
+		}
+
+		l = bn_bits(b);
+		bn_rec_slw(win, &l, b, w);
+		for (i = 0; i < l; i++) {
+			if (win[i] == 0) {
+				bn_mod_ctx_sqr(r, r, ctx);
+			} else {
+				for (j = 0; j < util_bits_dig(win[i]); j++) {
+					bn_mod_ctx_sqr(r, r, ctx);
+				}
+				bn_mod_ctx_mul(r, r, tab[win[i] >> 1], ctx);
+			}
+		}
+
+		if (bn_sign(b) == RLC_NEG) {
+			bn_mod_ctx_back(r, r, ctx);
+			bn_mod_inv(r, r, ctx->m);
+			bn_mod_ctx_conv(r, r, ctx);
+		}
+		bn_copy(c, r);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < (1 << (w - 1)); i++) {
+			bn_free(tab[i]);
+		}
+		bn_free(t);
+		bn_free(r);
+		RLC_FREE(win);
+	}
+}
+
+void bn_mxp_ctx_dig(bn_t c, const bn_t a, dig_t b, const mod_t ctx) {
+	int i, l;
+	bn_t t, r;
+
+	if (bn_is_even(ctx->m)) {
+		RLC_THROW(ERR_NO_VALID);
+		return;
+	}
+
+	if (bn_cmp_dig(ctx->m, 1) == RLC_EQ) {
+		bn_zero(c);
+		return;
+	}
+
+	if (b == 0) {
+		bn_mod_ctx_back(c, ctx->r2, ctx);
+		return;
+	}
+
+	bn_null(t);
+	bn_null(r);
+
+	RLC_TRY {
+		bn_new(t);
+		bn_new(r);
+
+		l = util_bits_dig(b);
+		bn_copy(t, a);
+		bn_copy(r, t);
+		for (i = l - 2; i >= 0; i--) {
+			bn_mod_ctx_sqr(r, r, ctx);
+			if (b & ((dig_t)1 << i)) {
+				bn_mod_ctx_mul(r, r, t, ctx);
+			}
+		}
+		bn_copy(c, r);
+	} RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(t);
+		bn_free(r);
+	}
+}
+
+void bn_mxp_ctx_many(bn_t *c, const bn_t *a, const bn_t b, const mod_t ctx,
+		int n) {
+	bn_t *tab, t;
+	int i, j, k, l, o, w = 1, s, m, lot;
+	uint8_t *win;
+
+	if (n <= 0) {
+		return;
+	}
+
+	if (bn_is_even(ctx->m)) {
+		RLC_THROW(ERR_NO_VALID);
+		return;
+	}
+
+	if (bn_cmp_dig(ctx->m, 1) == RLC_EQ || bn_is_zero(b)) {
+		for (k = 0; k < n; k++) {
+			bn_mxp_ctx(c[k], a[k], b, ctx);
+		}
+		return;
+	}
+
+	/* Find window size. */
+	i = bn_bits(b);
+	if (i <= 21) {
+		w = 2;
+	} else if (i <= 32) {
+		w = 3;
+	} else if (i <= 128) {
+		w = 4;
+	} else if (i <= 256) {
+		w = 5;
+	} else if (i <= 512) {
+		w = 6;
+	} else {
+		w = 7;
+	}
+	s = 1 << (w - 1);
+	lot = RLC_MIN(RLC_BN_LOT, n);
+
+	win = RLC_ALLOCA(uint8_t, bn_bits(b));
+	tab = RLC_ALLOCA(bn_t, lot * s);
+	if (win == NULL || tab == NULL) {
+		RLC_FREE(win);
+		RLC_FREE(tab);
+		RLC_THROW(ERR_NO_MEMORY);
+		return;
+	}
+
+	bn_null(t);
+	for (i = 0; i < lot * s; i++) {
+		bn_null(tab[i]);
+	}
+
+	RLC_TRY {
+		for (i = 0; i < lot * s; i++) {
+			bn_new(tab[i]);
+		}
+		bn_new(t);
+
+		l = bn_bits(b);
+		bn_rec_slw(win, &l, b, w);
+
+		/* Bases are processed in lots, so the tables have bounded size. */
+		for (o = 0; o < n; o += lot) {
+			m = RLC_MIN(lot, n - o);
+			/* Tables of odd powers are laid out consecutively for each base. */
+			for (k = 0; k < m; k++) {
+				bn_copy(tab[k * s], a[o + k]);
+				bn_mod_ctx_sqr(t, tab[k * s], ctx);
+				for (i = 1; i < s; i++) {
+					bn_mod_ctx_mul(tab[k * s + i], tab[k * s + i - 1], t, ctx);
+				}
+			}
+			for (k = 0; k < m; k++) {
+				bn_mod_ctx_back(c[o + k], ctx->r2, ctx);
+			}
+
+			for (i = 0; i < l; i++) {
+				for (k = o; k < o + m; k++) {
+					if (win[i] == 0) {
+						bn_mod_ctx_sqr(c[k], c[k], ctx);
+					} else {
+						for (j = 0; j < util_bits_dig(win[i]); j++) {
+							bn_mod_ctx_sqr(c[k], c[k], ctx);
+						}
+						bn_mod_ctx_mul(c[k], c[k],
+								tab[(k - o) * s + (win[i] >> 1)], ctx);
+					}
+				}
+			}
+
+			if (bn_sign(b) == RLC_NEG) {
+				for (k = o; k < o + m; k++) {
+					bn_mod_ctx_back(c[k], c[k], ctx);
+					bn_mod_inv(c[k], c[k], ctx->m);
+					bn_mod_ctx_conv(c[k], c[k], ctx);
+				}
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < lot * s; i++) {
+			bn_free(tab[i]);
+		}
+		bn_free(t);
+		RLC_FREE(win);
+		RLC_FREE(tab);
+	}
+}
+
+void bn_mxp_x8(bn_t *c, const bn_t *a, const bn_t b, const bn_t m) {
+	bn_t *tab, r[8], t[8], u;
+	dig_t *pc[8];
+	const dig_t *pa[8], *pb[8];
+	int i, j, k, l, w = 1, s, size = m->used;
+	uint8_t *win;
+
+	if (bn_is_even(m) || bn_sign(m) == RLC_NEG) {
+		RLC_THROW(ERR_NO_VALID);
+		return;
+	}
+
+	if (size > RLC_BN_SIZE) {
+		RLC_THROW(ERR_NO_PRECI);
+		return;
+	}
+
+	if (bn_cmp_dig(m, 1) == RLC_EQ) {
+		for (k = 0; k < 8; k++) {
+			bn_zero(c[k]);
+		}
+		return;
+	}
+
+	if (bn_is_zero(b)) {
+		for (k = 0; k < 8; k++) {
+			bn_set_dig(c[k], 1);
+		}
+		return;
+	}
+
+	/* Find window size. */
+	i = bn_bits(b);
+	if (i <= 21) {
+		w = 2;
+	} else if (i <= 32) {
+		w = 3;
+	} else if (i <= 128) {
+		w = 4;
+	} else if (i <= 256) {
+		w = 5;
+	} else {
+		w = 6;
+	}
+	s = 1 << (w - 1);
+
+	win = RLC_ALLOCA(uint8_t, bn_bits(b));
+	tab = RLC_ALLOCA(bn_t, 8 * s);
+	if (win == NULL || tab == NULL) {
+		RLC_FREE(win);
+		RLC_FREE(tab);
+		RLC_THROW(ERR_NO_MEMORY);
+		return;
+	}
+
+	bn_null(u);
+	for (k = 0; k < 8; k++) {
+		bn_null(r[k]);
+		bn_null(t[k]);
+	}
+	for (i = 0; i < 8 * s; i++) {
+		bn_null(tab[i]);
+	}
+
+	RLC_TRY {
+		bn_new(u);
+		for (k = 0; k < 8; k++) {
+			bn_new_size(r[k], size);
+			bn_new_size(t[k], size);
+		}
+		for (i = 0; i < 8 * s; i++) {
+			bn_new_size(tab[i], size);
+		}
+
+		bn_mod_pre_monty(u, m);
+
+		/* Odd powers are stored as tab[8 * i + k] = a_k^(2i + 1). */
+		for (k = 0; k < 8; k++) {
+			bn_mod_monty_conv(tab[k], a[k], m);
+			bn_set_dig(r[k], 1);
+			bn_mod_monty_conv(r[k], r[k], m);
+			for (j = tab[k]->used; j < size; j++) {
+				tab[k]->dp[j] = 0;
+			}
+			for (j = r[k]->used; j < size; j++) {
+				r[k]->dp[j] = 0;
+			}
+			pc[k] = t[k]->dp;
+			pa[k] = tab[k]->dp;
+		}
+		bn_mulm_x8_low(pc, pa, pa, m->dp, u->dp[0], size);
+		for (i = 1; i < s; i++) {
+			for (k = 0; k < 8; k++) {
+				pc[k] = tab[8 * i + k]->dp;
+				pa[k] = tab[8 * (i - 1) + k]->dp;
+				pb[k] = t[k]->dp;
+			}
+			bn_mulm_x8_low(pc, pa, pb, m->dp, u->dp[0], size);
+		}
+
+		for (k = 0; k < 8; k++) {
+			pc[k] = r[k]->dp;
+			pa[k] = r[k]->dp;
+		}
+		l = bn_bits(b);
+		bn_rec_slw(win, &l, b, w);
+		for (i = 0; i < l; i++) {
+			if (win[i] == 0) {
+				bn_mulm_x8_low(pc, pa, pa, m->dp, u->dp[0], size);
+			} else {
+				for (j = 0; j < util_bits_dig(win[i]); j++) {
+					bn_mulm_x8_low(pc, pa, pa, m->dp, u->dp[0], size);
+				}
+				for (k = 0; k < 8; k++) {
+					pb[k] = tab[8 * (win[i] >> 1) + k]->dp;
+				}
+				bn_mulm_x8_low(pc, pa, pb, m->dp, u->dp[0], size);
+			}
+		}
+
+		for (k = 0; k < 8; k++) {
+			r[k]->used = size;
+			bn_trim(r[k]);
+			bn_mod_monty_back(c[k], r[k], m);
+			if (bn_sign(b) == RLC_NEG) {
+				bn_mod_inv(c[k], c[k], m);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(u);
+		for (k = 0; k < 8; k++) {
+			bn_free(r[k]);
+			bn_free(t[k]);
+		}
+		for (i = 0; i < 8 * s; i++) {
+			bn_free(tab[i]);
+		}
+		RLC_FREE(win);
+		RLC_FREE(tab);
+	}
+}
@@ -43,6 +43,22 @@
  */
 #define BASIC_TESTS	((int)(sizeof(primes)/sizeof(dig_t)))
 
+/**
+ * Number of odd candidates covered by each sieving window.
+ */
+#define SIEVE_SIZE	1024
+
+/**
+ * Maximum bound on the sieving primes, which otherwise grows as the square of
+ * the size of candidates.
+ */
+#define SIEVE_MAX	(1 << 20)
+
+/**
+ * Minimum size in bits of candidates tested by multiple threads.
+ */
+#define SIEVE_THR	512
+
 /**
  * Small prime numbers table.
  */
@@ -166,6 +182,294 @@ static void bn_exp(bn_t c, const bn_t a, const bn_t b, const bn_t m) {
 
 #endif
 
+/**
+ * Marks the candidates c + 2k in a sieving window which are divisible by each
+ * prime in a group, or such that 2(c + 2k) + 1 is divisible when searching for
+ * safe primes. The primes are multiplied together so that a single division
+ * of c by a digit is needed for the whole group.
+ *
+ * @param[in,out] s			- the sieving window.
+ * @param[in] c				- the first candidate in the window.
+ * @param[in] g				- the group of odd primes.
+ * @param[in] n				- the number of primes in the group.
+ * @param[in] safe			- the flag to search for safe primes.
+ */
+static void bn_sieve_grp(uint8_t *s, const bn_t c, const dig_t *g, int n,
+		int safe) {
+	uint32_t h, k, p, r;
+	dig_t d = 1, t;
+	int i;
+
+	for (i = 0; i < n; i++) {
+		d *= g[i];
+	}
+	bn_mod_dig(&t, c, d);
+
+	for (i = 0; i < n; i++) {
+		p = g[i];
+		r = t % p;
+		h = (p + 1) / 2;
+		/* Candidate c + 2k is divisible by p when k = -r/2 mod p. */
+		k = (uint64_t)(p - r) % p * h % p;
+		for (; k < SIEVE_SIZE; k += p) {
+			s[k] = 1;
+		}
+		if (safe) {
+			/* And 2(c + 2k) + 1 is divisible by p when k = -(2r + 1)/4. */
+			k = (uint64_t)((p - (2 * r + 1) % p) % p) * h % p * h % p;
+			for (; k < SIEVE_SIZE; k += p) {
+				s[k] = 1;
+			}
+		}
+	}
+}
+
+/**
+ * Sieves a window of odd candidates by all odd primes smaller than a bound.
+ * Primes are taken from the table first and then generated by sieving
+ * segments of odd integers with the table.
+ *
+ * @param[out] s			- the sieving window, with composites marked.
+ * @param[in] c				- the first candidate in the window.
+ * @param[in] bound			- the bound on the sieving primes.
+ * @param[in] safe			- the flag to search for safe primes.
+ */
+static void bn_sieve_win(uint8_t *s, const bn_t c, dig_t bound, int safe) {
+	uint8_t u[SIEVE_SIZE];
+	dig_t g[RLC_DIG], d = 1, p, q, base;
+	int i, j, n = 0;
+
+	memset(s, 0, SIEVE_SIZE);
+	for (i = 1; i < BASIC_TESTS; i++) {
+		if (d > RLC_DMASK / primes[i]) {
+			bn_sieve_grp(s, c, g, n, safe);
+			d = 1;
+			n = 0;
+		}
+		g[n++] = primes[i];
+		d *= primes[i];
+	}
+
+	/* Generate the larger primes in segments of 2 * SIEVE_SIZE integers. */
+	for (base = primes[BASIC_TESTS - 1] + 2; base < bound;
+			base += 2 * SIEVE_SIZE) {
+		memset(u, 0, sizeof(u));
+		for (i = 1; i < BASIC_TESTS; i++) {
+			p = primes[i];
+			if (p * p >= base + 2 * SIEVE_SIZE) {
+				break;
+			}
+			/* First odd multiple of p in the segment. */
+			q = (base + p - 1) / p * p;
+			if ((q & 1) == 0) {
+				q += p;
+			}
+			for (q = (q - base) / 2; q < SIEVE_SIZE; q += p) {
+				u[q] = 1;
+			}
+		}
+		for (j = 0; j < SIEVE_SIZE && base + 2 * j < bound; j++) {
+			if (u[j] == 0) {
+				p = base + 2 * j;
+				if (d > RLC_DMASK / p) {
+					bn_sieve_grp(s, c, g, n, safe);
+					d = 1;
+					n = 0;
+				}
+				g[n++] = p;
+				d *= p;
+			}
+		}
+	}
+	bn_sieve_grp(s, c, g, n, safe);
+}
+
+#if defined(MULTI) && CORES > 1
+
+/**
+ * Represents the state shared by the threads testing a sieving window.
+ */
+typedef struct {
+	/** The sieving window. */
+	const uint8_t *s;
+	/** The first candidate in the window. */
+	const bn_st *c;
+	/** The flag to search for safe primes. */
+	int safe;
+	/** The number of threads sharing the window. */
+	int n;
+	/** The position of the first prime found so far, or SIEVE_SIZE. */
+	int best;
+#if MULTI == PTHREAD
+	/** The lock protecting the position of the first prime. */
+	pthread_mutex_t lock;
+#endif
+} sieve_t;
+
+/**
+ * Reads or updates the position of the first prime found in a window.
+ *
+ * @param[in,out] job		- the shared state.
+ * @param[in] k				- the position of a new prime, or -1 to only read.
+ * @return the position of the first prime found so far.
+ */
+static int bn_sieve_best(sieve_t *job, int k) {
+	int best;
+
+#if MULTI == PTHREAD
+	pthread_mutex_lock(&job->lock);
+#elif MULTI == OPENMP
+#pragma omp critical (bn_sieve)
+#endif
+	{
+		if (k >= 0 && k < job->best) {
+			job->best = k;
+		}
+		best = job->best;
+	}
+#if MULTI == PTHREAD
+	pthread_mutex_unlock(&job->lock);
+#endif
+	return best;
+}
+
+/**
+ * Tests the candidates surviving the sieve assigned to a thread. Survivors are
+ * dealt in turns, and a thread stops once a prime was found before its next
+ * candidate, so the first prime in the window is always found.
+ *
+ * @param[in,out] ptr		- the shared state.
+ * @param[in] id			- the thread identifier.
+ */
+static void bn_sieve_job(void *ptr, int id) {
+	sieve_t *job = (sieve_t *)ptr;
+	int j = 0, k, found;
+	bn_t t;
+
+	bn_null(t);
+
+	RLC_TRY {
+		bn_new(t);
+
+		for (k = 0; k < SIEVE_SIZE; k++) {
+			if (job->s[k] != 0 || (j++ % job->n) != id) {
+				continue;
+			}
+			if (k > bn_sieve_best(job, -1)) {
+				break;
+			}
+			bn_add_dig(t, job->c, 2 * k);
+			found = bn_is_prime_rabin(t);
+			if (found && job->safe) {
+				bn_dbl(t, t);
+				bn_add_dig(t, t, 1);
+				found = bn_is_prime_rabin(t);
+			}
+			if (found) {
+				bn_sieve_best(job, k);
+				break;
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(t);
+	}
+}
+
+#endif /* MULTI && CORES > 1 */
+
+/**
+ * Finds the first probable prime in the sequence of odd candidates a, a + 2,
+ * a + 4, ... Windows of candidates are sieved by small primes, so the
+ * Miller-Rabin test only runs on candidates surviving the sieve. The sieving
+ * bound grows with the size of the candidates, as the tests get costlier.
+ * With multithreading, the survivors of each window are tested in parallel
+ * and the first prime is kept, so the result is the same as sequentially.
+ * When searching for safe primes, candidates c are also discarded if a small
+ * prime divides 2c + 1, and 2c + 1 must be a probable prime as well.
+ *
+ * @param[out] c			- the probable prime.
+ * @param[in] a				- the first candidate, odd and larger than the table.
+ * @param[in] safe			- the flag to search for c with 2c + 1 also prime.
+ */
+static void bn_sieve(bn_t c, const bn_t a, int safe) {
+	uint8_t s[SIEVE_SIZE];
+	dig_t bound;
+	int k, found = 0;
+	bn_t t;
+#if defined(MULTI) && CORES > 1
+	sieve_t job;
+#endif
+
+	bn_null(t);
+
+	RLC_TRY {
+		bn_new(t);
+
+		bn_copy(c, a);
+
+		bound = 0;
+#if WSIZE >= 32
+		k = bn_bits(a) + (safe ? bn_bits(a) : 0);
+		bound = RLC_MIN((dig_t)k * k, (dig_t)SIEVE_MAX);
+		/* Candidates must stay above the sieving primes. */
+		if (bn_bits(a) <= util_bits_dig(bound)) {
+			bound = 0;
+		}
+#endif
+
+		while (!found) {
+			bn_sieve_win(s, c, bound, safe);
+#if defined(MULTI) && CORES > 1
+			if (bn_bits(c) >= SIEVE_THR) {
+				/* Threads share the survivors, the result does not change. */
+				job.s = s;
+				job.c = c;
+				job.safe = safe;
+				job.n = CORES;
+				job.best = SIEVE_SIZE;
+#if MULTI == PTHREAD
+				pthread_mutex_init(&job.lock, NULL);
+#endif
+				k = core_run(bn_sieve_job, &job, CORES);
+#if MULTI == PTHREAD
+				pthread_mutex_destroy(&job.lock);
+#endif
+				if (k != RLC_OK) {
+					/* Survivors of a failed thread may hide the first prime. */
+					RLC_THROW(ERR_CAUGHT);
+				}
+				found = (job.best < SIEVE_SIZE);
+				bn_add_dig(c, c, 2 * (found ? job.best : SIEVE_SIZE));
+				continue;
+			}
+#endif
+			for (k = 0; k < SIEVE_SIZE && !found; k++) {
+				if (s[k] == 0 && bn_is_prime_rabin(c)) {
+					found = 1;
+					if (safe) {
+						bn_dbl(t, c);
+						bn_add_dig(t, t, 1);
+						found = bn_is_prime_rabin(t);
+					}
+				}
+				if (!found) {
+					bn_add_dig(c, c, 2);
+				}
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(t);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -406,17 +710,53 @@ int bn_is_prime_solov(const bn_t a) {
 	return result;
 }
 
+void bn_next_prime(bn_t c, const bn_t a) {
+	bn_t t;
+
+	bn_null(t);
+
+	if (bn_cmp_dig(a, 2) == RLC_LT) {
+		bn_set_dig(c, 2);
+		return;
+	}
+
+	RLC_TRY {
+		bn_new(t);
+
+		/* Start from the first odd integer larger than a. */
+		bn_add_dig(t, a, 1);
+		if (bn_is_even(t)) {
+			bn_add_dig(t, t, 1);
+		}
+
+		if (bn_cmp_dig(t, primes[BASIC_TESTS - 1]) != RLC_GT) {
+			/* Candidates may be in the table, so test them one by one. */
+			while (!bn_is_prime(t)) {
+				bn_add_dig(t, t, 2);
+			}
+			bn_copy(c, t);
+		} else {
+			bn_sieve(c, t, 0);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(t);
+	}
+}
+
 #if BN_GEN == BASIC || !defined(STRIP)
 
 void bn_gen_prime_basic(bn_t a, int bits) {
-	while (1) {
+	do {
 		do {
 			bn_rand(a, RLC_POS, bits);
 		} while (bn_bits(a) != bits);
-		if (bn_is_prime(a)) {
-			return;
-		}
-	}
+		/* Sieve from a random starting point up to the next prime. */
+		bn_next_prime(a, a);
+	} while (bn_bits(a) != bits);
 }
 
 #endif
@@ -424,6 +764,22 @@ void bn_gen_prime_basic(bn_t a, int bits) {
 #if BN_GEN == SAFEP || !defined(STRIP)
 
 void bn_gen_prime_safep(bn_t a, int bits) {
+	if (bits - 1 > util_bits_dig(primes[BASIC_TESTS - 1])) {
+		/* Sieve candidates q and 2q + 1 together, with q larger than table. */
+		do {
+			do {
+				bn_rand(a, RLC_POS, bits - 1);
+			} while (bn_bits(a) != bits - 1);
+			if (bn_is_even(a)) {
+				bn_add_dig(a, a, 1);
+			}
+			bn_sieve(a, a, 1);
+			bn_dbl(a, a);
+			bn_add_dig(a, a, 1);
+		} while (bn_bits(a) != bits);
+		return;
+	}
+
 	while (1) {
 		do {
 			bn_rand(a, RLC_POS, bits);
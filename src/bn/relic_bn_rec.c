@@ -1022,3 +1022,31 @@ void bn_rec_frb(bn_t *ki, int sub, const bn_t k, const bn_t x, const bn_t n,
 		}
 	}
 }
+
+size_t bn_rec_bkt(int *w, int n, int l, int max) {
+	size_t cost, best = 0;
+
+	for (int c = 1; c <= max; c++) {
+		/* Each window adds every point once and aggregates 2^(c-1) buckets. */
+		cost = (size_t)(l / c + 1) * (n + (1 << c) + 1) + l;
+		if (c == 1 || cost < best) {
+			best = cost;
+			*w = c;
+		}
+	}
+	return best;
+}
+
+int bn_rec_get(const dig_t *a, int d, int from, int w) {
+	int i = from >> RLC_DIG_LOG, j = from & (RLC_DIG - 1);
+	dig_t t;
+
+	if (i >= d) {
+		return 0;
+	}
+	t = a[i] >> j;
+	if (j + w > RLC_DIG && i + 1 < d) {
+		t |= a[i + 1] << (RLC_DIG - j);
+	}
+	return (int)(t & RLC_MASK(w));
+}
@@ -29,8 +29,71 @@
  * @ingroup cp
  */
 
+#include <stdlib.h>
+#include <string.h>
+
 #include "relic.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Reference to a signed message, used to find repeated messages.
+ */
+typedef struct {
+	/** The message. */
+	uint8_t *msg;
+	/** The message length in bytes. */
+	int len;
+} bls_msg_t;
+
+/**
+ * Compares two signed messages by length and then by content.
+ *
+ * @param[in] a				- the first message.
+ * @param[in] b				- the second message.
+ * @return a negative, zero or positive value as in memcmp().
+ */
+static int bls_cmp(const void *a, const void *b) {
+	const bls_msg_t *u = (const bls_msg_t *)a, *v = (const bls_msg_t *)b;
+
+	if (u->len != v->len) {
+		return (u->len < v->len ? -1 : 1);
+	}
+	return memcmp(u->msg, v->msg, u->len);
+}
+
+/**
+ * Checks if a list of messages has repetitions by sorting it.
+ *
+ * @param[in] msg			- the messages.
+ * @param[in] len			- the message lengths in bytes.
+ * @param[in] n				- the number of messages.
+ * @return 1 if two messages are equal, 0 otherwise.
+ */
+static int bls_dup(uint8_t *msg[], int len[], int n) {
+	bls_msg_t *t = RLC_ALLOCA(bls_msg_t, n);
+	int i, result = 0;
+
+	if (t == NULL) {
+		RLC_THROW(ERR_NO_MEMORY);
+		return 1;
+	}
+
+	for (i = 0; i < n; i++) {
+		t[i].msg = msg[i];
+		t[i].len = len[i];
+	}
+	qsort(t, n, sizeof(bls_msg_t), bls_cmp);
+	for (i = 1; i < n && !result; i++) {
+		result = (bls_cmp(&t[i - 1], &t[i]) == 0);
+	}
+
+	RLC_FREE(t);
+	return result;
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -119,3 +182,223 @@ int cp_bls_ver(g1_t s, uint8_t *msg, int len, g2_t q) {
 	}
 	return result;
 }
+
+int cp_bls_agg_sig(g1_t s, g1_t sig[], int n) {
+	int result = RLC_OK;
+
+	RLC_TRY {
+		g1_set_infty(s);
+		for (int i = 0; i < n; i++) {
+			g1_add(s, s, sig[i]);
+		}
+		g1_norm(s, s);
+	}
+	RLC_CATCH_ANY {
+		result = RLC_ERR;
+	}
+	return result;
+}
+
+int cp_bls_agg_ver(g1_t s, uint8_t *msg[], int len[], g2_t q[], int n) {
+	g1_t *p;
+	g2_t *r;
+	gt_t e;
+	int i, result = 1;
+
+	/* Repeated messages would allow rogue-key forgeries. */
+	if (n <= 0 || g1_is_infty(s) || bls_dup(msg, len, n)) {
+		return 0;
+	}
+
+	p = RLC_ALLOCA(g1_t, n + 1);
+	r = RLC_ALLOCA(g2_t, n + 1);
+	gt_null(e);
+
+	RLC_TRY {
+		gt_new(e);
+		if (p == NULL || r == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i <= n; i++) {
+			g1_null(p[i]);
+			g2_null(r[i]);
+			g1_new(p[i]);
+			g2_new(r[i]);
+		}
+
+		/* Check e(s, -g) * \prod e(H(m_i), q_i) = 1 with one final exp. */
+		for (i = 0; i < n; i++) {
+			if (g2_is_infty(q[i]) || !g2_is_valid(q[i])) {
+				result = 0;
+			}
+			g1_map(p[i], msg[i], len[i]);
+			g2_copy(r[i], q[i]);
+		}
+		g1_copy(p[n], s);
+		g2_get_gen(r[n]);
+		g2_neg(r[n], r[n]);
+
+		if (result) {
+			pc_map_sim(e, p, r, n + 1);
+			result = gt_is_unity(e);
+		}
+	}
+	RLC_CATCH_ANY {
+		result = 0;
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i <= n; i++) {
+			g1_free(p[i]);
+			g2_free(r[i]);
+		}
+		RLC_FREE(p);
+		RLC_FREE(r);
+		gt_free(e);
+	}
+	return result;
+}
+
+int cp_bls_fast_ver(g1_t s, uint8_t *msg, int len, g2_t q[], int n) {
+	g2_t t;
+	int result = 1;
+
+	/* An empty signer set would accept the identity for any message. */
+	if (n <= 0 || g1_is_infty(s)) {
+		return 0;
+	}
+
+	g2_null(t);
+
+	RLC_TRY {
+		g2_new(t);
+
+		/* Aggregate the keys, which have proofs of possession. */
+		g2_set_infty(t);
+		for (int i = 0; i < n; i++) {
+			if (g2_is_infty(q[i]) || !g2_is_valid(q[i])) {
+				result = 0;
+			}
+			g2_add(t, t, q[i]);
+		}
+		g2_norm(t, t);
+
+		if (result && !g2_is_infty(t)) {
+			result = cp_bls_ver(s, msg, len, t);
+		} else {
+			result = 0;
+		}
+	}
+	RLC_CATCH_ANY {
+		result = 0;
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		g2_free(t);
+	}
+	return result;
+}
+
+int cp_bls_ver_batch(int *ver, g1_t s[], uint8_t *msg[], int len[],
+		g2_t q[], int n) {
+	g1_t *t = RLC_ALLOCA(g1_t, n), *p = RLC_ALLOCA(g1_t, n + 1);
+	g2_t *r = RLC_ALLOCA(g2_t, n + 1);
+	bn_t *z = RLC_ALLOCA(bn_t, n), k;
+	gt_t e;
+	int i, m, result = 1;
+
+	if (n <= 0) {
+		RLC_FREE(t);
+		RLC_FREE(p);
+		RLC_FREE(r);
+		RLC_FREE(z);
+		return 1;
+	}
+
+	bn_null(k);
+	gt_null(e);
+
+	RLC_TRY {
+		bn_new(k);
+		gt_new(e);
+		if (t == NULL || p == NULL || r == NULL || z == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n; i++) {
+			g1_null(t[i]);
+			bn_null(z[i]);
+			g1_new(t[i]);
+			bn_new(z[i]);
+		}
+		for (i = 0; i <= n; i++) {
+			g1_null(p[i]);
+			g2_null(r[i]);
+			g1_new(p[i]);
+			g2_new(r[i]);
+		}
+
+		pc_get_ord(k);
+
+		/* Check e(\sum z_i s_i, -g) * \prod e(z_i H(m_i), q_i) = 1. */
+		for (i = m = 0; i < n; i++) {
+			ver[i] = !g2_is_infty(q[i]) && g2_is_valid(q[i]);
+			if (ver[i]) {
+				/* The z_i have |r|/2 bits, 127 bits for BN-254 and BLS12-381,
+				 * so an invalid signature passes with probability 2^{-127}. */
+				bn_rand(z[m], RLC_POS, bn_bits(k) / 2);
+				g1_map(p[m], msg[i], len[i]);
+				g1_mul(p[m], p[m], z[m]);
+				g1_copy(t[m], s[i]);
+				g2_copy(r[m], q[i]);
+				m++;
+			}
+		}
+		gt_set_unity(e);
+		if (m > 0) {
+			g1_mul_sim_lot(p[m], t, (const bn_t *)z, m);
+			g2_get_gen(r[m]);
+			g2_neg(r[m], r[m]);
+			pc_map_sim(e, p, r, m + 1);
+		}
+
+		/* Verify one by one if the batch failed. */
+		if (!gt_is_unity(e)) {
+			g2_get_gen(r[1]);
+			g2_neg(r[1], r[1]);
+			for (i = 0; i < n; i++) {
+				if (ver[i]) {
+					g1_map(p[0], msg[i], len[i]);
+					g1_copy(p[1], s[i]);
+					g2_copy(r[0], q[i]);
+					pc_map_sim(e, p, r, 2);
+					ver[i] = gt_is_unity(e);
+				}
+			}
+		}
+
+		for (i = 0; i < n; i++) {
+			result &= ver[i];
+		}
+	}
+	RLC_CATCH_ANY {
+		result = 0;
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < n; i++) {
+			g1_free(t[i]);
+			bn_free(z[i]);
+		}
+		for (i = 0; i <= n; i++) {
+			g1_free(p[i]);
+			g2_free(r[i]);
+		}
+		RLC_FREE(t);
+		RLC_FREE(p);
+		RLC_FREE(r);
+		RLC_FREE(z);
+		bn_free(k);
+		gt_free(e);
+	}
+	return result;
+}
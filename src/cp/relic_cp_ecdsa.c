@@ -31,6 +31,38 @@
 
 #include "relic.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Converts a message or its digest into an integer modulo the group order, as
+ * done by signature generation and verification.
+ *
+ * @param[out] e			- the resulting integer.
+ * @param[in] msg			- the message to sign.
+ * @param[in] len			- the message length in bytes.
+ * @param[in] hash			- the flag to indicate the message format.
+ * @param[in] n				- the group order.
+ */
+static void ecdsa_msg(bn_t e, uint8_t *msg, int len, int hash, bn_t n) {
+	uint8_t h[RLC_MD_LEN];
+
+	if (!hash) {
+		md_map(h, msg, len);
+		msg = h;
+		len = RLC_MD_LEN;
+	}
+
+	if (8 * len > bn_bits(n)) {
+		len = RLC_CEIL(bn_bits(n), 8);
+		bn_read_bin(e, msg, len);
+		bn_rsh(e, e, 8 * len - bn_bits(n));
+	} else {
+		bn_read_bin(e, msg, len);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -61,7 +93,6 @@ int cp_ecdsa_gen(bn_t d, ec_t q) {
 int cp_ecdsa_sig(bn_t r, bn_t s, uint8_t *msg, int len, int hash, bn_t d) {
 	bn_t n, k, x, e;
 	ec_t p;
-	uint8_t h[RLC_MD_LEN];
 	int result = RLC_OK;
 
 	bn_null(n);
@@ -78,6 +109,7 @@ int cp_ecdsa_sig(bn_t r, bn_t s, uint8_t *msg, int len, int hash, bn_t d) {
 		ec_new(p);
 
 		ec_curve_get_ord(n);
+		ecdsa_msg(e, msg, len, hash, n);
 		do {
 			do {
 				bn_rand_mod(k, n);
@@ -86,19 +118,6 @@ int cp_ecdsa_sig(bn_t r, bn_t s, uint8_t *msg, int len, int hash, bn_t d) {
 				bn_mod(r, x, n);
 			} while (bn_is_zero(r));
 
-			if (!hash) {
-				md_map(h, msg, len);
-				msg = h;
-				len = RLC_MD_LEN;
-			}
-			if (8 * len > bn_bits(n)) {
-				len = RLC_CEIL(bn_bits(n), 8);
-				bn_read_bin(e, msg, len);
-				bn_rsh(e, e, 8 * len - bn_bits(n));
-			} else {
-				bn_read_bin(e, msg, len);
-			}
-
 			bn_mul(s, d, r);
 			bn_mod(s, s, n);
 			bn_add(s, s, e);
@@ -124,7 +143,6 @@ int cp_ecdsa_sig(bn_t r, bn_t s, uint8_t *msg, int len, int hash, bn_t d) {
 int cp_ecdsa_ver(bn_t r, bn_t s, uint8_t *msg, int len, int hash, ec_t q) {
 	bn_t n, k, e, v;
 	ec_t p;
-	uint8_t h[RLC_MD_LEN];
 	int cmp, result = 0;
 
 	bn_null(n);
@@ -146,20 +164,7 @@ int cp_ecdsa_ver(bn_t r, bn_t s, uint8_t *msg, int len, int hash, ec_t q) {
 				!bn_is_zero(r) && !bn_is_zero(s) && ec_on_curve(q)) {
 			if (bn_cmp(r, n) == RLC_LT && bn_cmp(s, n) == RLC_LT) {
 				bn_mod_inv(k, s, n);
-
-				if (!hash) {
-					md_map(h, msg, len);
-					msg = h;
-					len = RLC_MD_LEN;
-				}
-
-				if (8 * len > bn_bits(n)) {
-					len = RLC_CEIL(bn_bits(n), 8);
-					bn_read_bin(e, msg, len);
-					bn_rsh(e, e, 8 * len - bn_bits(n));
-				} else {
-					bn_read_bin(e, msg, len);
-				}
+				ecdsa_msg(e, msg, len, hash, n);
 
 				bn_mul(e, e, k);
 				bn_mod(e, e, n);
@@ -196,3 +201,151 @@ int cp_ecdsa_ver(bn_t r, bn_t s, uint8_t *msg, int len, int hash, ec_t q) {
 	}
 	return result;
 }
+
+int cp_ecdsa_ver_batch(int *ver, bn_t r[], bn_t s[], uint8_t *msg[],
+		int len[], int hash, ec_t q[], ec_t p[], int m) {
+	bn_t n, e, *u = RLC_ALLOCA(bn_t, 2 * m), *z = NULL;
+	ec_t t, *_p = NULL;
+	int i, flag, result = 1;
+
+	if (m <= 0) {
+		RLC_FREE(u);
+		return 1;
+	}
+
+	if (p != NULL) {
+		z = RLC_ALLOCA(bn_t, 2 * m + 1);
+		_p = RLC_ALLOCA(ec_t, 2 * m + 1);
+	}
+
+	bn_null(n);
+	bn_null(e);
+	ec_null(t);
+
+	RLC_TRY {
+		bn_new(n);
+		bn_new(e);
+		ec_new(t);
+		if (u == NULL || (p != NULL && (z == NULL || _p == NULL))) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < 2 * m; i++) {
+			bn_null(u[i]);
+			bn_new(u[i]);
+		}
+		if (p != NULL) {
+			for (i = 0; i <= 2 * m; i++) {
+				bn_null(z[i]);
+				ec_null(_p[i]);
+				bn_new(z[i]);
+				ec_new(_p[i]);
+			}
+		}
+
+		ec_curve_get_ord(n);
+
+		/* Invert all the s_i at once, replacing invalid ones by 1. */
+		for (i = 0; i < m; i++) {
+			ver[i] = (bn_sign(r[i]) == RLC_POS && bn_sign(s[i]) == RLC_POS &&
+					!bn_is_zero(r[i]) && !bn_is_zero(s[i]) &&
+					bn_cmp(r[i], n) == RLC_LT && bn_cmp(s[i], n) == RLC_LT &&
+					ec_on_curve(q[i]));
+			if (ver[i]) {
+				bn_copy(u[m + i], s[i]);
+			} else {
+				bn_set_dig(u[m + i], 1);
+			}
+		}
+		bn_mod_inv_sim(u + m, (const bn_t *)(u + m), n, m);
+
+		/* Compute u_1 = e/s in u[i] and u_2 = r/s in u[m + i]. */
+		for (i = 0; i < m; i++) {
+			if (ver[i]) {
+				ecdsa_msg(e, msg[i], len[i], hash, n);
+				bn_mul(u[i], e, u[m + i]);
+				bn_mod(u[i], u[i], n);
+				bn_mul(u[m + i], r[i], u[m + i]);
+				bn_mod(u[m + i], u[m + i], n);
+			}
+		}
+
+		flag = 0;
+		if (p != NULL) {
+			/* Check \Sum z_i(u_1,iG + u_2,iQ_i - R_i) = 0 for random z_i. */
+			flag = 1;
+			ec_curve_get_gen(_p[0]);
+			bn_zero(z[0]);
+			for (i = 0; i < m; i++) {
+				ec_copy(_p[1 + i], q[i]);
+				ec_copy(_p[1 + m + i], p[i]);
+				bn_zero(z[1 + i]);
+				bn_zero(z[1 + m + i]);
+				if (!ver[i]) {
+					continue;
+				}
+				if (!ec_on_curve(p[i]) || ec_is_infty(p[i])) {
+					flag = 0;
+					continue;
+				}
+				ec_norm(t, p[i]);
+				ec_get_x(e, t);
+				bn_mod(e, e, n);
+				if (bn_cmp(e, r[i]) != RLC_EQ) {
+					flag = 0;
+					continue;
+				}
+				/* Draw a multiplier of |n|/2 bits, 128 bits for 256-bit orders,
+				 * so an invalid signature survives with probability 2^{-|n|/2}. */
+				bn_rand(e, RLC_POS, bn_bits(n) / 2);
+				bn_mul(z[1 + i], e, u[m + i]);
+				bn_mod(z[1 + i], z[1 + i], n);
+				bn_sub(z[1 + m + i], n, e);
+				bn_mul(e, e, u[i]);
+				bn_add(z[0], z[0], e);
+				bn_mod(z[0], z[0], n);
+			}
+			if (flag) {
+				ec_mul_sim_lot(t, _p, (const bn_t *)z, 2 * m + 1);
+				flag = ec_is_infty(t);
+			}
+		}
+
+		/* Verify one by one if there are no points or the batch failed. */
+		if (!flag) {
+			for (i = 0; i < m; i++) {
+				if (ver[i]) {
+					ec_mul_sim_gen(t, u[i], q[i], u[m + i]);
+					ec_get_x(e, t);
+					bn_mod(e, e, n);
+					ver[i] = !ec_is_infty(t) && bn_cmp(e, r[i]) == RLC_EQ;
+				}
+			}
+		}
+
+		for (i = 0; i < m; i++) {
+			result &= ver[i];
+		}
+	}
+	RLC_CATCH_ANY {
+		result = 0;
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(n);
+		bn_free(e);
+		ec_free(t);
+		for (i = 0; i < 2 * m; i++) {
+			bn_free(u[i]);
+		}
+		if (p != NULL) {
+			for (i = 0; i <= 2 * m; i++) {
+				bn_free(z[i]);
+				ec_free(_p[i]);
+			}
+		}
+		RLC_FREE(u);
+		RLC_FREE(z);
+		RLC_FREE(_p);
+	}
+	return result;
+}
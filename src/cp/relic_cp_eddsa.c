@@ -0,0 +1,490 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2011 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the Ed25519 signature scheme as specified in RFC 8032.
+ *
+ * @ingroup cp
+ */
+
+#include "relic.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Reverses the byte order of a buffer in place.
+ *
+ * @param[in,out] buf		- the buffer.
+ * @param[in] len			- the buffer length in bytes.
+ */
+static void eddsa_rev(uint8_t *buf, int len) {
+	for (int i = 0; i < len / 2; i++) {
+		uint8_t t = buf[i];
+		buf[i] = buf[len - 1 - i];
+		buf[len - 1 - i] = t;
+	}
+}
+
+/**
+ * Hashes a buffer with SHA-512 and reduces the little-endian digest modulo
+ * the group order.
+ *
+ * @param[out] k			- the resulting integer.
+ * @param[in] buf			- the buffer to hash.
+ * @param[in] len			- the buffer length in bytes.
+ * @param[in] n				- the group order.
+ */
+static void eddsa_hash(bn_t k, const uint8_t *buf, int len, const bn_t n) {
+	uint8_t h[RLC_MD_LEN_SH512];
+
+	md_map_sh512(h, buf, len);
+	eddsa_rev(h, RLC_MD_LEN_SH512);
+	bn_read_bin(k, h, RLC_MD_LEN_SH512);
+	bn_mod(k, k, n);
+}
+
+/**
+ * Expands a private key into the secret scalar and the nonce prefix.
+ *
+ * @param[out] s			- the secret scalar.
+ * @param[out] prefix		- the nonce prefix.
+ * @param[in] prv			- the private key.
+ */
+static void eddsa_exp(bn_t s, uint8_t *prefix, const uint8_t *prv) {
+	uint8_t h[RLC_MD_LEN_SH512];
+
+	md_map_sh512(h, prv, RLC_EDDSA_LEN);
+	h[0] &= 0xF8;
+	h[RLC_EDDSA_LEN - 1] &= 0x7F;
+	h[RLC_EDDSA_LEN - 1] |= 0x40;
+	memcpy(prefix, h + RLC_EDDSA_LEN, RLC_EDDSA_LEN);
+	eddsa_rev(h, RLC_EDDSA_LEN);
+	bn_read_bin(s, h, RLC_EDDSA_LEN);
+}
+
+/**
+ * Encodes a point as the little-endian y-coordinate with the sign of the
+ * x-coordinate in the most significant bit.
+ *
+ * @param[out] bin			- the encoding.
+ * @param[in] p				- the point to encode.
+ */
+static void eddsa_write(uint8_t *bin, const ed_t p) {
+	uint8_t x[RLC_FP_BYTES];
+	ed_t t;
+
+	ed_null(t);
+
+	RLC_TRY {
+		ed_new(t);
+
+		ed_norm(t, p);
+		fp_write_bin(x, RLC_FP_BYTES, t->x);
+		fp_write_bin(bin, RLC_EDDSA_LEN, t->y);
+		eddsa_rev(bin, RLC_EDDSA_LEN);
+		bin[RLC_EDDSA_LEN - 1] |= (x[RLC_FP_BYTES - 1] & 1) << 7;
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ed_free(t);
+	}
+}
+
+/**
+ * Decodes a point, rejecting non-canonical y-coordinates and encodings that do
+ * not correspond to a curve point.
+ *
+ * @param[out] p			- the decoded point.
+ * @param[in] bin			- the encoding.
+ * @return a boolean value indicating if the encoding is valid.
+ */
+static int eddsa_read(ed_t p, const uint8_t *bin) {
+	uint8_t y[RLC_EDDSA_LEN];
+	int b, result = 0;
+	bn_t k, n;
+	fp_t u, v;
+
+	bn_null(k);
+	bn_null(n);
+	fp_null(u);
+	fp_null(v);
+
+	RLC_TRY {
+		bn_new(k);
+		bn_new(n);
+		fp_new(u);
+		fp_new(v);
+
+		memcpy(y, bin, RLC_EDDSA_LEN);
+		b = y[RLC_EDDSA_LEN - 1] >> 7;
+		y[RLC_EDDSA_LEN - 1] &= 0x7F;
+		eddsa_rev(y, RLC_EDDSA_LEN);
+		bn_read_bin(k, y, RLC_EDDSA_LEN);
+		bn_read_raw(n, fp_prime_get(), RLC_FP_DIGS);
+
+		if (bn_cmp(k, n) == RLC_LT) {
+			fp_prime_conv(p->y, k);
+			/* x = +/- sqrt((y^2 - 1) / (dy^2 - a)). */
+			fp_sqr(u, p->y);
+			fp_mul(v, u, core_get()->ed_d);
+			fp_sub(v, v, core_get()->ed_a);
+			fp_sub_dig(u, u, 1);
+			fp_inv(v, v);
+			fp_mul(u, u, v);
+			if (fp_srt(p->x, u) && !(fp_is_zero(p->x) && b)) {
+				fp_prime_back(k, p->x);
+				if (bn_get_bit(k, 0) != b) {
+					fp_neg(p->x, p->x);
+				}
+				fp_set_dig(p->z, 1);
+#if ED_ADD == EXTND
+				fp_mul(p->t, p->x, p->y);
+#endif
+				p->coord = BASIC;
+				result = 1;
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(k);
+		bn_free(n);
+		fp_free(u);
+		fp_free(v);
+	}
+	return result;
+}
+
+/**
+ * Decodes a signature and computes its challenge k = H(R || A || M).
+ *
+ * @param[out] r			- the point R.
+ * @param[out] s			- the integer S.
+ * @param[out] a			- the public key A.
+ * @param[out] k			- the challenge.
+ * @param[in] sig			- the signature.
+ * @param[in] msg			- the signed message.
+ * @param[in] len			- the message length in bytes.
+ * @param[in] pub			- the public key.
+ * @param[in] n				- the group order.
+ * @return a boolean value indicating if the signature is well-formed.
+ */
+static int eddsa_chk(ed_t r, bn_t s, ed_t a, bn_t k, const uint8_t *sig,
+		const uint8_t *msg, int len, const uint8_t *pub, const bn_t n) {
+	uint8_t *m = RLC_ALLOCA(uint8_t, len + 2 * RLC_EDDSA_LEN);
+	uint8_t t[RLC_EDDSA_LEN];
+	int result = 0;
+
+	RLC_TRY {
+		if (m == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+
+		memcpy(t, sig + RLC_EDDSA_LEN, RLC_EDDSA_LEN);
+		eddsa_rev(t, RLC_EDDSA_LEN);
+		bn_read_bin(s, t, RLC_EDDSA_LEN);
+
+		if (bn_cmp(s, n) == RLC_LT && eddsa_read(r, sig) &&
+				eddsa_read(a, pub)) {
+			memcpy(m, sig, RLC_EDDSA_LEN);
+			memcpy(m + RLC_EDDSA_LEN, pub, RLC_EDDSA_LEN);
+			memcpy(m + 2 * RLC_EDDSA_LEN, msg, len);
+			eddsa_hash(k, m, len + 2 * RLC_EDDSA_LEN, n);
+			result = 1;
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		RLC_FREE(m);
+	}
+	return result;
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+int cp_eddsa_gen(uint8_t *pub, uint8_t *prv) {
+	uint8_t prefix[RLC_EDDSA_LEN];
+	bn_t s;
+	ed_t a;
+	int result = RLC_OK;
+
+	bn_null(s);
+	ed_null(a);
+
+	RLC_TRY {
+		bn_new(s);
+		ed_new(a);
+
+		if (ed_param_get() != CURVE_ED25519) {
+			RLC_THROW(ERR_NO_CONFIG);
+		}
+
+		rand_bytes(prv, RLC_EDDSA_LEN);
+		eddsa_exp(s, prefix, prv);
+		ed_mul_gen(a, s);
+		eddsa_write(pub, a);
+	}
+	RLC_CATCH_ANY {
+		result = RLC_ERR;
+	}
+	RLC_FINALLY {
+		bn_free(s);
+		ed_free(a);
+	}
+	return result;
+}
+
+int cp_eddsa_sig(uint8_t *sig, uint8_t *msg, int len, uint8_t *prv,
+		uint8_t *pub) {
+	uint8_t *m = RLC_ALLOCA(uint8_t, len + 2 * RLC_EDDSA_LEN);
+	uint8_t a[RLC_EDDSA_LEN];
+	bn_t n, r, s, k;
+	ed_t p;
+	int result = RLC_OK;
+
+	bn_null(n);
+	bn_null(r);
+	bn_null(s);
+	bn_null(k);
+	ed_null(p);
+
+	RLC_TRY {
+		bn_new(n);
+		bn_new(r);
+		bn_new(s);
+		bn_new(k);
+		ed_new(p);
+		if (m == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+
+		if (ed_param_get() != CURVE_ED25519) {
+			RLC_THROW(ERR_NO_CONFIG);
+		}
+
+		ed_curve_get_ord(n);
+		/* The nonce is r = H(prefix || M). */
+		eddsa_exp(s, m + RLC_EDDSA_LEN, prv);
+		/* Signing under a key not matching prv would leak it. */
+		ed_mul_gen(p, s);
+		eddsa_write(a, p);
+		if (util_cmp_const(a, pub, RLC_EDDSA_LEN) != RLC_EQ) {
+			RLC_THROW(ERR_NO_VALID);
+		}
+		memcpy(m + 2 * RLC_EDDSA_LEN, msg, len);
+		eddsa_hash(r, m + RLC_EDDSA_LEN, len + RLC_EDDSA_LEN, n);
+
+		/* Then R = rG and k = H(R || A || M). */
+		ed_mul_gen(p, r);
+		eddsa_write(m, p);
+		memcpy(m + RLC_EDDSA_LEN, a, RLC_EDDSA_LEN);
+		eddsa_hash(k, m, len + 2 * RLC_EDDSA_LEN, n);
+
+		/* Finally, S = (r + k * s) mod n. */
+		bn_mul(k, k, s);
+		bn_add(k, k, r);
+		bn_mod(k, k, n);
+
+		memcpy(sig, m, RLC_EDDSA_LEN);
+		bn_write_bin(sig + RLC_EDDSA_LEN, RLC_EDDSA_LEN, k);
+		eddsa_rev(sig + RLC_EDDSA_LEN, RLC_EDDSA_LEN);
+	}
+	RLC_CATCH_ANY {
+		result = RLC_ERR;
+	}
+	RLC_FINALLY {
+		bn_free(n);
+		bn_free(r);
+		bn_free(s);
+		bn_free(k);
+		ed_free(p);
+		RLC_FREE(m);
+	}
+	return result;
+}
+
+int cp_eddsa_ver(uint8_t *sig, uint8_t *msg, int len, uint8_t *pub) {
+	bn_t n, s, k;
+	ed_t r, a, p;
+	int result = 0;
+
+	bn_null(n);
+	bn_null(s);
+	bn_null(k);
+	ed_null(r);
+	ed_null(a);
+	ed_null(p);
+
+	RLC_TRY {
+		bn_new(n);
+		bn_new(s);
+		bn_new(k);
+		ed_new(r);
+		ed_new(a);
+		ed_new(p);
+
+		if (ed_param_get() != CURVE_ED25519) {
+			RLC_THROW(ERR_NO_CONFIG);
+		}
+
+		ed_curve_get_ord(n);
+		if (eddsa_chk(r, s, a, k, sig, msg, len, pub, n)) {
+			/* Check that 8(SG - kA - R) = 0. */
+			bn_sub(k, n, k);
+			ed_mul_sim_gen(p, s, a, k);
+			ed_sub(p, p, r);
+			ed_dbl(p, p);
+			ed_dbl(p, p);
+			ed_dbl(p, p);
+			result = ed_is_infty(p);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(n);
+		bn_free(s);
+		bn_free(k);
+		ed_free(r);
+		ed_free(a);
+		ed_free(p);
+	}
+	return result;
+}
+
+int cp_eddsa_ver_batch(int *ver, uint8_t *sig[], uint8_t *msg[], int len[],
+		uint8_t *pub[], int m) {
+	bn_t n, e, s, *z = RLC_ALLOCA(bn_t, 2 * m + 1);
+	ed_t t, *p = RLC_ALLOCA(ed_t, 2 * m + 1);
+	int i, flag, result = 1;
+
+	if (m <= 0) {
+		RLC_FREE(z);
+		RLC_FREE(p);
+		return 1;
+	}
+
+	bn_null(n);
+	bn_null(e);
+	bn_null(s);
+	ed_null(t);
+
+	RLC_TRY {
+		bn_new(n);
+		bn_new(e);
+		bn_new(s);
+		ed_new(t);
+		if (z == NULL || p == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i <= 2 * m; i++) {
+			bn_null(z[i]);
+			ed_null(p[i]);
+			bn_new(z[i]);
+			ed_new(p[i]);
+		}
+
+		if (ed_param_get() != CURVE_ED25519) {
+			RLC_THROW(ERR_NO_CONFIG);
+		}
+
+		ed_curve_get_ord(n);
+
+		/* Check 8(\Sum z_i(S_iG - R_i - k_iA_i)) = 0 for random z_i. */
+		flag = 0;
+		ed_curve_get_gen(p[0]);
+		bn_zero(z[0]);
+		for (i = 0; i < m; i++) {
+			ver[i] = eddsa_chk(p[1 + i], s, p[1 + m + i], e, sig[i], msg[i],
+					len[i], pub[i], n);
+			if (!ver[i]) {
+				ed_set_infty(p[1 + i]);
+				ed_set_infty(p[1 + m + i]);
+				bn_zero(z[1 + i]);
+				bn_zero(z[1 + m + i]);
+				continue;
+			}
+			flag = 1;
+			ed_neg(p[1 + i], p[1 + i]);
+			ed_neg(p[1 + m + i], p[1 + m + i]);
+			/* The z_i have |l|/2 = 126 bits for the 253-bit Ed25519 order l,
+			 * so an invalid signature passes with probability 2^{-126}. */
+			bn_rand(z[1 + i], RLC_POS, bn_bits(n) / 2);
+			bn_mul(z[1 + m + i], z[1 + i], e);
+			bn_mod(z[1 + m + i], z[1 + m + i], n);
+			bn_mul(s, s, z[1 + i]);
+			bn_add(z[0], z[0], s);
+			bn_mod(z[0], z[0], n);
+		}
+		if (flag) {
+			ed_mul_sim_lot(t, (const ed_t *)p, (const bn_t *)z, 2 * m + 1);
+			ed_dbl(t, t);
+			ed_dbl(t, t);
+			ed_dbl(t, t);
+			flag = ed_is_infty(t);
+		}
+
+		/* Verify one by one if the batch failed to find the invalid ones. */
+		if (!flag) {
+			for (i = 0; i < m; i++) {
+				if (ver[i]) {
+					ver[i] = cp_eddsa_ver(sig[i], msg[i], len[i], pub[i]);
+				}
+			}
+		}
+
+		for (i = 0; i < m; i++) {
+			result &= ver[i];
+		}
+	}
+	RLC_CATCH_ANY {
+		result = 0;
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(n);
+		bn_free(e);
+		bn_free(s);
+		ed_free(t);
+		for (i = 0; i <= 2 * m; i++) {
+			bn_free(z[i]);
+			ed_free(p[i]);
+		}
+		RLC_FREE(z);
+		RLC_FREE(p);
+	}
+	return result;
+}
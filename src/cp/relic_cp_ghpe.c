@@ -78,41 +78,66 @@ int cp_ghpe_gen(bn_t pub, bn_t prv, int bits) {
 	return result;
 }
 
-int cp_ghpe_enc(bn_t c, bn_t m, bn_t pub, int s) {
-	bn_t g, r, t;
+int cp_ghpe_ctx(mod_t ctx, bn_t pub, int s) {
+	bn_t t;
 	int result = RLC_OK;
 
-	bn_null(g);
-	bn_null(r);
+	if (pub == NULL || s < 1) {
+		return RLC_ERR;
+	}
+
 	bn_null(t);
 
+	RLC_TRY {
+		bn_new(t);
+
+		/* t = n^(s + 1). */
+		bn_copy(t, pub);
+		for (int i = 0; i < s; i++) {
+			bn_mul(t, t, pub);
+		}
+		bn_mod_ctx(ctx, t);
+	}
+	RLC_CATCH_ANY {
+		result = RLC_ERR;
+	}
+	RLC_FINALLY {
+		bn_free(t);
+	}
+
+	return result;
+}
+
+int cp_ghpe_enc_ctx(bn_t c, bn_t m, bn_t pub, int s, mod_t ctx) {
+	bn_t g, r;
+	int result = RLC_OK;
+
 	if (pub == NULL || bn_bits(m) > s * bn_bits(pub)) {
 		return RLC_ERR;
 	}
 
+	bn_null(g);
+	bn_null(r);
+
 	RLC_TRY {
 		bn_new(g);
 		bn_new(r);
-		bn_new(t);
 
 		/* Generate r in Z_n^*. */
 		bn_rand_mod(r, pub);
 		/* Compute c = (g^m)(r^n) mod n^2. */
 		bn_add_dig(g, pub, 1);
 
-		/* t = n^(s + 1). */
-		bn_copy(t, pub);
-		for (int i = 0; i < s; i++) {
-			bn_mul(t, t, pub);
-		}
-
-		bn_mxp(c, g, m, t);
+		/* Share the precomputation and stay in Montgomery form. */
+		bn_mod_ctx_conv(g, g, ctx);
+		bn_mxp_ctx(c, g, m, ctx);
+		bn_mod_ctx_conv(r, r, ctx);
 		for (int i = 0; i < s; i++) {
-			bn_mxp(r, r, pub, t);
+			bn_mxp_ctx(r, r, pub, ctx);
 		}
 
-		bn_mul(c, c, r);
-		bn_mod(c, c, t);
+		bn_mod_ctx_mul(c, c, r, ctx);
+		bn_mod_ctx_back(c, c, ctx);
 	}
 	RLC_CATCH_ANY {
 		result = RLC_ERR;
@@ -120,7 +145,34 @@ int cp_ghpe_enc(bn_t c, bn_t m, bn_t pub, int s) {
 	RLC_FINALLY {
 		bn_free(g);
 		bn_free(r);
-		bn_free(t);
+	}
+
+	return result;
+}
+
+int cp_ghpe_enc(bn_t c, bn_t m, bn_t pub, int s) {
+	mod_t ctx;
+	int result = RLC_OK;
+
+	if (pub == NULL || bn_bits(m) > s * bn_bits(pub)) {
+		return RLC_ERR;
+	}
+
+	mod_null(ctx);
+
+	RLC_TRY {
+		mod_new(ctx);
+
+		result = cp_ghpe_ctx(ctx, pub, s);
+		if (result == RLC_OK) {
+			result = cp_ghpe_enc_ctx(c, m, pub, s, ctx);
+		}
+	}
+	RLC_CATCH_ANY {
+		result = RLC_ERR;
+	}
+	RLC_FINALLY {
+		mod_free(ctx);
 	}
 
 	return result;
@@ -64,7 +64,7 @@ int cp_pbpsi_gen(bn_t sk, g1_t ss, g2_t s[], int m) {
 
 int cp_pbpsi_ask(g2_t d[], bn_t r, bn_t x[], g2_t s[], int m) {
 	int i, result = RLC_OK;
-	bn_t t, q, *p = RLC_ALLOCA(bn_t, m + 1);
+	bn_t t, q, *p = RLC_MALLOC(bn_t, m + 1);
 
 	bn_null(q);
 	bn_null(t);
@@ -85,13 +85,13 @@ int cp_pbpsi_ask(g2_t d[], bn_t r, bn_t x[], g2_t s[], int m) {
 		if (m == 0) {
 			g2_mul_gen(d[0], r);
 		} else {
-			bn_lag(p, x, q, m);
+			bn_lag_fast(p, x, q, m);
 			g2_mul_sim_lot(d[0], s, p, m + 1);
 			g2_mul(d[0], d[0], r);
 			for (i = 0; i < m; i++) {
 				bn_copy(t, x[i]);
 				bn_copy(x[i], x[m - 1]);
-				bn_lag(p, x, q, m - 1);
+				bn_lag_fast(p, x, q, m - 1);
 				g2_mul_sim_lot(d[i + 1], s, p, m);
 				g2_mul(d[i + 1], d[i + 1], r);
 				bn_copy(x[i], t);
@@ -104,10 +104,10 @@ int cp_pbpsi_ask(g2_t d[], bn_t r, bn_t x[], g2_t s[], int m) {
 	RLC_FINALLY {
 		bn_free(q);
 		bn_free(t);
-		for (i = 0; i <= m; i++) {
+		for (i = 0; p != NULL && i <= m; i++) {
 			bn_free(p[i]);
 		}
-		RLC_FREE(p);
+		alloc_free((void *)p);
 	}
 	return result;
 }
@@ -97,44 +97,94 @@ int cp_phpe_add(bn_t r, bn_t c, bn_t d, bn_t pub) {
 	return result;
 }
 
-int cp_phpe_enc(bn_t c, bn_t m, bn_t pub) {
-	bn_t g, r, s;
+int cp_phpe_ctx(mod_t ctx, bn_t pub) {
+	bn_t s;
 	int result = RLC_OK;
 
-	bn_null(g);
-	bn_null(r);
+	if (pub == NULL) {
+		return RLC_ERR;
+	}
+
 	bn_null(s);
 
+	RLC_TRY {
+		bn_new(s);
+
+		bn_sqr(s, pub);
+		bn_mod_ctx(ctx, s);
+	}
+	RLC_CATCH_ANY {
+		result = RLC_ERR;
+	}
+	RLC_FINALLY {
+		bn_free(s);
+	}
+
+	return result;
+}
+
+int cp_phpe_enc_ctx(bn_t c, bn_t m, bn_t pub, mod_t ctx) {
+	bn_t r;
+	int result = RLC_OK;
+
 	if (pub == NULL || bn_bits(m) > bn_bits(pub)) {
 		return RLC_ERR;
 	}
 
+	bn_null(r);
+
 	RLC_TRY {
-		bn_new(g);
 		bn_new(r);
-		bn_new(s);
 
 		/* Generate r in Z_n^*. */
 		bn_rand_mod(r, pub);
 		/* Compute c = (g^m)(r^n) mod n^2.
 			with g=1+n, this is also (1+nm)r^n mod n^2.
 		*/
-		bn_add_dig(g, pub, 1);
-		bn_sqr(s, pub);
 		bn_mul(c, pub, m);
-        bn_add_dig(c, c, 1);
-		bn_mod(c, c, s);
-		bn_mxp(r, r, pub, s);
-		bn_mul(c, c, r);
-		bn_mod(c, c, s);
+		bn_add_dig(c, c, 1);
+		/* Here 1 + nm is already reduced, unless m >= n. */
+		if (bn_cmp(c, ctx->m) != RLC_LT) {
+			bn_mod_ctx_rdc(c, c, ctx);
+		}
+		/* Keep r^n in Montgomery form, so the product comes out of it. */
+		bn_mod_ctx_conv(r, r, ctx);
+		bn_mxp_ctx(r, r, pub, ctx);
+		bn_mod_ctx_mul(c, c, r, ctx);
 	}
 	RLC_CATCH_ANY {
 		result = RLC_ERR;
 	}
 	RLC_FINALLY {
-		bn_free(g);
 		bn_free(r);
-		bn_free(s);
+	}
+
+	return result;
+}
+
+int cp_phpe_enc(bn_t c, bn_t m, bn_t pub) {
+	mod_t ctx;
+	int result = RLC_OK;
+
+	if (pub == NULL || bn_bits(m) > bn_bits(pub)) {
+		return RLC_ERR;
+	}
+
+	mod_null(ctx);
+
+	RLC_TRY {
+		mod_new(ctx);
+
+		result = cp_phpe_ctx(ctx, pub);
+		if (result == RLC_OK) {
+			result = cp_phpe_enc_ctx(c, m, pub, ctx);
+		}
+	}
+	RLC_CATCH_ANY {
+		result = RLC_ERR;
+	}
+	RLC_FINALLY {
+		mod_free(ctx);
 	}
 
 	return result;
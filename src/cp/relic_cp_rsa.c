@@ -571,6 +571,217 @@ static int pad_pkcs2(bn_t m, int *p_len, int m_len, int k_len, int operation) {
 
 #endif
 
+/**
+ * Pads a message for signing with the RSA private key, hashing it first if
+ * the flag is zero.
+ *
+ * @param[out] eb			- the padded message.
+ * @param[in] msg			- the message to sign.
+ * @param[in] msg_len		- the number of bytes to sign.
+ * @param[in] hash			- the flag to indicate the message format.
+ * @param[in] prv			- the private key.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+static int rsa_sig_pad(bn_t eb, uint8_t *msg, int msg_len, int hash,
+		rsa_t prv) {
+	bn_t m;
+	int pad_len, size, result = RLC_ERR;
+	uint8_t h[RLC_MD_LEN];
+
+	if (prv == NULL || msg_len < 0) {
+		return RLC_ERR;
+	}
+
+	pad_len = (!hash ? RLC_MD_LEN : msg_len);
+
+#if CP_RSAPD == PKCS2
+	size = bn_bits(prv->crt->n) - 1;
+	size = (size / 8) + (size % 8 > 0);
+	if (pad_len > (size - 2)) {
+		return RLC_ERR;
+	}
+#else
+	size = bn_size_bin(prv->crt->n);
+	if (pad_len > (size - RSA_PAD_LEN)) {
+		return RLC_ERR;
+	}
+#endif
+
+	bn_null(m);
+
+	RLC_TRY {
+		bn_new(m);
+
+		bn_zero(m);
+		bn_zero(eb);
+
+		int operation = (!hash ? RSA_SIG : RSA_SIG_HASH);
+
+#if CP_RSAPD == BASIC
+		if (pad_basic(eb, &pad_len, pad_len, size, operation) == RLC_OK) {
+#elif CP_RSAPD == PKCS1
+		if (pad_pkcs1(eb, &pad_len, pad_len, size, operation) == RLC_OK) {
+#elif CP_RSAPD == PKCS2
+		if (pad_pkcs2(eb, &pad_len, pad_len, size, operation) == RLC_OK) {
+#endif
+			if (!hash) {
+				md_map(h, msg, msg_len);
+				bn_read_bin(m, h, RLC_MD_LEN);
+				bn_add(eb, eb, m);
+			} else {
+				bn_read_bin(m, msg, msg_len);
+				bn_add(eb, eb, m);
+			}
+
+#if CP_RSAPD == PKCS2
+			pad_pkcs2(eb, &pad_len, bn_bits(prv->crt->n), size, RSA_SIG_FIN);
+#endif
+			result = RLC_OK;
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(m);
+	}
+
+	return result;
+}
+
+/**
+ * Removes the encryption padding from a decrypted message.
+ *
+ * @param[out] out			- the output buffer.
+ * @param[in, out] out_len	- the buffer capacity and number of bytes written.
+ * @param[in,out] eb		- the decrypted message.
+ * @param[in] size			- the key length in bytes.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+static int rsa_dec_pad(uint8_t *out, int *out_len, bn_t eb, int size) {
+	int pad_len, result = RLC_ERR;
+
+#if CP_RSAPD == BASIC
+	if (pad_basic(eb, &pad_len, size, size, RSA_DEC) == RLC_OK) {
+#elif CP_RSAPD == PKCS1
+	if (pad_pkcs1(eb, &pad_len, size, size, RSA_DEC) == RLC_OK) {
+#elif CP_RSAPD == PKCS2
+	if (pad_pkcs2(eb, &pad_len, size, size, RSA_DEC) == RLC_OK) {
+#endif
+		size = size - pad_len;
+
+		if (size <= *out_len) {
+			memset(out, 0, size);
+			bn_write_bin(out, size, eb);
+			*out_len = size;
+			result = RLC_OK;
+		}
+	}
+
+	return result;
+}
+
+/**
+ * Applies the RSA private operation to at most RLC_BN_LOT integers, building
+ * the Montgomery contexts of the modulus (or of its prime factors, if CP_CRT is
+ * on) only once and interleaving the exponentiations sharing the same exponent.
+ * The interleaved exponentiation uses sliding windows, so other choices of
+ * BN_MXP exponentiate each integer on its own with bn_mxp().
+ *
+ * @param[in,out] eb		- the integers to exponentiate.
+ * @param[in] n				- the number of integers.
+ * @param[in] prv			- the private key.
+ */
+static void rsa_prv_many(bn_t *eb, int n, rsa_t prv) {
+#if BN_MXP != SLIDE
+	for (int i = 0; i < n; i++) {
+#if !defined(CP_CRT)
+		bn_mxp(eb[i], eb[i], prv->d, prv->crt->n);
+#else
+		bn_mxp_crt(eb[i], eb[i], prv->crt->dp, prv->crt->dq, prv->crt, 0);
+#endif
+	}
+#elif !defined(CP_CRT)
+	mod_t ctx;
+	int i;
+
+	mod_null(ctx);
+
+	RLC_TRY {
+		mod_new(ctx);
+
+		bn_mod_ctx(ctx, prv->crt->n);
+		for (i = 0; i < n; i++) {
+			bn_mod_ctx_conv(eb[i], eb[i], ctx);
+		}
+		bn_mxp_ctx_many(eb, (const bn_t *)eb, prv->d, ctx, n);
+		for (i = 0; i < n; i++) {
+			bn_mod_ctx_back(eb[i], eb[i], ctx);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		mod_free(ctx);
+	}
+#else
+	bn_t t[RLC_BN_LOT], u[RLC_BN_LOT];
+	mod_t p, q;
+	int i;
+
+	mod_null(p);
+	mod_null(q);
+	for (i = 0; i < n; i++) {
+		bn_null(t[i]);
+		bn_null(u[i]);
+	}
+
+	RLC_TRY {
+		mod_new(p);
+		mod_new(q);
+		for (i = 0; i < n; i++) {
+			bn_new(t[i]);
+			bn_new(u[i]);
+		}
+
+		bn_mod_ctx(p, prv->crt->p);
+		bn_mod_ctx(q, prv->crt->q);
+		for (i = 0; i < n; i++) {
+			bn_mod_ctx_conv(t[i], eb[i], p);
+			bn_mod_ctx_conv(u[i], eb[i], q);
+		}
+		/* m1 = a^dP mod p, m2 = a^dQ mod q. */
+		bn_mxp_ctx_many(t, (const bn_t *)t, prv->crt->dp, p, n);
+		bn_mxp_ctx_many(u, (const bn_t *)u, prv->crt->dq, q, n);
+		for (i = 0; i < n; i++) {
+			bn_mod_ctx_back(t[i], t[i], p);
+			bn_mod_ctx_back(u[i], u[i], q);
+			/* m = m2 + q * (qInv(m1 - m2) mod p). */
+			bn_sub(eb[i], t[i], u[i]);
+			while (bn_sign(eb[i]) == RLC_NEG) {
+				bn_add(eb[i], eb[i], prv->crt->p);
+			}
+			bn_mul(eb[i], eb[i], prv->crt->qi);
+			bn_mod(eb[i], eb[i], prv->crt->p);
+			bn_mul(eb[i], eb[i], prv->crt->q);
+			bn_add(eb[i], eb[i], u[i]);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		mod_free(p);
+		mod_free(q);
+		for (i = 0; i < n; i++) {
+			bn_free(t[i]);
+			bn_free(u[i]);
+		}
+	}
+#endif /* BN_MXP */
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -718,10 +929,9 @@ int cp_rsa_enc(uint8_t *out, int *out_len, uint8_t *in, int in_len, rsa_t pub) {
 }
 
 int cp_rsa_dec(uint8_t *out, int *out_len, uint8_t *in, int in_len, rsa_t prv) {
-	bn_t m, eb;
-	int size, pad_len, result = RLC_OK;
+	bn_t eb;
+	int size, result = RLC_OK;
 
-	bn_null(m);
 	bn_null(eb);
 
 	size = bn_size_bin(prv->crt->n);
@@ -731,7 +941,6 @@ int cp_rsa_dec(uint8_t *out, int *out_len, uint8_t *in, int in_len, rsa_t prv) {
 	}
 
 	RLC_TRY {
-		bn_new(m);
 		bn_new(eb);
 
 		bn_read_bin(eb, in, in_len);
@@ -741,95 +950,86 @@ int cp_rsa_dec(uint8_t *out, int *out_len, uint8_t *in, int in_len, rsa_t prv) {
 		bn_mxp_crt(eb, eb, prv->crt->dp, prv->crt->dq, prv->crt, 0);
 #endif /* CP_CRT */
 
-#if CP_RSAPD == BASIC
-		if (pad_basic(eb, &pad_len, in_len, size, RSA_DEC) == RLC_OK) {
-#elif CP_RSAPD == PKCS1
-		if (pad_pkcs1(eb, &pad_len, in_len, size, RSA_DEC) == RLC_OK) {
-#elif CP_RSAPD == PKCS2
-		if (pad_pkcs2(eb, &pad_len, in_len, size, RSA_DEC) == RLC_OK) {
-#endif
-			size = size - pad_len;
-
-			if (size <= *out_len) {
-				memset(out, 0, size);
-				bn_write_bin(out, size, eb);
-				*out_len = size;
-			} else {
-				result = RLC_ERR;
-			}
-		} else {
-			result = RLC_ERR;
-		}
+		result = rsa_dec_pad(out, out_len, eb, size);
 	}
 	RLC_CATCH_ANY {
 		result = RLC_ERR;
 	}
 	RLC_FINALLY {
-		bn_free(m);
 		bn_free(eb);
 	}
 
 	return result;
 }
 
-int cp_rsa_sig(uint8_t *sig, int *sig_len, uint8_t *msg, int msg_len, int hash, rsa_t prv) {
-	bn_t m, eb;
-	int pad_len, size, result = RLC_OK;
-	uint8_t h[RLC_MD_LEN];
+int cp_rsa_dec_many(uint8_t *out[], int out_len[], uint8_t *in[],
+		const int in_len[], int n, rsa_t prv) {
+	bn_t eb[RLC_BN_LOT];
+	int i, j, m, size, result = RLC_OK;
 
-	if (prv == NULL || msg_len < 0) {
+	if (prv == NULL || n <= 0) {
 		return RLC_ERR;
 	}
 
-	pad_len = (!hash ? RLC_MD_LEN : msg_len);
-
-#if CP_RSAPD == PKCS2
-	size = bn_bits(prv->crt->n) - 1;
-	size = (size / 8) + (size % 8 > 0);
-	if (pad_len > (size - 2)) {
-		return RLC_ERR;
-	}
-#else
 	size = bn_size_bin(prv->crt->n);
-	if (pad_len > (size - RSA_PAD_LEN)) {
-		return RLC_ERR;
+	for (i = 0; i < n; i++) {
+		if (in_len[i] != size || in_len[i] < RSA_PAD_LEN) {
+			return RLC_ERR;
+		}
 	}
-#endif
 
-	bn_null(m);
-	bn_null(eb);
+	for (i = 0; i < RLC_BN_LOT; i++) {
+		bn_null(eb[i]);
+	}
 
 	RLC_TRY {
-		bn_new(m);
-		bn_new(eb);
+		for (i = 0; i < RLC_BN_LOT; i++) {
+			bn_new(eb[i]);
+		}
 
-		bn_zero(m);
-		bn_zero(eb);
+		/* Decrypt in lots to keep the working memory bounded. */
+		for (j = 0; j < n; j += RLC_BN_LOT) {
+			m = RLC_MIN(RLC_BN_LOT, n - j);
+			for (i = 0; i < m; i++) {
+				bn_read_bin(eb[i], in[j + i], in_len[j + i]);
+			}
 
-		int operation = (!hash ? RSA_SIG : RSA_SIG_HASH);
+			rsa_prv_many(eb, m, prv);
 
-#if CP_RSAPD == BASIC
-		if (pad_basic(eb, &pad_len, pad_len, size, operation) == RLC_OK) {
-#elif CP_RSAPD == PKCS1
-		if (pad_pkcs1(eb, &pad_len, pad_len, size, operation) == RLC_OK) {
-#elif CP_RSAPD == PKCS2
-		if (pad_pkcs2(eb, &pad_len, pad_len, size, operation) == RLC_OK) {
-#endif
-			if (!hash) {
-				md_map(h, msg, msg_len);
-				bn_read_bin(m, h, RLC_MD_LEN);
-				bn_add(eb, eb, m);
-			} else {
-				bn_read_bin(m, msg, msg_len);
-				bn_add(eb, eb, m);
+			for (i = 0; i < m; i++) {
+				if (rsa_dec_pad(out[j + i], &out_len[j + i], eb[i],
+						size) != RLC_OK) {
+					result = RLC_ERR;
+				}
 			}
+		}
+	}
+	RLC_CATCH_ANY {
+		result = RLC_ERR;
+	}
+	RLC_FINALLY {
+		for (i = 0; i < RLC_BN_LOT; i++) {
+			bn_free(eb[i]);
+		}
+	}
 
-#if CP_RSAPD == PKCS2
-			pad_pkcs2(eb, &pad_len, bn_bits(prv->crt->n), size, RSA_SIG_FIN);
-#endif
+	return result;
+}
+
+int cp_rsa_sig(uint8_t *sig, int *sig_len, uint8_t *msg, int msg_len, int hash, rsa_t prv) {
+	bn_t eb;
+	int size, result = RLC_OK;
+
+	if (prv == NULL || msg_len < 0) {
+		return RLC_ERR;
+	}
 
-			bn_copy(m, eb);
+	bn_null(eb);
+
+	RLC_TRY {
+		bn_new(eb);
 
+		if (rsa_sig_pad(eb, msg, msg_len, hash, prv) == RLC_OK) {
 #if !defined(CP_CRT)
 			bn_mxp(eb, eb, prv->d, prv->crt->n);
 #else  /* CP_CRT */
@@ -853,13 +1053,70 @@ int cp_rsa_sig(uint8_t *sig, int *sig_len, uint8_t *msg, int msg_len, int hash,
 		RLC_THROW(ERR_CAUGHT);
 	}
 	RLC_FINALLY {
-		bn_free(m);
 		bn_free(eb);
 	}
 
 	return result;
 }
 
+int cp_rsa_sig_many(uint8_t *sig[], int sig_len[], uint8_t *msg[],
+		const int msg_len[], int n, int hash, rsa_t prv) {
+	bn_t eb[RLC_BN_LOT];
+	int i, j, m, size, result = RLC_OK;
+
+	if (prv == NULL || n <= 0) {
+		return RLC_ERR;
+	}
+
+	size = bn_size_bin(prv->crt->n);
+	for (i = 0; i < n; i++) {
+		if (msg_len[i] < 0 || size > sig_len[i]) {
+			return RLC_ERR;
+		}
+	}
+
+	for (i = 0; i < RLC_BN_LOT; i++) {
+		bn_null(eb[i]);
+	}
+
+	RLC_TRY {
+		for (i = 0; i < RLC_BN_LOT; i++) {
+			bn_new(eb[i]);
+		}
+
+		/* Sign in lots to keep the working memory bounded. */
+		for (j = 0; j < n && result == RLC_OK; j += RLC_BN_LOT) {
+			m = RLC_MIN(RLC_BN_LOT, n - j);
+			for (i = 0; i < m; i++) {
+				if (rsa_sig_pad(eb[i], msg[j + i], msg_len[j + i], hash,
+						prv) != RLC_OK) {
+					result = RLC_ERR;
+				}
+			}
+
+			if (result == RLC_OK) {
+				rsa_prv_many(eb, m, prv);
+
+				for (i = 0; i < m; i++) {
+					memset(sig[j + i], 0, size);
+					bn_write_bin(sig[j + i], size, eb[i]);
+					sig_len[j + i] = size;
+				}
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < RLC_BN_LOT; i++) {
+			bn_free(eb[i]);
+		}
+	}
+
+	return result;
+}
+
 int cp_rsa_ver(uint8_t *sig, int sig_len, uint8_t *msg, int msg_len, int hash, rsa_t pub) {
 	bn_t m, eb;
 	int size, pad_len, result;
@@ -85,7 +85,7 @@ int cp_rsapsi_ask(bn_t d, bn_t r, bn_t p[], bn_t g, bn_t n, bn_t x[], int m) {
 	bn_rand_mod(r, n);
 	bn_mxp(d, g, r, n);
 
-	/* Now hash all x_i and accmulate on R. */
+	/* Now hash all x_i to primes and accmulate on R. */
 	for (i = 0; i < m; i++) {
 		bn_write_bin(bin, len, x[i]);
 		md_map(h, bin, len);
@@ -93,9 +93,7 @@ int cp_rsapsi_ask(bn_t d, bn_t r, bn_t p[], bn_t g, bn_t n, bn_t x[], int m) {
 		if (bn_is_even(p[i])) {
 			bn_add_dig(p[i], p[i], 1);
 		}
-		do {
-			bn_add_dig(p[i], p[i], 2);
-		} while (!bn_is_prime(p[i]));
+		bn_next_prime(p[i], p[i]);
 		bn_mxp(d, d, p[i], n);
 	}
 
@@ -106,32 +104,41 @@ int cp_rsapsi_ans(bn_t t[], bn_t u[], bn_t d, bn_t g, bn_t n, bn_t y[], int l) {
 	int j, result = RLC_OK, len = RLC_CEIL(RLC_BN_BITS, 8);
 	uint8_t h[RLC_MD_LEN], bin[RLC_CEIL(RLC_BN_BITS, 8)];
 	unsigned int *shuffle = RLC_ALLOCA(unsigned int, l);
-	bn_t p;
+	bn_t p, tab[RLC_BN_TABLE];
 
 	bn_null(p);
+	for (j = 0; j < RLC_BN_TABLE; j++) {
+		bn_null(tab[j]);
+	}
 
 	RLC_TRY {
 		bn_new(p);
+		for (j = 0; j < RLC_BN_TABLE; j++) {
+			bn_new(tab[j]);
+		}
 		if (shuffle == NULL) {
 			RLC_THROW(ERR_NO_MEMORY);
 		}
 
 		util_perm(shuffle, l);
+		/* The base d is the same for all elements, so precompute once. */
+		bn_mxp_pre(tab, d, n);
 
 		for (j = 0; j < l; j++) {
 			bn_write_bin(bin, len, y[shuffle[j]]);
 			md_map(h, bin, len);
-			bn_read_bin(p, h, 2 * STAT_SEC / 8);
-			if (bn_is_even(p)) {
-				bn_add_dig(p, p, 1);
+			bn_read_bin(u[j], h, 2 * STAT_SEC / 8);
+			if (bn_is_even(u[j])) {
+				bn_add_dig(u[j], u[j], 1);
 			}
-			do {
-				bn_add_dig(p, p, 2);
-			} while (!bn_is_prime(p));
-			bn_mxp(p, g, p, n);
+			bn_next_prime(u[j], u[j]);
+		}
+
+		for (j = 0; j < l; j++) {
+			bn_mxp(p, g, u[j], n);
 			bn_rand_mod(t[j], n);
 			bn_mxp(u[j], p, t[j], n);
-			bn_mxp(t[j], d, t[j], n);
+			bn_mxp_fix(t[j], (const bn_t *)tab, t[j], n);
 		}
 	}
 	RLC_CATCH_ANY {
@@ -139,6 +146,9 @@ int cp_rsapsi_ans(bn_t t[], bn_t u[], bn_t d, bn_t g, bn_t n, bn_t y[], int l) {
 	}
 	RLC_FINALLY {
 		bn_free(p);
+		for (j = 0; j < RLC_BN_TABLE; j++) {
+			bn_free(tab[j]);
+		}
 		RLC_FREE(shuffle);
 	}
 	return result;
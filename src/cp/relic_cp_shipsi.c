@@ -82,7 +82,7 @@ int cp_shipsi_ask(bn_t d, bn_t r, bn_t p[], bn_t g, bn_t n, bn_t x[], int m) {
 	bn_rand_mod(r, n);
 	bn_mxp(d, g, r, n);
 
-	/* Now hash all x_i and accmulate on R. */
+	/* Now hash all x_i to primes and accmulate on R. */
 	for (i = 0; i < m; i++) {
 		bn_write_bin(bin, len, x[i]);
 		md_map(h, bin, len);
@@ -90,9 +90,7 @@ int cp_shipsi_ask(bn_t d, bn_t r, bn_t p[], bn_t g, bn_t n, bn_t x[], int m) {
 		if (bn_is_even(p[i])) {
 			bn_add_dig(p[i], p[i], 1);
 		}
-		do {
-			bn_add_dig(p[i], p[i], 2);
-		} while (!bn_is_prime(p[i]));
+		bn_next_prime(p[i], p[i]);
 		bn_mxp(d, d, p[i], n);
 	}
 
@@ -104,6 +102,13 @@ int cp_shipsi_ans(bn_t t[], bn_t u, bn_t d, bn_t g, crt_t crt, bn_t y[], int n)
 	uint8_t h[RLC_MD_LEN], bin[RLC_CEIL(RLC_BN_BITS, 8)];
 	unsigned int *shuffle = RLC_ALLOCA(unsigned int, n);
 	bn_t p, q;
+#if !defined(CP_CRT)
+	bn_t tab[RLC_BN_TABLE];
+
+	for (j = 0; j < RLC_BN_TABLE; j++) {
+		bn_null(tab[j]);
+	}
+#endif
 
 	bn_null(p);
 	bn_null(q);
@@ -116,25 +121,33 @@ int cp_shipsi_ans(bn_t t[], bn_t u, bn_t d, bn_t g, crt_t crt, bn_t y[], int n)
 		}
 
 		util_perm(shuffle, n);
+#if !defined(CP_CRT)
+		for (j = 0; j < RLC_BN_TABLE; j++) {
+			bn_new(tab[j]);
+		}
+		/* The base d is the same for all elements, so precompute once. */
+		bn_mxp_pre(tab, d, crt->n);
+#endif
 
 		bn_rand_mod(u, crt->n);
 		for (j = 0; j < n; j++) {
 			bn_write_bin(bin, len, y[shuffle[j]]);
 			md_map(h, bin, len);
-			bn_read_bin(p, h, 2 * STAT_SEC / 8);
-			if (bn_is_even(p)) {
-				bn_add_dig(p, p, 1);
+			bn_read_bin(t[j], h, 2 * STAT_SEC / 8);
+			if (bn_is_even(t[j])) {
+				bn_add_dig(t[j], t[j], 1);
 			}
-			do {
-				bn_add_dig(p, p, 2);
-			} while (!bn_is_prime(p));
+			bn_next_prime(t[j], t[j]);
+		}
 
+		for (j = 0; j < n; j++) {
+			bn_copy(p, t[j]);
 #if !defined(CP_CRT)
 			bn_mul(q, crt->dp, crt->dq);
 			bn_mod_inv(p, p, q);
 			bn_mul(p, p, u);
 			bn_mod(p, p, q);
-			bn_mxp(t[j], d, p, crt->n);
+			bn_mxp_fix(t[j], (const bn_t *)tab, p, crt->n);
 #else
 			bn_mod_inv(q, p, crt->dq);
 			bn_mul(q, q, u);
@@ -163,6 +176,11 @@ int cp_shipsi_ans(bn_t t[], bn_t u, bn_t d, bn_t g, crt_t crt, bn_t y[], int n)
 	RLC_FINALLY {
 		bn_free(p);
 		bn_free(q);
+#if !defined(CP_CRT)
+		for (j = 0; j < RLC_BN_TABLE; j++) {
+			bn_free(tab[j]);
+		}
+#endif
 		RLC_FREE(shuffle);
 	}
 	return result;
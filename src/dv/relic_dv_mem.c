@@ -53,7 +53,7 @@ void dv_new_dynam(dv_t *a, int digits) {
 		return;
 	}
 #if ALIGN == 1
-	*a = malloc(digits * (RLC_DIG / 8));
+	*a = alloc_malloc(digits * (RLC_DIG / 8));
 #elif OPSYS == WINDOWS
 	*a = _aligned_malloc(digits * (RLC_DIG / 8), ALIGN);
 #else
@@ -73,7 +73,9 @@ void dv_new_dynam(dv_t *a, int digits) {
 
 void dv_free_dynam(dv_t *a) {
 	if ((*a) != NULL) {
-#if OPSYS == WINDOWS && ALIGN > 1
+#if ALIGN == 1
+		alloc_free(*a);
+#elif OPSYS == WINDOWS
 		_aligned_free(*a);
 #else
 		free(*a);
@@ -141,6 +141,12 @@ static void ed_mul_sim_plain(ed_t r, const ed_t p, const bn_t k, const ed_t q,
 
 #endif /* ED_SIM == INTER */
 
+/**
+ * Maximum window size used in the bucket method, which bounds the number of
+ * buckets allocated on the stack.
+ */
+#define ED_SIM_WMAX		12
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -397,32 +403,40 @@ void ed_mul_sim_gen(ed_t r, const bn_t k, const ed_t q, const bn_t m) {
 	}
 }
 
-void ed_mul_sim_lot(ed_t r, const ed_t p[], const bn_t k[], int n) {
-	int i, j, l, *_l = RLC_ALLOCA(int, n);
-	ed_t *_p = RLC_ALLOCA(ed_t, n);
+void ed_mul_sim_lot_inter(ed_t r, const ed_t p[], const bn_t k[], int n) {
+	int i, j, l, u, h = 1 << (ED_WIDTH - 2);
+	ed_t *t = NULL;
 	int8_t *naf = NULL;
 
+	if (n == 0) {
+		ed_set_infty(r);
+		return;
+	}
+
 	RLC_TRY {
 		l = 0;
 		for (i = 0; i < n; i++) {
 			l = RLC_MAX(l, bn_bits(k[i]) + 1);
 		}
 		naf = RLC_ALLOCA(int8_t, n * l);
-		if (naf == NULL || _p == NULL || _l == NULL) {
+		t = RLC_ALLOCA(ed_t, n * h);
+		if (naf == NULL || t == NULL) {
 			RLC_THROW(ERR_NO_MEMORY);
 		}
-
-		for (i = 0; i < n; i++) {
-			ed_null(_p[i]);
-			ed_new(_p[i]);
+		for (i = 0; i < n * h; i++) {
+			ed_null(t[i]);
+			ed_new(t[i]);
 		}
 
+		/* Compute the w-NAFs and a table of odd multiples for each point. */
 		for (i = 0; i < n; i++) {
-			_l[i] = l;
-			ed_norm(_p[i], p[i]);
-			bn_rec_naf(&naf[i*l], &_l[i], k[i], 2);
+			u = l;
+			bn_rec_naf(&naf[i * l], &u, k[i], ED_WIDTH);
+			ed_tab(t + i * h, p[i], ED_WIDTH);
 			if (bn_sign(k[i]) == RLC_NEG) {
-				ed_neg(_p[i], _p[i]);
+				for (j = 0; j < h; j++) {
+					ed_neg(t[i * h + j], t[i * h + j]);
+				}
 			}
 		}
 
@@ -430,11 +444,12 @@ void ed_mul_sim_lot(ed_t r, const ed_t p[], const bn_t k[], int n) {
 		for (i = l - 1; i >= 0; i--) {
 			ed_dbl(r, r);
 			for (j = 0; j < n; j++) {
-				if (naf[j*l + i] > 0) {
-					ed_add(r, r, _p[j]);
+				u = naf[j * l + i];
+				if (u > 0) {
+					ed_add(r, r, t[j * h + u / 2]);
 				}
-				if (naf[j*l + i] < 0) {
-					ed_sub(r, r, _p[j]);
+				if (u < 0) {
+					ed_sub(r, r, t[j * h - u / 2]);
 				}
 			}
 		}
@@ -444,11 +459,147 @@ void ed_mul_sim_lot(ed_t r, const ed_t p[], const bn_t k[], int n) {
 	} RLC_CATCH_ANY {
 		RLC_THROW(ERR_CAUGHT);
 	} RLC_FINALLY {
-		for (i = 0; i < n; i++) {
-			ed_free(_p[i]);
+		if (t != NULL) {
+			for (i = 0; i < n * h; i++) {
+				ed_free(t[i]);
+			}
 		}
-		RLC_FREE(_l);
-		RLC_FREE(_p);
+		RLC_FREE(t);
 		RLC_FREE(naf);
 	}
 }
+
+void ed_mul_sim_lot_bucket(ed_t r, const ed_t p[], const bn_t k[], int n) {
+	int i, j, b, c, d, u, h = 0, l = 0, win = 0;
+	ed_t t, v, acc, *bkt = NULL, *_w = NULL;
+	dig_t *sk = NULL;
+	uint8_t *cr = NULL;
+
+	if (n == 0) {
+		ed_set_infty(r);
+		return;
+	}
+
+	ed_null(t);
+	ed_null(v);
+	ed_null(acc);
+
+	RLC_TRY {
+		ed_new(t);
+		ed_new(v);
+		ed_new(acc);
+
+		/* Recode the absolute values of the scalars as vectors of digits. */
+		for (i = 0; i < n; i++) {
+			l = RLC_MAX(l, bn_bits(k[i]));
+		}
+		d = RLC_MAX(1, RLC_CEIL(l, RLC_DIG));
+		sk = RLC_MALLOC(dig_t, n * d);
+		cr = RLC_MALLOC(uint8_t, n);
+		if (sk == NULL || cr == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n; i++) {
+			bn_write_raw(sk + i * d, d, k[i]);
+			cr[i] = 0;
+		}
+
+		bn_rec_bkt(&c, n, l, ED_SIM_WMAX);
+		h = 1 << (c - 1);
+		win = l / c + 1;
+		bkt = RLC_MALLOC(ed_t, h);
+		_w = RLC_MALLOC(ed_t, win);
+		if (bkt == NULL || _w == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < h; i++) {
+			ed_null(bkt[i]);
+			ed_new(bkt[i]);
+		}
+		for (i = 0; i < win; i++) {
+			ed_null(_w[i]);
+			ed_new(_w[i]);
+		}
+
+		/* Process windows from the least significant to propagate carries. */
+		for (j = 0; j < win; j++) {
+			for (i = 0; i < h; i++) {
+				ed_set_infty(bkt[i]);
+			}
+			for (i = 0; i < n; i++) {
+				u = bn_rec_get(sk + i * d, d, j * c, c) + cr[i];
+				cr[i] = 0;
+				if (u > h) {
+					u -= (1 << c);
+					cr[i] = 1;
+				}
+				if (u != 0) {
+					/* The formulas are complete, so buckets need no checks. */
+					b = (u > 0 ? u : -u) - 1;
+					if ((u > 0) == (bn_sign(k[i]) == RLC_POS)) {
+						ed_add(bkt[b], bkt[b], p[i]);
+					} else {
+						ed_sub(bkt[b], bkt[b], p[i]);
+					}
+				}
+			}
+
+			/* Aggregate buckets as \Sum_b [b]B_b using running sums. */
+			ed_set_infty(t);
+			ed_set_infty(v);
+			for (b = h - 1; b >= 0; b--) {
+				ed_add(t, t, bkt[b]);
+				ed_add(v, v, t);
+			}
+			ed_copy(_w[j], v);
+		}
+
+		ed_set_infty(acc);
+		for (j = win - 1; j >= 0; j--) {
+			for (i = 0; i < c; i++) {
+				ed_dbl(acc, acc);
+			}
+			ed_add(acc, acc, _w[j]);
+		}
+
+		/* Convert r to affine coordinates. */
+		ed_norm(r, acc);
+	} RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	} RLC_FINALLY {
+		ed_free(t);
+		ed_free(v);
+		ed_free(acc);
+		if (bkt != NULL) {
+			for (i = 0; i < h; i++) {
+				ed_free(bkt[i]);
+			}
+		}
+		if (_w != NULL) {
+			for (i = 0; i < win; i++) {
+				ed_free(_w[i]);
+			}
+		}
+		alloc_free((void *)bkt);
+		alloc_free((void *)_w);
+		alloc_free((void *)sk);
+		alloc_free((void *)cr);
+	}
+}
+
+void ed_mul_sim_lot(ed_t r, const ed_t p[], const bn_t k[], int n) {
+	int c, l = 0;
+	size_t cost;
+
+	for (int i = 0; i < n; i++) {
+		l = RLC_MAX(l, bn_bits(k[i]));
+	}
+
+	/* Interleaving builds a table per point and adds at w-NAF density. */
+	cost = (size_t)n * ((1 << (ED_WIDTH - 2)) + l / (ED_WIDTH + 1)) + l;
+	if (bn_rec_bkt(&c, n, l, ED_SIM_WMAX) < cost) {
+		ed_mul_sim_lot_bucket(r, p, k, n);
+	} else {
+		ed_mul_sim_lot_inter(r, p, k, n);
+	}
+}
@@ -65,6 +65,14 @@ TMPL_MAP_HORNER(fp, fp_st)
  * draft-irtf-cfrg-hash-to-curve-06, Section 6.6.1
  */
 TMPL_MAP_SVDW(ep, fp, dig_t, EP_MAP_COPY_COND)
+/**
+ * Simplified SWU mapping of several field elements.
+ */
+TMPL_MAP_SSWU_SIM(ep, fp, dig_t, EP_MAP_COPY_COND)
+/**
+ * Shallue--van de Woestijne map of several field elements.
+ */
+TMPL_MAP_SVDW_SIM(ep, fp, dig_t, EP_MAP_COPY_COND)
 #undef EP_MAP_COPY_COND
 /* caution: this function overwrites k, which it uses as an auxiliary variable */
 static inline int fp_sgn0(const fp_t t, bn_t k) {
@@ -208,3 +216,128 @@ void ep_map_dst(ep_t p, const uint8_t *msg, int len, const uint8_t *dst,
 void ep_map(ep_t p, const uint8_t *msg, int len) {
 	ep_map_dst(p, msg, len, (const uint8_t *)"RELIC", 5);
 }
+
+void ep_map_dst_many(ep_t *p, const uint8_t *msg[], const int len[], int n,
+		const uint8_t *dst, int dst_len) {
+	/* enough space for two field elements plus extra bytes for uniformity */
+	const int len_per_elm = (FP_PRIME + ep_param_level() + 7) / 8;
+	int8_t naf[RLC_FP_BITS + 2];
+	int i, j, l, *neg;
+	uint8_t *buf, **b;
+	fp_t *t;
+	ep_t *q;
+	bn_t k;
+
+	if (n <= 0) {
+		return;
+	}
+
+	bn_null(k);
+	buf = RLC_ALLOCA(uint8_t, 2 * n * len_per_elm);
+	b = RLC_ALLOCA(uint8_t *, n);
+	neg = RLC_ALLOCA(int, 2 * n);
+	t = RLC_ALLOCA(fp_t, 2 * n);
+	q = RLC_ALLOCA(ep_t, 2 * n);
+
+	RLC_TRY {
+		if (buf == NULL || b == NULL || neg == NULL || t == NULL || q == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		bn_new(k);
+		for (i = 0; i < 2 * n; i++) {
+			fp_null(t[i]);
+			ep_null(q[i]);
+			fp_new(t[i]);
+			ep_new(q[i]);
+		}
+
+		/* hash all messages to pseudorandom strings at once */
+		for (i = 0; i < n; i++) {
+			b[i] = buf + 2 * i * len_per_elm;
+		}
+#if MD_MAP == SH256
+		md_xmd_sh256_many(b, 2 * len_per_elm, msg, len, n, dst, dst_len);
+#else
+		for (i = 0; i < n; i++) {
+			md_xmd(b[i], 2 * len_per_elm, msg[i], len[i], dst, dst_len);
+		}
+#endif
+
+		for (i = 0; i < 2 * n; i++) {
+			bn_read_bin(k, buf + i * len_per_elm, len_per_elm);
+			fp_prime_conv(t[i], k);
+			neg[i] = fp_sgn0(t[i], k);
+		}
+
+		/* map all field elements with a single inversion */
+		if (ep_curve_is_ctmap() || ((ep_curve_opt_a() != RLC_ZERO) &&
+				(ep_curve_opt_b() != RLC_ZERO))) {
+			ep_map_sswu_sim(q, t, 2 * n);
+		} else {
+			ep_map_svdw_sim(q, t, 2 * n);
+		}
+
+		for (i = 0; i < 2 * n; i++) {
+			/* compare sign of y and sign of t; fix if necessary */
+			neg[i] = neg[i] != fp_sgn0(q[i]->y, k);
+			fp_neg(t[i], q[i]->y);
+			dv_copy_cond(q[i]->y, t[i], RLC_FP_DIGS, neg[i]);
+			TMPL_MAP_CALL_ISOMAP(ep, q[i]);
+		}
+
+		for (i = 0; i < n; i++) {
+			ep_add(p[i], q[2 * i], q[2 * i + 1]);
+		}
+		ep_norm_sim(p, (const ep_t *)p, n);
+
+		/* clear cofactors with mixed additions and a final batch normalization */
+		switch (ep_curve_is_pairf()) {
+			case EP_BN:
+				/* h = 1 */
+				bn_set_dig(k, 1);
+				break;
+			case EP_B12:
+			case EP_B24:
+				/* multiply by 1-x (x the BLS parameter) to get the correct group. */
+				fp_prime_get_par(k);
+				bn_neg(k, k);
+				bn_add_dig(k, k, 1);
+				break;
+			default:
+				/* multiply by cofactor to get the correct group. */
+				ep_curve_get_cof(k);
+				break;
+		}
+		if (!bn_is_zero(k) && (bn_cmp_dig(k, 1) != RLC_EQ)) {
+			l = RLC_FP_BITS + 2;
+			bn_rec_naf(naf, &l, k, 2);
+			for (i = 0; i < n; i++) {
+				ep_set_infty(q[i]);
+				for (j = l - 1; j >= 0; j--) {
+					ep_dbl(q[i], q[i]);
+					if (naf[j] > 0) {
+						ep_add(q[i], q[i], p[i]);
+					} else if (naf[j] < 0) {
+						ep_sub(q[i], q[i], p[i]);
+					}
+				}
+			}
+			ep_norm_sim(p, (const ep_t *)q, n);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(k);
+		for (i = 0; t != NULL && q != NULL && i < 2 * n; i++) {
+			fp_free(t[i]);
+			ep_free(q[i]);
+		}
+		RLC_FREE(buf);
+		RLC_FREE(b);
+		RLC_FREE(neg);
+		RLC_FREE(t);
+		RLC_FREE(q);
+	}
+}
@@ -642,6 +642,12 @@ void ep_mul_sim_lot_plain(ep_t r, const ep_t p[], const bn_t k[], int n) {
 
 #endif /* EP_SIM == INTER */
 
+/**
+ * Maximum window size used in the bucket method, which bounds the number of
+ * buckets allocated on the stack.
+ */
+#define EP_SIM_WMAX		12
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -1022,7 +1028,7 @@ void ep_mul_sim_dig(ep_t r, const ep_t p[], const dig_t k[], int n) {
 	}
 }
 
-void ep_mul_sim_lot(ep_t r, const ep_t p[], const bn_t k[], int n) {
+void ep_mul_sim_lot_inter(ep_t r, const ep_t p[], const bn_t k[], int n) {
 	int flag = 0;
 
 	if (n == 0) {
@@ -1044,3 +1050,205 @@ void ep_mul_sim_lot(ep_t r, const ep_t p[], const bn_t k[], int n) {
 #endif
 	(void)flag;
 }
+
+void ep_mul_sim_lot_bucket(ep_t r, const ep_t p[], const bn_t k[], int n) {
+	int i, j, m, b, c, d, u, h = 0, s = 1, l = 0, win = 0;
+	bn_t q, _k[2], v1[3], v2[3];
+	ep_t t, v, acc, *bkt = NULL, *_w = NULL;
+	dig_t *sk = NULL;
+	int8_t *sg = NULL;
+	uint8_t *cr = NULL;
+
+	if (n == 0) {
+		ep_set_infty(r);
+		return;
+	}
+
+	bn_null(q);
+	bn_null(_k[0]);
+	bn_null(_k[1]);
+	ep_null(t);
+	ep_null(v);
+	ep_null(acc);
+
+	RLC_TRY {
+		bn_new(q);
+		bn_new(_k[0]);
+		bn_new(_k[1]);
+		ep_new(t);
+		ep_new(v);
+		ep_new(acc);
+		for (i = 0; i < 3; i++) {
+			bn_null(v1[i]);
+			bn_null(v2[i]);
+			bn_new(v1[i]);
+			bn_new(v2[i]);
+		}
+
+		ep_curve_get_ord(q);
+#if defined(EP_ENDOM)
+		if (ep_curve_is_endom()) {
+			ep_curve_get_v1(v1);
+			ep_curve_get_v2(v2);
+			s = 2;
+		}
+#endif
+
+		/* Recode the scalars as vectors of digits, splitting them if needed. */
+		if (s == 2) {
+			d = RLC_CEIL(bn_bits(q), 2 * RLC_DIG) + 1;
+		} else {
+			for (i = 0; i < n; i++) {
+				l = RLC_MAX(l, bn_bits(k[i]));
+			}
+			d = RLC_MAX(1, RLC_CEIL(l, RLC_DIG));
+		}
+		sk = RLC_MALLOC(dig_t, s * n * d);
+		sg = RLC_MALLOC(int8_t, s * n);
+		cr = RLC_MALLOC(uint8_t, s * n);
+		if (sk == NULL || sg == NULL || cr == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+
+		for (i = 0; i < n; i++) {
+			bn_copy(_k[0], k[i]);
+#if defined(EP_ENDOM)
+			if (s == 2) {
+				bn_mod(_k[0], k[i], q);
+				m = bn_sign(_k[0]);
+				bn_rec_glv(_k[0], _k[1], _k[0], q, (const bn_t *)v1,
+						(const bn_t *)v2);
+				if (m == RLC_NEG) {
+					bn_neg(_k[0], _k[0]);
+					bn_neg(_k[1], _k[1]);
+				}
+			}
+#endif
+			for (j = 0; j < s; j++) {
+				bn_write_raw(sk + (s * i + j) * d, d, _k[j]);
+				sg[s * i + j] = (bn_sign(_k[j]) == RLC_NEG ? -1 : 1);
+				cr[s * i + j] = 0;
+				l = RLC_MAX(l, bn_bits(_k[j]));
+			}
+		}
+
+		bn_rec_bkt(&c, s * n, l, EP_SIM_WMAX);
+		h = 1 << (c - 1);
+		win = l / c + 1;
+		bkt = RLC_MALLOC(ep_t, s * h);
+		_w = RLC_MALLOC(ep_t, win);
+		if (bkt == NULL || _w == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < s * h; i++) {
+			ep_null(bkt[i]);
+			ep_new(bkt[i]);
+		}
+		for (i = 0; i < win; i++) {
+			ep_null(_w[i]);
+			ep_new(_w[i]);
+		}
+
+		/* Process windows from the least significant to propagate carries. */
+		for (j = 0; j < win; j++) {
+			for (i = 0; i < s * h; i++) {
+				ep_set_infty(bkt[i]);
+			}
+			for (i = 0; i < s * n; i++) {
+				u = bn_rec_get(sk + i * d, d, j * c, c) + cr[i];
+				cr[i] = 0;
+				if (u > h) {
+					u -= (1 << c);
+					cr[i] = 1;
+				}
+				if (u != 0) {
+					b = (i % s) * h + (u > 0 ? u : -u) - 1;
+					if ((u > 0) == (sg[i] > 0)) {
+						ep_add(bkt[b], bkt[b], p[i / s]);
+					} else {
+						ep_sub(bkt[b], bkt[b], p[i / s]);
+					}
+				}
+			}
+
+			/* Aggregate buckets as \Sum_b [b]B_b using running sums. */
+			ep_set_infty(acc);
+			for (m = s - 1; m >= 0; m--) {
+#if defined(EP_ENDOM)
+				if (m < s - 1) {
+					ep_psi(acc, acc);
+				}
+#endif
+				ep_set_infty(t);
+				ep_set_infty(v);
+				for (b = h - 1; b >= 0; b--) {
+					ep_add(t, t, bkt[m * h + b]);
+					ep_add(v, v, t);
+				}
+				ep_add(acc, acc, v);
+			}
+			ep_copy(_w[j], acc);
+		}
+
+		ep_set_infty(acc);
+		for (j = win - 1; j >= 0; j--) {
+			for (i = 0; i < c; i++) {
+				ep_dbl(acc, acc);
+			}
+			ep_add(acc, acc, _w[j]);
+		}
+
+		/* Convert r to affine coordinates. */
+		ep_norm(r, acc);
+	} RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	} RLC_FINALLY {
+		bn_free(q);
+		bn_free(_k[0]);
+		bn_free(_k[1]);
+		ep_free(t);
+		ep_free(v);
+		ep_free(acc);
+		for (i = 0; i < 3; i++) {
+			bn_free(v1[i]);
+			bn_free(v2[i]);
+		}
+		if (bkt != NULL) {
+			for (i = 0; i < s * h; i++) {
+				ep_free(bkt[i]);
+			}
+		}
+		if (_w != NULL) {
+			for (i = 0; i < win; i++) {
+				ep_free(_w[i]);
+			}
+		}
+		alloc_free((void *)bkt);
+		alloc_free((void *)_w);
+		alloc_free((void *)sk);
+		alloc_free((void *)sg);
+		alloc_free((void *)cr);
+	}
+}
+
+void ep_mul_sim_lot(ep_t r, const ep_t p[], const bn_t k[], int n) {
+	int c, s = 1, l = 0;
+
+	for (int i = 0; i < n; i++) {
+		l = RLC_MAX(l, bn_bits(k[i]));
+	}
+#if defined(EP_ENDOM)
+	if (ep_curve_is_endom()) {
+		/* Scalars are split in halves by the GLV decomposition. */
+		l = (l >> 1) + 1;
+		s = 2;
+	}
+#endif
+
+	/* Interleaving costs one addition per nonzero NAF digit of density 1/3. */
+	if (bn_rec_bkt(&c, s * n, l, EP_SIM_WMAX) < (size_t)l * (s * n / 3 + 1)) {
+		ep_mul_sim_lot_bucket(r, p, k, n);
+	} else {
+		ep_mul_sim_lot_inter(r, p, k, n);
+	}
+}
@@ -134,3 +134,77 @@ int ep_upk(ep_t r, const ep_t p) {
 	}
 	return result;
 }
+
+int ep_upk_many(ep_t *r, const ep_t *p, int n) {
+	int i, j, l, b[32], result = 1, m = RLC_MIN(n, 32);
+	fp_t *t;
+	bn_t halfQ, yValue;
+
+	if (n <= 0) {
+		return 1;
+	}
+
+	bn_null(halfQ);
+	bn_null(yValue);
+	t = RLC_ALLOCA(fp_t, m);
+
+	RLC_TRY {
+		if (t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		bn_new(halfQ);
+		bn_new(yValue);
+		for (i = 0; i < m; i++) {
+			fp_null(t[i]);
+			fp_new(t[i]);
+		}
+
+		halfQ->used = RLC_FP_DIGS;
+		dv_copy(halfQ->dp, fp_prime_get(), RLC_FP_DIGS);
+		bn_hlv(halfQ, halfQ);
+
+		for (j = 0; j < n; j += m) {
+			l = RLC_MIN(m, n - j);
+
+			/* t = sqrt(x1^3 + a * x1 + b), with all roots extracted at once. */
+			for (i = 0; i < l; i++) {
+				ep_rhs(t[i], p[j + i]);
+			}
+			result &= fp_srt_many(t, b, (const fp_t *)t, l);
+
+			for (i = 0; i < l; i++) {
+				if (!b[i]) {
+					continue;
+				}
+				/* Choose the root matching the compressed y-coordinate. */
+				if (ep_curve_is_pairf()) {
+					fp_prime_back(yValue, t[i]);
+					if ((bn_cmp(yValue, halfQ) == RLC_GT) !=
+							fp_get_bit(p[j + i]->y, 0)) {
+						fp_neg(t[i], t[i]);
+					}
+				} else if (fp_get_bit(t[i], 0) != fp_get_bit(p[j + i]->y, 0)) {
+					fp_neg(t[i], t[i]);
+				}
+				fp_copy(r[j + i]->x, p[j + i]->x);
+				fp_copy(r[j + i]->y, t[i]);
+				fp_set_dig(r[j + i]->z, 1);
+				r[j + i]->coord = BASIC;
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		if (t != NULL) {
+			for (i = 0; i < m; i++) {
+				fp_free(t[i]);
+			}
+		}
+		RLC_FREE(t);
+		bn_free(halfQ);
+		bn_free(yValue);
+	}
+	return result;
+}
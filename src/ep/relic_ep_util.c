@@ -32,6 +32,40 @@
 
 #include "relic_core.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Version of the format of serialized precomputation tables.
+ */
+#define TAB_VER		1
+
+/**
+ * Size in bytes of the header of a serialized precomputation table.
+ */
+#define TAB_HEAD	12
+
+/**
+ * Writes the header identifying a serialized precomputation table.
+ *
+ * @param[out] bin			- the byte vector.
+ */
+static void ep_tab_head(uint8_t *bin) {
+	int id = ep_param_get();
+
+	/* Magic, version, group, method, depth, curve and number of points. */
+	memcpy(bin, "RLCT", 4);
+	bin[4] = TAB_VER;
+	bin[5] = 1;
+	bin[6] = EP_FIX;
+	bin[7] = EP_DEPTH;
+	bin[8] = (id >> 8) & 0xFF;
+	bin[9] = id & 0xFF;
+	bin[10] = (RLC_EP_TABLE >> 8) & 0xFF;
+	bin[11] = RLC_EP_TABLE & 0xFF;
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -329,3 +363,46 @@ void ep_write_bin(uint8_t *bin, int len, const ep_t a, int pack) {
 		ep_free(t);
 	}
 }
+
+int ep_size_pre(void) {
+	return TAB_HEAD + RLC_EP_TABLE * (2 * RLC_FP_BYTES + 1);
+}
+
+void ep_read_pre(ep_t *t, const uint8_t *bin, int len) {
+	uint8_t head[TAB_HEAD];
+	int i, size = 2 * RLC_FP_BYTES + 1;
+
+	if (len != ep_size_pre()) {
+		RLC_THROW(ERR_NO_BUFFER);
+		return;
+	}
+
+	ep_tab_head(head);
+	if (memcmp(bin, head, TAB_HEAD) != 0) {
+		RLC_THROW(ERR_NO_VALID);
+		return;
+	}
+
+	for (i = 0; i < RLC_EP_TABLE; i++) {
+		/* Points at infinity are stored as zeroed slots. */
+		if (bin[TAB_HEAD + i * size] == 0) {
+			ep_set_infty(t[i]);
+		} else {
+			ep_read_bin(t[i], bin + TAB_HEAD + i * size, size);
+		}
+	}
+}
+
+void ep_write_pre(uint8_t *bin, int len, const ep_t *t) {
+	int i, size = 2 * RLC_FP_BYTES + 1;
+
+	if (len != ep_size_pre()) {
+		RLC_THROW(ERR_NO_BUFFER);
+		return;
+	}
+
+	ep_tab_head(bin);
+	for (i = 0; i < RLC_EP_TABLE; i++) {
+		ep_write_bin(bin + TAB_HEAD + i * size, size, t[i], 0);
+	}
+}
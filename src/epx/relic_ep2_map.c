@@ -69,6 +69,16 @@ TMPL_MAP_SSWU(ep2, fp2, fp_t, EP2_MAP_COPY_COND)
  * Shallue--van de Woestijne map.
  */
 TMPL_MAP_SVDW(ep2, fp2, fp_t, EP2_MAP_COPY_COND)
+
+/**
+ * Simplified SWU mapping of several field elements.
+ */
+TMPL_MAP_SSWU_SIM(ep2, fp2, fp_t, EP2_MAP_COPY_COND)
+
+/**
+ * Shallue--van de Woestijne map of several field elements.
+ */
+TMPL_MAP_SVDW_SIM(ep2, fp2, fp_t, EP2_MAP_COPY_COND)
 #undef EP2_MAP_COPY_COND
 
 /* caution: this function overwrites k, which it uses as an auxiliary variable */
@@ -188,6 +198,102 @@ void ep2_map_dst(ep2_t p, const uint8_t *msg, int len, const uint8_t *dst, int d
         }
 }
 
+void ep2_map_dst_many(ep2_t *p, const uint8_t *msg[], const int len[], int n,
+		const uint8_t *dst, int dst_len) {
+	/* enough space for two field elements plus extra bytes for uniformity */
+	const int len_per_elm = (FP_PRIME + ep_param_level() + 7) / 8;
+	int i, *neg;
+	uint8_t *buf, **b;
+	fp2_t *t;
+	ep2_t *q;
+	bn_t k;
+
+	if (n <= 0) {
+		return;
+	}
+
+	bn_null(k);
+	buf = RLC_ALLOCA(uint8_t, 4 * n * len_per_elm);
+	b = RLC_ALLOCA(uint8_t *, n);
+	neg = RLC_ALLOCA(int, 2 * n);
+	t = RLC_ALLOCA(fp2_t, 2 * n);
+	q = RLC_ALLOCA(ep2_t, 2 * n);
+
+	RLC_TRY {
+		if (buf == NULL || b == NULL || neg == NULL || t == NULL || q == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		bn_new(k);
+		for (i = 0; i < 2 * n; i++) {
+			fp2_null(t[i]);
+			ep2_null(q[i]);
+			fp2_new(t[i]);
+			ep2_new(q[i]);
+		}
+
+		/* hash all messages to pseudorandom strings at once */
+		for (i = 0; i < n; i++) {
+			b[i] = buf + 4 * i * len_per_elm;
+		}
+#if MD_MAP == SH256
+		md_xmd_sh256_many(b, 4 * len_per_elm, msg, len, n, dst, dst_len);
+#else
+		for (i = 0; i < n; i++) {
+			md_xmd(b[i], 4 * len_per_elm, msg[i], len[i], dst, dst_len);
+		}
+#endif
+
+		for (i = 0; i < 2 * n; i++) {
+			bn_read_bin(k, buf + 2 * i * len_per_elm, len_per_elm);
+			fp_prime_conv(t[i][0], k);
+			bn_read_bin(k, buf + (2 * i + 1) * len_per_elm, len_per_elm);
+			fp_prime_conv(t[i][1], k);
+			neg[i] = fp2_sgn0(t[i], k);
+		}
+
+		/* map all field elements with a single inversion */
+		if (ep2_curve_is_ctmap() || ((ep2_curve_opt_a() != RLC_ZERO) &&
+				(ep2_curve_opt_b() != RLC_ZERO))) {
+			ep2_map_sswu_sim(q, t, 2 * n);
+		} else {
+			ep2_map_svdw_sim(q, t, 2 * n);
+		}
+
+		for (i = 0; i < 2 * n; i++) {
+			/* compare sign of y to sign of t; fix if necessary */
+			neg[i] = neg[i] != fp2_sgn0(q[i]->y, k);
+			fp2_neg(t[i], q[i]->y);
+			dv_copy_cond(q[i]->y[0], t[i][0], RLC_FP_DIGS, neg[i]);
+			dv_copy_cond(q[i]->y[1], t[i][1], RLC_FP_DIGS, neg[i]);
+			TMPL_MAP_CALL_ISOMAP(ep2, q[i]);
+		}
+
+		for (i = 0; i < n; i++) {
+			ep2_add(p[i], q[2 * i], q[2 * i + 1]);
+		}
+		/* cofactor clearing starts from a batch of affine points */
+		ep2_norm_sim(p, p, n);
+		for (i = 0; i < n; i++) {
+			ep2_mul_cof(p[i], p[i]);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(k);
+		for (i = 0; t != NULL && q != NULL && i < 2 * n; i++) {
+			fp2_free(t[i]);
+			ep2_free(q[i]);
+		}
+		RLC_FREE(buf);
+		RLC_FREE(b);
+		RLC_FREE(neg);
+		RLC_FREE(t);
+		RLC_FREE(q);
+	}
+}
+
 void ep2_map(ep2_t p, const uint8_t *msg, int len) {
 	ep2_map_dst(p, msg, len, (const uint8_t *)"RELIC", 5);
 }
@@ -251,6 +251,12 @@ static void ep2_mul_sim_plain(ep2_t r, ep2_t p, bn_t k, ep2_t q, bn_t m,
 
 #endif /* EP_SIM == INTER */
 
+/**
+ * Maximum window size used in the bucket method, which bounds the number of
+ * buckets allocated on the stack.
+ */
+#define EP2_SIM_WMAX		12
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -630,7 +636,7 @@ void ep2_mul_sim_dig(ep2_t r, ep2_t p[], dig_t k[], int len) {
 	}
 }
 
-void ep2_mul_sim_lot(ep2_t r, ep2_t p[], const bn_t k[], int n) {
+void ep2_mul_sim_lot_inter(ep2_t r, ep2_t p[], const bn_t k[], int n) {
 	const int len = RLC_FP_BITS + 1;
 	int i, j, m, l, _l[4];
 	bn_t _k[4], q, x;
@@ -818,3 +824,167 @@ void ep2_mul_sim_lot(ep2_t r, ep2_t p[], const bn_t k[], int n) {
 		}
 	}
 }
+
+void ep2_mul_sim_lot_bucket(ep2_t r, ep2_t p[], const bn_t k[], int n) {
+	const int s = 4;
+	int i, j, m, b, c, d, u, h = 0, l = 0, win = 0;
+	bn_t q, x, _k[4];
+	ep2_t t, v, acc, *bkt = NULL, *_w = NULL;
+	dig_t *sk = NULL;
+	int8_t *sg = NULL;
+	uint8_t *cr = NULL;
+
+	if (n == 0) {
+		ep2_set_infty(r);
+		return;
+	}
+
+	bn_null(q);
+	bn_null(x);
+	ep2_null(t);
+	ep2_null(v);
+	ep2_null(acc);
+
+	RLC_TRY {
+		bn_new(q);
+		bn_new(x);
+		ep2_new(t);
+		ep2_new(v);
+		ep2_new(acc);
+		for (j = 0; j < s; j++) {
+			bn_null(_k[j]);
+			bn_new(_k[j]);
+		}
+
+		ep2_curve_get_ord(q);
+		fp_prime_get_par(x);
+
+		/* Recode the scalars as vectors of digits split by the Frobenius. */
+		d = RLC_CEIL(bn_bits(q), s * RLC_DIG) + 1;
+		sk = RLC_MALLOC(dig_t, s * n * d);
+		sg = RLC_MALLOC(int8_t, s * n);
+		cr = RLC_MALLOC(uint8_t, s * n);
+		if (sk == NULL || sg == NULL || cr == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+
+		for (i = 0; i < n; i++) {
+			bn_mod(_k[0], k[i], q);
+			bn_rec_frb(_k, s, _k[0], x, q, ep_curve_is_pairf() == EP_B12);
+			for (j = 0; j < s; j++) {
+				bn_write_raw(sk + (s * i + j) * d, d, _k[j]);
+				sg[s * i + j] = (bn_sign(_k[j]) == RLC_NEG ? -1 : 1);
+				cr[s * i + j] = 0;
+				l = RLC_MAX(l, bn_bits(_k[j]));
+			}
+		}
+
+		bn_rec_bkt(&c, s * n, l, EP2_SIM_WMAX);
+		h = 1 << (c - 1);
+		win = l / c + 1;
+		bkt = RLC_MALLOC(ep2_t, s * h);
+		_w = RLC_MALLOC(ep2_t, win);
+		if (bkt == NULL || _w == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < s * h; i++) {
+			ep2_null(bkt[i]);
+			ep2_new(bkt[i]);
+		}
+		for (i = 0; i < win; i++) {
+			ep2_null(_w[i]);
+			ep2_new(_w[i]);
+		}
+
+		/* Process windows from the least significant to propagate carries. */
+		for (j = 0; j < win; j++) {
+			for (i = 0; i < s * h; i++) {
+				ep2_set_infty(bkt[i]);
+			}
+			for (i = 0; i < s * n; i++) {
+				u = bn_rec_get(sk + i * d, d, j * c, c) + cr[i];
+				cr[i] = 0;
+				if (u > h) {
+					u -= (1 << c);
+					cr[i] = 1;
+				}
+				if (u != 0) {
+					b = (i % s) * h + (u > 0 ? u : -u) - 1;
+					if ((u > 0) == (sg[i] > 0)) {
+						ep2_add(bkt[b], bkt[b], p[i / s]);
+					} else {
+						ep2_sub(bkt[b], bkt[b], p[i / s]);
+					}
+				}
+			}
+
+			/* Aggregate buckets as \Sum_b [b]B_b using running sums. */
+			ep2_set_infty(acc);
+			for (m = s - 1; m >= 0; m--) {
+				ep2_frb(acc, acc, 1);
+				ep2_set_infty(t);
+				ep2_set_infty(v);
+				for (b = h - 1; b >= 0; b--) {
+					ep2_add(t, t, bkt[m * h + b]);
+					ep2_add(v, v, t);
+				}
+				ep2_add(acc, acc, v);
+			}
+			ep2_copy(_w[j], acc);
+		}
+
+		ep2_set_infty(acc);
+		for (j = win - 1; j >= 0; j--) {
+			for (i = 0; i < c; i++) {
+				ep2_dbl(acc, acc);
+			}
+			ep2_add(acc, acc, _w[j]);
+		}
+
+		/* Convert r to affine coordinates. */
+		ep2_norm(r, acc);
+	} RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	} RLC_FINALLY {
+		bn_free(q);
+		bn_free(x);
+		ep2_free(t);
+		ep2_free(v);
+		ep2_free(acc);
+		for (j = 0; j < s; j++) {
+			bn_free(_k[j]);
+		}
+		if (bkt != NULL) {
+			for (i = 0; i < s * h; i++) {
+				ep2_free(bkt[i]);
+			}
+		}
+		if (_w != NULL) {
+			for (i = 0; i < win; i++) {
+				ep2_free(_w[i]);
+			}
+		}
+		alloc_free((void *)bkt);
+		alloc_free((void *)_w);
+		alloc_free((void *)sk);
+		alloc_free((void *)sg);
+		alloc_free((void *)cr);
+	}
+}
+
+void ep2_mul_sim_lot(ep2_t r, ep2_t p[], const bn_t k[], int n) {
+	int c, l = 0;
+
+	for (int i = 0; i < n; i++) {
+		l = RLC_MAX(l, bn_bits(k[i]));
+	}
+	/* Scalars are split in 4 parts by the Frobenius decomposition. */
+	l = l / 4 + 1;
+
+	/* Interleaving uses wider windows for many points, adding every ~5 bits. */
+	if (bn_rec_bkt(&c, 4 * n, l, EP2_SIM_WMAX) < (size_t)l * (4 * n / 5 + 1)) {
+		ep2_mul_sim_lot_bucket(r, p, k, n);
+	} else {
+		ep2_mul_sim_lot_inter(r, p, k, n);
+	}
+}
@@ -120,6 +120,7 @@ void ep2_norm_sim(ep2_t *r, ep2_t *t, int n) {
 			fp2_copy(r[i]->x, t[i]->x);
 			fp2_copy(r[i]->y, t[i]->y);
 			fp2_copy(r[i]->z, a[i]);
+			r[i]->coord = t[i]->coord;
 		}
 
 		for (i = 0; i < n; i++) {
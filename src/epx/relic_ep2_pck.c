@@ -130,3 +130,79 @@ int ep2_upk(ep2_t r, ep2_t p) {
 	}
 	return result;
 }
+
+int ep2_upk_many(ep2_t *r, const ep2_t *p, int n) {
+	int i, j, l, b[32], result = 1, m = RLC_MIN(n, 32);
+	/* The extension field functions take no const arguments. */
+	ep2_t *q = (ep2_t *)p;
+	fp2_t *t;
+	bn_t halfQ, yValue;
+
+	if (n <= 0) {
+		return 1;
+	}
+
+	bn_null(halfQ);
+	bn_null(yValue);
+	t = RLC_ALLOCA(fp2_t, m);
+
+	RLC_TRY {
+		if (t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		bn_new(halfQ);
+		bn_new(yValue);
+		for (i = 0; i < m; i++) {
+			fp2_null(t[i]);
+			fp2_new(t[i]);
+		}
+
+		halfQ->used = RLC_FP_DIGS;
+		dv_copy(halfQ->dp, fp_prime_get(), RLC_FP_DIGS);
+		bn_hlv(halfQ, halfQ);
+
+		for (j = 0; j < n; j += m) {
+			l = RLC_MIN(m, n - j);
+
+			/* t = sqrt(x1^3 + a * x1 + b), with all roots extracted at once. */
+			for (i = 0; i < l; i++) {
+				ep2_rhs(t[i], q[j + i]);
+			}
+			result &= fp2_srt_many(t, b, t, l);
+
+			for (i = 0; i < l; i++) {
+				if (!b[i]) {
+					continue;
+				}
+				/* Choose the root matching the compressed y-coordinate. */
+				fp_prime_back(yValue, t[i][1]);
+				if (bn_is_zero(yValue)) {
+					fp_prime_back(yValue, t[i][0]);
+				}
+				if ((bn_cmp(yValue, halfQ) == RLC_GT) !=
+						fp_get_bit(q[j + i]->y[0], 0)) {
+					fp2_neg(t[i], t[i]);
+				}
+				fp2_copy(r[j + i]->x, q[j + i]->x);
+				fp2_copy(r[j + i]->y, t[i]);
+				fp_set_dig(r[j + i]->z[0], 1);
+				fp_zero(r[j + i]->z[1]);
+				r[j + i]->coord = BASIC;
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		if (t != NULL) {
+			for (i = 0; i < m; i++) {
+				fp2_free(t[i]);
+			}
+		}
+		RLC_FREE(t);
+		bn_free(halfQ);
+		bn_free(yValue);
+	}
+	return result;
+}
@@ -32,6 +32,40 @@
 
 #include "relic_core.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Version of the format of serialized precomputation tables.
+ */
+#define TAB_VER		1
+
+/**
+ * Size in bytes of the header of a serialized precomputation table.
+ */
+#define TAB_HEAD	12
+
+/**
+ * Writes the header identifying a serialized precomputation table.
+ *
+ * @param[out] bin			- the byte vector.
+ */
+static void ep2_tab_head(uint8_t *bin) {
+	int id = ep_param_get();
+
+	/* Magic, version, group, method, depth, curve and number of points. */
+	memcpy(bin, "RLCT", 4);
+	bin[4] = TAB_VER;
+	bin[5] = 2;
+	bin[6] = EP_FIX;
+	bin[7] = EP_DEPTH;
+	bin[8] = (id >> 8) & 0xFF;
+	bin[9] = id & 0xFF;
+	bin[10] = (RLC_EPX_TABLE >> 8) & 0xFF;
+	bin[11] = RLC_EPX_TABLE & 0xFF;
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -337,3 +371,46 @@ void ep2_write_bin(uint8_t *bin, int len, ep2_t a, int pack) {
 		ep2_free(t);
 	}
 }
+
+int ep2_size_pre(void) {
+	return TAB_HEAD + RLC_EPX_TABLE * (4 * RLC_FP_BYTES + 1);
+}
+
+void ep2_read_pre(ep2_t *t, const uint8_t *bin, int len) {
+	uint8_t head[TAB_HEAD];
+	int i, size = 4 * RLC_FP_BYTES + 1;
+
+	if (len != ep2_size_pre()) {
+		RLC_THROW(ERR_NO_BUFFER);
+		return;
+	}
+
+	ep2_tab_head(head);
+	if (memcmp(bin, head, TAB_HEAD) != 0) {
+		RLC_THROW(ERR_NO_VALID);
+		return;
+	}
+
+	for (i = 0; i < RLC_EPX_TABLE; i++) {
+		/* Points at infinity are stored as zeroed slots. */
+		if (bin[TAB_HEAD + i * size] == 0) {
+			ep2_set_infty(t[i]);
+		} else {
+			ep2_read_bin(t[i], bin + TAB_HEAD + i * size, size);
+		}
+	}
+}
+
+void ep2_write_pre(uint8_t *bin, int len, ep2_t *t) {
+	int i, size = 4 * RLC_FP_BYTES + 1;
+
+	if (len != ep2_size_pre()) {
+		RLC_THROW(ERR_NO_BUFFER);
+		return;
+	}
+
+	ep2_tab_head(bin);
+	for (i = 0; i < RLC_EPX_TABLE; i++) {
+		ep2_write_bin(bin + TAB_HEAD + i * size, size, t[i], 0);
+	}
+}
@@ -140,6 +140,12 @@ static void ep4_mul_sim_plain(ep4_t r, ep4_t p, bn_t k, ep4_t q, bn_t m,
 
 #endif /* EP_SIM == INTER */
 
+/**
+ * Maximum window size used in the bucket method, which bounds the number of
+ * buckets allocated on the stack.
+ */
+#define EP4_SIM_WMAX		12
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -426,7 +432,7 @@ void ep4_mul_sim_dig(ep4_t r, ep4_t p[], dig_t k[], int len) {
 	}
 }
 
-void ep4_mul_sim_lot(ep4_t r, ep4_t p[], const bn_t k[], int n) {
+void ep4_mul_sim_lot_inter(ep4_t r, ep4_t p[], const bn_t k[], int n) {
 	const int len = RLC_FP_BITS + 1;
 	int i, j, m, l, *_l = RLC_ALLOCA(int, 8 * n);
 	bn_t _k[8], q, x;
@@ -626,3 +632,167 @@ void ep4_mul_sim_lot(ep4_t r, ep4_t p[], const bn_t k[], int n) {
 		}
 	}
 }
+
+void ep4_mul_sim_lot_bucket(ep4_t r, ep4_t p[], const bn_t k[], int n) {
+	const int s = 8;
+	int i, j, m, b, c, d, u, h = 0, l = 0, win = 0;
+	bn_t q, x, _k[8];
+	ep4_t t, v, acc, *bkt = NULL, *_w = NULL;
+	dig_t *sk = NULL;
+	int8_t *sg = NULL;
+	uint8_t *cr = NULL;
+
+	if (n == 0) {
+		ep4_set_infty(r);
+		return;
+	}
+
+	bn_null(q);
+	bn_null(x);
+	ep4_null(t);
+	ep4_null(v);
+	ep4_null(acc);
+
+	RLC_TRY {
+		bn_new(q);
+		bn_new(x);
+		ep4_new(t);
+		ep4_new(v);
+		ep4_new(acc);
+		for (j = 0; j < s; j++) {
+			bn_null(_k[j]);
+			bn_new(_k[j]);
+		}
+
+		ep4_curve_get_ord(q);
+		fp_prime_get_par(x);
+
+		/* Recode the scalars as vectors of digits split by the Frobenius. */
+		d = RLC_CEIL(bn_bits(q), s * RLC_DIG) + 1;
+		sk = RLC_MALLOC(dig_t, s * n * d);
+		sg = RLC_MALLOC(int8_t, s * n);
+		cr = RLC_MALLOC(uint8_t, s * n);
+		if (sk == NULL || sg == NULL || cr == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+
+		for (i = 0; i < n; i++) {
+			bn_mod(_k[0], k[i], q);
+			bn_rec_frb(_k, s, _k[0], x, q, ep_curve_is_pairf());
+			for (j = 0; j < s; j++) {
+				bn_write_raw(sk + (s * i + j) * d, d, _k[j]);
+				sg[s * i + j] = (bn_sign(_k[j]) == RLC_NEG ? -1 : 1);
+				cr[s * i + j] = 0;
+				l = RLC_MAX(l, bn_bits(_k[j]));
+			}
+		}
+
+		bn_rec_bkt(&c, s * n, l, EP4_SIM_WMAX);
+		h = 1 << (c - 1);
+		win = l / c + 1;
+		bkt = RLC_MALLOC(ep4_t, s * h);
+		_w = RLC_MALLOC(ep4_t, win);
+		if (bkt == NULL || _w == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < s * h; i++) {
+			ep4_null(bkt[i]);
+			ep4_new(bkt[i]);
+		}
+		for (i = 0; i < win; i++) {
+			ep4_null(_w[i]);
+			ep4_new(_w[i]);
+		}
+
+		/* Process windows from the least significant to propagate carries. */
+		for (j = 0; j < win; j++) {
+			for (i = 0; i < s * h; i++) {
+				ep4_set_infty(bkt[i]);
+			}
+			for (i = 0; i < s * n; i++) {
+				u = bn_rec_get(sk + i * d, d, j * c, c) + cr[i];
+				cr[i] = 0;
+				if (u > h) {
+					u -= (1 << c);
+					cr[i] = 1;
+				}
+				if (u != 0) {
+					b = (i % s) * h + (u > 0 ? u : -u) - 1;
+					if ((u > 0) == (sg[i] > 0)) {
+						ep4_add(bkt[b], bkt[b], p[i / s]);
+					} else {
+						ep4_sub(bkt[b], bkt[b], p[i / s]);
+					}
+				}
+			}
+
+			/* Aggregate buckets as \Sum_b [b]B_b using running sums. */
+			ep4_set_infty(acc);
+			for (m = s - 1; m >= 0; m--) {
+				ep4_frb(acc, acc, 1);
+				ep4_set_infty(t);
+				ep4_set_infty(v);
+				for (b = h - 1; b >= 0; b--) {
+					ep4_add(t, t, bkt[m * h + b]);
+					ep4_add(v, v, t);
+				}
+				ep4_add(acc, acc, v);
+			}
+			ep4_copy(_w[j], acc);
+		}
+
+		ep4_set_infty(acc);
+		for (j = win - 1; j >= 0; j--) {
+			for (i = 0; i < c; i++) {
+				ep4_dbl(acc, acc);
+			}
+			ep4_add(acc, acc, _w[j]);
+		}
+
+		/* Convert r to affine coordinates. */
+		ep4_norm(r, acc);
+	} RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	} RLC_FINALLY {
+		bn_free(q);
+		bn_free(x);
+		ep4_free(t);
+		ep4_free(v);
+		ep4_free(acc);
+		for (j = 0; j < s; j++) {
+			bn_free(_k[j]);
+		}
+		if (bkt != NULL) {
+			for (i = 0; i < s * h; i++) {
+				ep4_free(bkt[i]);
+			}
+		}
+		if (_w != NULL) {
+			for (i = 0; i < win; i++) {
+				ep4_free(_w[i]);
+			}
+		}
+		alloc_free((void *)bkt);
+		alloc_free((void *)_w);
+		alloc_free((void *)sk);
+		alloc_free((void *)sg);
+		alloc_free((void *)cr);
+	}
+}
+
+void ep4_mul_sim_lot(ep4_t r, ep4_t p[], const bn_t k[], int n) {
+	int c, l = 0;
+
+	for (int i = 0; i < n; i++) {
+		l = RLC_MAX(l, bn_bits(k[i]));
+	}
+	/* Scalars are split in 8 parts by the Frobenius decomposition. */
+	l = l / 8 + 1;
+
+	/* Interleaving uses wider windows for many points, adding every ~5 bits. */
+	if (bn_rec_bkt(&c, 8 * n, l, EP4_SIM_WMAX) < (size_t)l * (8 * n / 5 + 1)) {
+		ep4_mul_sim_lot_bucket(r, p, k, n);
+	} else {
+		ep4_mul_sim_lot_inter(r, p, k, n);
+	}
+}
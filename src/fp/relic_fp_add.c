@@ -87,6 +87,24 @@ void fp_add_dig(fp_t c, const fp_t a, dig_t b) {
 #endif
 }
 
+void fp_add_many(fp_t *c, const fp_t *a, const fp_t *b, int n) {
+	dig_t *t[8];
+	const dig_t *u[8], *v[8];
+	int i, j;
+
+	for (i = 0; i + 8 <= n; i += 8) {
+		for (j = 0; j < 8; j++) {
+			t[j] = c[i + j];
+			u[j] = a[i + j];
+			v[j] = b[i + j];
+		}
+		fp_addm_x8_low(t, u, v);
+	}
+	for (; i < n; i++) {
+		fp_addm_low(c[i], a[i], b[i]);
+	}
+}
+
 #if FP_ADD == BASIC || !defined(STRIP)
 
 void fp_sub_basic(fp_t c, const fp_t a, const fp_t b) {
@@ -138,6 +156,24 @@ void fp_sub_dig(fp_t c, const fp_t a, dig_t b) {
 #endif
 }
 
+void fp_sub_many(fp_t *c, const fp_t *a, const fp_t *b, int n) {
+	dig_t *t[8];
+	const dig_t *u[8], *v[8];
+	int i, j;
+
+	for (i = 0; i + 8 <= n; i += 8) {
+		for (j = 0; j < 8; j++) {
+			t[j] = c[i + j];
+			u[j] = a[i + j];
+			v[j] = b[i + j];
+		}
+		fp_subm_x8_low(t, u, v);
+	}
+	for (; i < n; i++) {
+		fp_subm_low(c[i], a[i], b[i]);
+	}
+}
+
 #if FP_ADD == BASIC || !defined(STRIP)
 
 void fp_neg_basic(fp_t c, const fp_t a) {
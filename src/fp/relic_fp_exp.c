@@ -189,3 +189,96 @@ void fp_exp_monty(fp_t c, const fp_t a, const bn_t b) {
 }
 
 #endif
+
+void fp_exp_many(fp_t *c, const fp_t *a, const bn_t b, int n) {
+	int i, j, k, l, s, w = 1 << (FP_WIDTH - 1), m = RLC_MIN(n, 32);
+	uint8_t win[RLC_FP_BITS + 1];
+	fp_t *t, *r;
+
+	if (n <= 0) {
+		return;
+	}
+
+	if (bn_is_zero(b)) {
+		for (j = 0; j < n; j++) {
+			fp_set_dig(c[j], 1);
+		}
+		return;
+	}
+
+	/* Bases are processed in blocks to bound the size of the tables. */
+	t = RLC_ALLOCA(fp_t, w * m);
+	r = RLC_ALLOCA(fp_t, m);
+
+	RLC_TRY {
+		if (t == NULL || r == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < w * m; i++) {
+			fp_null(t[i]);
+			fp_new(t[i]);
+		}
+		for (j = 0; j < m; j++) {
+			fp_null(r[j]);
+			fp_new(r[j]);
+		}
+
+		/* The recoding is shared, so all bases follow the same schedule. */
+		l = RLC_FP_BITS + 1;
+		bn_rec_slw(win, &l, b, FP_WIDTH);
+
+		for (k = 0; k < n; k += m) {
+			s = RLC_MIN(m, n - k);
+
+			/* Create the tables of all bases in the block at once. */
+			for (j = 0; j < s; j++) {
+				fp_copy(t[j], a[k + j]);
+			}
+			fp_sqr_many(r, (const fp_t *)t, s);
+			for (i = 1; i < w; i++) {
+				fp_mul_many(t + i * s, (const fp_t *)t + (i - 1) * s,
+						(const fp_t *)r, s);
+			}
+
+			for (j = 0; j < s; j++) {
+				fp_set_dig(r[j], 1);
+			}
+			for (i = 0; i < l; i++) {
+				if (win[i] == 0) {
+					fp_sqr_many(r, (const fp_t *)r, s);
+				} else {
+					for (j = 0; j < util_bits_dig(win[i]); j++) {
+						fp_sqr_many(r, (const fp_t *)r, s);
+					}
+					fp_mul_many(r, (const fp_t *)r,
+							(const fp_t *)t + (win[i] >> 1) * s, s);
+				}
+			}
+
+			if (bn_sign(b) == RLC_NEG) {
+				fp_inv_sim(c + k, (const fp_t *)r, s);
+			} else {
+				for (j = 0; j < s; j++) {
+					fp_copy(c[k + j], r[j]);
+				}
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		if (t != NULL) {
+			for (i = 0; i < w * m; i++) {
+				fp_free(t[i]);
+			}
+		}
+		if (r != NULL) {
+			for (j = 0; j < m; j++) {
+				fp_free(r[j]);
+			}
+		}
+		RLC_FREE(t);
+		RLC_FREE(r);
+	}
+}
@@ -511,39 +511,6 @@ void fp_inv_divst(fp_t c, const fp_t a) {
 
 #if FP_INV == JMPDS || !defined(STRIP)
 
-static dis_t jumpdivstep(dis_t m[4], dis_t delta, dig_t f, dig_t g, int s) {
-	dig_t u = 1, v = 0, q = 0, r = 1, c0, c1;
-
-	/* This is actually faster than my previous version, several tricks from
-	 * https://github.com/bitcoin-core/secp256k1/blob/master/src/modinv64_impl.h
-	 */
-	for (s--; s >= 0; s--) {
-		/* First handle the else part: if delta < 0, compute -(f,u,v). */
-		c0 = delta >> (RLC_DIG - 1);
-		c1 = -(g & 1);
-		c0 &= c1;
-		/* Conditionally add -(f,u,v) to (g,q,r) */
-		g += ((f ^ c0) - c0) & c1;
-		q += ((u ^ c0) - c0) & c1;
-		r += ((v ^ c0) - c0) & c1;
-		/* Now handle the 'if' part, so c0 will be (delta < 0) && (g & 1)) */
-		/* delta = RLC_SEL(delta, -delta, c0 & 1) - 2 (for half-divstep), thus
-		 * delta = - delta - 2 or delta - 1 */
-		delta = (delta ^ c0) - 1;
-		f = f + (g & c0);
-		u = u + (q & c0);
-		v = v + (r & c0);
-		g >>= 1;
-		u += u;
-		v += v;
-	}
-	m[0] = u;
-	m[1] = v;
-	m[2] = q;
-	m[3] = r;
-	return delta;
-}
-
 static inline void bn_mul2_low(dig_t *c, const dig_t *a, dis_t digit, int size) {
 	int sd = digit >> (RLC_DIG - 1);
 	digit = (digit ^ sd) - sd;
@@ -614,7 +581,7 @@ void fp_inv_jmpds(fp_t c, const fp_t a) {
 #else
 		fp_copy(g, a);
 #endif
-		d = jumpdivstep(m, d, f[0] & RLC_MASK(s), g[0] & RLC_MASK(s), s);
+		d = fp_invds_low(m, d, f[0] & RLC_MASK(s), g[0] & RLC_MASK(s), s);
 
 		t0[RLC_FP_DIGS] = bn_muls_low(t0, f, RLC_POS, m[0], RLC_FP_DIGS);
 		t1[RLC_FP_DIGS] = bn_muls_low(t1, g, RLC_POS, m[1], RLC_FP_DIGS);
@@ -643,7 +610,7 @@ void fp_inv_jmpds(fp_t c, const fp_t a) {
 		loops = (iterations % s == 0 ? loops - 1 : loops);
 
 		for (i = 1; i < loops; i++) {
-			d = jumpdivstep(m, d, f[0] & RLC_MASK(s), g[0] & RLC_MASK(s), s);
+			d = fp_invds_low(m, d, f[0] & RLC_MASK(s), g[0] & RLC_MASK(s), s);
 
 			t0[RLC_FP_DIGS] = bn_muls_low(t0, f, RLC_SIGN(f[RLC_FP_DIGS]), m[0], RLC_FP_DIGS);
 			t1[RLC_FP_DIGS] = bn_muls_low(t1, g, RLC_SIGN(g[RLC_FP_DIGS]), m[1], RLC_FP_DIGS);
@@ -720,7 +687,7 @@ void fp_inv_jmpds(fp_t c, const fp_t a) {
 		}
 
 		s = iterations - loops * s;
-		d = jumpdivstep(m, d, f[0] & RLC_MASK(s), g[0] & RLC_MASK(s), s);
+		d = fp_invds_low(m, d, f[0] & RLC_MASK(s), g[0] & RLC_MASK(s), s);
 
 		t0[RLC_FP_DIGS] = bn_muls_low(t0, f, RLC_SIGN(f[RLC_FP_DIGS]), m[0], RLC_FP_DIGS);
 		t1[RLC_FP_DIGS] = bn_muls_low(t1, g, RLC_SIGN(g[RLC_FP_DIGS]), m[1], RLC_FP_DIGS);
@@ -176,6 +176,29 @@ void fp_mul_dig(fp_t c, const fp_t a, dig_t b) {
 	}
 }
 
+void fp_mul_x8(fp_t *c, const fp_t *a, const fp_t *b) {
+	dig_t *t[8];
+	const dig_t *u[8], *v[8];
+
+	for (int i = 0; i < 8; i++) {
+		t[i] = c[i];
+		u[i] = a[i];
+		v[i] = b[i];
+	}
+	fp_mulm_x8_low(t, u, v);
+}
+
+void fp_mul_many(fp_t *c, const fp_t *a, const fp_t *b, int n) {
+	int i;
+
+	for (i = 0; i + 8 <= n; i += 8) {
+		fp_mul_x8(c + i, a + i, b + i);
+	}
+	for (; i < n; i++) {
+		fp_mul(c[i], a[i], b[i]);
+	}
+}
+
 #if FP_MUL == BASIC || !defined(STRIP)
 
 void fp_mul_basic(fp_t c, const fp_t a, const fp_t b) {
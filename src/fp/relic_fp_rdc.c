@@ -106,3 +106,22 @@ void fp_rdc_quick(fp_t c, dv_t a) {
 }
 
 #endif
+
+void fp_rdc_many(fp_t *c, dv_t *a, int n) {
+	int i = 0;
+#if FP_RDC == MONTY
+	dig_t *t[8];
+	const dig_t *u[8];
+
+	for (; i + 8 <= n; i += 8) {
+		for (int j = 0; j < 8; j++) {
+			t[j] = c[i + j];
+			u[j] = a[i + j];
+		}
+		fp_rdcn_x8_low(t, u);
+	}
+#endif
+	for (; i < n; i++) {
+		fp_rdc(c[i], a[i]);
+	}
+}
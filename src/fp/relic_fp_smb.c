@@ -170,40 +170,6 @@ int fp_smb_divst(const fp_t a) {
 
 #if FP_SMB == JMPDS || !defined(STRIP)
 
-static dis_t jumpdivstep(dis_t m[4], dig_t *k, dis_t delta, dis_t x, dis_t y, int s) {
-	dig_t c0, c1, yi, ai = 1, bi = 0, ci = 0, di = 1, u = 0;
-	for (; s > 0; s--) {
-		yi = y;
-
-		c0 = ~(delta >> (RLC_DIG - 1));
-		c1 = -(x & 1);
-		c0 &= c1;
-
-		x += ((y ^ c0) - c0) & c1;
-		ai += ((ci ^ c0) - c0) & c1;
-		bi += ((di ^ c0) - c0) & c1;
-
-		/* delta = RLC_SEL(delta + 1, -delta, c0) */
-		delta = (delta ^ c0) + 1;
-		y = y + (x & c0);
-		ci = ci + (ai & c0);
-		di = di + (bi & c0);
-		x >>= 1;
-		ci += ci;
-		di += di;
-
-		u += ((yi & y) ^ (y >> (dig_t)1)) & 2;
-		u += (u & (dig_t)1) ^ (ci >> (dig_t)(RLC_DIG - 1));
-		u %= 4;
-	}
-	m[0] = ai;
-	m[1] = bi;
-	m[2] = ci;
-	m[3] = di;
-	*k = u;
-	return delta;
-}
-
 int fp_smb_jmpds(const fp_t a) {
 	dis_t m[4], d = 0;
 	int r, i, s = RLC_DIG - 2;
@@ -263,7 +229,7 @@ int fp_smb_jmpds(const fp_t a) {
 
 		j = k = 0;
 		for (i = 0; i <= loops; i++) {
-			d = jumpdivstep(m, &k, d, f[0] & mask, g[0] & mask, s);
+			d = fp_smbds_low(m, &k, d, f[0] & mask, g[0] & mask, s);
 
 			t0[RLC_FP_DIGS] = bn_muls_low(t0, f, f[RLC_FP_DIGS] >> (RLC_DIG - 1), m[0], RLC_FP_DIGS);
 			t1[RLC_FP_DIGS] = bn_muls_low(t1, g, g[RLC_FP_DIGS] >> (RLC_DIG - 1), m[1], RLC_FP_DIGS);
@@ -249,3 +249,20 @@ void fp_sqr_karat(fp_t c, const fp_t a) {
 }
 
 #endif
+
+void fp_sqr_many(fp_t *c, const fp_t *a, int n) {
+	dig_t *t[8];
+	const dig_t *u[8];
+	int i, j;
+
+	for (i = 0; i + 8 <= n; i += 8) {
+		for (j = 0; j < 8; j++) {
+			t[j] = c[i + j];
+			u[j] = a[i + j];
+		}
+		fp_sqrm_x8_low(t, u);
+	}
+	for (; i < n; i++) {
+		fp_sqr(c[i], a[i]);
+	}
+}
@@ -135,3 +135,77 @@ int fp_srt(fp_t c, const fp_t a) {
 	}
 	return r;
 }
+
+int fp_srt_many(fp_t *c, int *b, const fp_t *a, int n) {
+	int i, k, l, r = 1, m = RLC_MIN(n, 32);
+	bn_t e;
+	fp_t *t, *u;
+
+	if (n <= 0) {
+		return 1;
+	}
+
+	if (fp_prime_get_mod8() != 3 && fp_prime_get_mod8() != 7) {
+		/* Tonelli-Shanks takes a data-dependent path, so go one by one. */
+		for (i = 0; i < n; i++) {
+			int s = fp_srt(c[i], a[i]);
+			if (b != NULL) {
+				b[i] = s;
+			}
+			r &= s;
+		}
+		return r;
+	}
+
+	bn_null(e);
+	t = RLC_ALLOCA(fp_t, m);
+	u = RLC_ALLOCA(fp_t, m);
+
+	RLC_TRY {
+		if (t == NULL || u == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		bn_new(e);
+		for (i = 0; i < m; i++) {
+			fp_null(t[i]);
+			fp_null(u[i]);
+			fp_new(t[i]);
+			fp_new(u[i]);
+		}
+
+		/* Compute all a^((p + 1)/4) with a shared schedule. */
+		e->used = RLC_FP_DIGS;
+		dv_copy(e->dp, fp_prime_get(), RLC_FP_DIGS);
+		bn_add_dig(e, e, 1);
+		bn_rsh(e, e, 2);
+
+		for (k = 0; k < n; k += m) {
+			l = RLC_MIN(m, n - k);
+			fp_exp_many(t, a + k, e, l);
+			fp_sqr_many(u, (const fp_t *)t, l);
+			for (i = 0; i < l; i++) {
+				int s = (fp_cmp(u[i], a[k + i]) == RLC_EQ);
+				if (b != NULL) {
+					b[k + i] = s;
+				}
+				r &= s;
+				fp_copy(c[k + i], t[i]);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(e);
+		if (t != NULL && u != NULL) {
+			for (i = 0; i < m; i++) {
+				fp_free(t[i]);
+				fp_free(u[i]);
+			}
+		}
+		RLC_FREE(t);
+		RLC_FREE(u);
+	}
+	return r;
+}
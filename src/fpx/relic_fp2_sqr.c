@@ -108,3 +108,48 @@ void fp2_sqr_integ(fp2_t c, fp2_t a) {
 }
 
 #endif
+
+void fp2_sqr_cyc(fp2_t c, fp2_t a) {
+	fp_t t0, t1, t2;
+
+	fp_null(t0);
+	fp_null(t1);
+	fp_null(t2);
+
+	RLC_TRY {
+		fp_new(t0);
+		fp_new(t1);
+		fp_new(t2);
+
+		/* Since a_0^2 = 1 + u^2 * a_1^2, only two squarings are needed. */
+		fp_sqr(t0, a[1]);
+		fp_add(t1, a[0], a[1]);
+		fp_sqr(t1, t1);
+
+		/* t2 = u^2 * a_1^2. */
+		if (fp_prime_get_qnr() == -1) {
+			fp_neg(t2, t0);
+		} else if (fp_prime_get_qnr() < 0) {
+			fp_mul_dig(t2, t0, -fp_prime_get_qnr());
+			fp_neg(t2, t2);
+		} else {
+			fp_mul_dig(t2, t0, fp_prime_get_qnr());
+		}
+
+		/* c_1 = 2 * a_0 * a_1 = (a_0 + a_1)^2 - a_1^2 - a_0^2. */
+		fp_sub(t1, t1, t0);
+		fp_sub(t1, t1, t2);
+		fp_sub_dig(c[1], t1, 1);
+		/* c_0 = a_0^2 + u^2 * a_1^2 = 2 * u^2 * a_1^2 + 1. */
+		fp_dbl(t2, t2);
+		fp_add_dig(c[0], t2, 1);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp_free(t0);
+		fp_free(t1);
+		fp_free(t2);
+	}
+}
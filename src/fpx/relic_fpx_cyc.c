@@ -32,6 +32,16 @@
 
 #include "relic_core.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Maximum window size used in the bucket method, which bounds the number of
+ * buckets allocated on the stack.
+ */
+#define FP_CYC_WMAX		10
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -702,6 +712,151 @@ void fp2_exp_cyc_sim(fp2_t e, fp2_t a, bn_t b, fp2_t c, bn_t d) {
 	}
 }
 
+void fp2_exp_cyc_lot(fp2_t c, fp2_t a[], bn_t b[], int n) {
+	int i, j, e, w, d, u, h = 0, l = 0, win = 0, one, two;
+	fp2_t t, v, acc, *bkt = NULL, *_w = NULL;
+	dig_t *sk = NULL;
+	int8_t *sg = NULL;
+	uint8_t *cr = NULL, *emp = NULL;
+
+	if (n == 0) {
+		fp2_set_dig(c, 1);
+		return;
+	}
+
+	fp2_null(t);
+	fp2_null(v);
+	fp2_null(acc);
+
+	RLC_TRY {
+		fp2_new(t);
+		fp2_new(v);
+		fp2_new(acc);
+
+		for (i = 0; i < n; i++) {
+			l = RLC_MAX(l, bn_bits(b[i]));
+		}
+		d = RLC_MAX(1, RLC_CEIL(l, RLC_DIG));
+		sk = RLC_MALLOC(dig_t, n * d);
+		sg = RLC_MALLOC(int8_t, n);
+		cr = RLC_MALLOC(uint8_t, n);
+		if (sk == NULL || sg == NULL || cr == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+
+		/* Recode the exponents as vectors of digits. */
+		for (i = 0; i < n; i++) {
+			bn_write_raw(sk + i * d, d, b[i]);
+			sg[i] = (bn_sign(b[i]) == RLC_NEG ? -1 : 1);
+			cr[i] = 0;
+		}
+
+		bn_rec_bkt(&w, n, l, FP_CYC_WMAX);
+		h = 1 << (w - 1);
+		win = l / w + 1;
+		bkt = RLC_MALLOC(fp2_t, h);
+		emp = RLC_MALLOC(uint8_t, h);
+		_w = RLC_MALLOC(fp2_t, win);
+		if (bkt == NULL || emp == NULL || _w == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < h; i++) {
+			fp2_null(bkt[i]);
+			fp2_new(bkt[i]);
+		}
+		for (i = 0; i < win; i++) {
+			fp2_null(_w[i]);
+			fp2_new(_w[i]);
+		}
+
+		/* Process windows from the least significant to propagate carries. */
+		for (j = 0; j < win; j++) {
+			for (i = 0; i < h; i++) {
+				emp[i] = 1;
+			}
+			for (i = 0; i < n; i++) {
+				u = bn_rec_get(sk + i * d, d, j * w, w) + cr[i];
+				cr[i] = 0;
+				if (u > h) {
+					u -= (1 << w);
+					cr[i] = 1;
+				}
+				if (u != 0) {
+					e = (u > 0 ? u : -u) - 1;
+					/* Inversion is a conjugation in the cyclotomic subgroup. */
+					if ((u > 0) == (sg[i] > 0)) {
+						fp2_copy(t, a[i]);
+					} else {
+						fp2_inv_cyc(t, a[i]);
+					}
+					if (emp[e]) {
+						fp2_copy(bkt[e], t);
+						emp[e] = 0;
+					} else {
+						fp2_mul(bkt[e], bkt[e], t);
+					}
+				}
+			}
+
+			/* Aggregate buckets as \Prod_e B_e^e using running products. */
+			one = two = 1;
+			for (e = h - 1; e >= 0; e--) {
+				if (!emp[e]) {
+					if (one) {
+						fp2_copy(t, bkt[e]);
+					} else {
+						fp2_mul(t, t, bkt[e]);
+					}
+					one = 0;
+				}
+				if (!one) {
+					if (two) {
+						fp2_copy(v, t);
+					} else {
+						fp2_mul(v, v, t);
+					}
+					two = 0;
+				}
+			}
+			if (two) {
+				fp2_set_dig(_w[j], 1);
+			} else {
+				fp2_copy(_w[j], v);
+			}
+		}
+
+		fp2_copy(acc, _w[win - 1]);
+		for (j = win - 2; j >= 0; j--) {
+			for (i = 0; i < w; i++) {
+				fp2_sqr_cyc(acc, acc);
+			}
+			fp2_mul(acc, acc, _w[j]);
+		}
+		fp2_copy(c, acc);
+	} RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	} RLC_FINALLY {
+		fp2_free(t);
+		fp2_free(v);
+		fp2_free(acc);
+		if (bkt != NULL) {
+			for (i = 0; i < h; i++) {
+				fp2_free(bkt[i]);
+			}
+		}
+		if (_w != NULL) {
+			for (i = 0; i < win; i++) {
+				fp2_free(_w[i]);
+			}
+		}
+		alloc_free((void *)bkt);
+		alloc_free((void *)emp);
+		alloc_free((void *)_w);
+		alloc_free((void *)sk);
+		alloc_free((void *)sg);
+		alloc_free((void *)cr);
+	}
+}
 
 void fp12_exp_cyc_sim(fp12_t e, fp12_t a, bn_t b, fp12_t c, bn_t d) {
 	int i, j, l;
@@ -735,8 +890,10 @@ void fp12_exp_cyc_sim(fp12_t e, fp12_t a, bn_t b, fp12_t c, bn_t d) {
 
 		ep_curve_get_ord(n);
 		fp_prime_get_par(x);
-		bn_rec_frb(_b, 4, b, x, n, ep_curve_is_pairf() == EP_B12);
-		bn_rec_frb(_d, 4, d, x, n, ep_curve_is_pairf() == EP_B12);
+		bn_rec_frb(_b, 4, b, x, n, ep_curve_is_pairf() == EP_B12 ||
+			ep_curve_is_pairf() == EP_B24 || ep_curve_is_pairf() == EP_B48);
+		bn_rec_frb(_d, 4, d, x, n, ep_curve_is_pairf() == EP_B12 ||
+			ep_curve_is_pairf() == EP_B24 || ep_curve_is_pairf() == EP_B48);
 
 		if (ep_curve_is_pairf()) {
 			for (i = 0; i < 4; i++) {
@@ -805,6 +962,192 @@ void fp12_exp_cyc_sim(fp12_t e, fp12_t a, bn_t b, fp12_t c, bn_t d) {
 	}
 }
 
+void fp12_exp_cyc_lot(fp12_t c, fp12_t a[], bn_t b[], int n) {
+	int s = 1;
+	int i, j, m, e, w, d, u, h = 0, l = 0, win = 0, one, two;
+	bn_t q, x, _b[4];
+	fp12_t t, v, acc, *bkt = NULL, *_w = NULL;
+	dig_t *sk = NULL;
+	int8_t *sg = NULL;
+	uint8_t *cr = NULL, *emp = NULL;
+
+	if (n == 0) {
+		fp12_set_dig(c, 1);
+		return;
+	}
+
+	bn_null(q);
+	bn_null(x);
+	fp12_null(t);
+	fp12_null(v);
+	fp12_null(acc);
+
+	RLC_TRY {
+		bn_new(q);
+		bn_new(x);
+		fp12_new(t);
+		fp12_new(v);
+		fp12_new(acc);
+		for (j = 0; j < 4; j++) {
+			bn_null(_b[j]);
+			bn_new(_b[j]);
+		}
+
+		if (ep_curve_is_pairf()) {
+			s = 4;
+		}
+		/* Recode the exponents as vectors of digits. */
+		if (s > 1) {
+			ep_curve_get_ord(q);
+			fp_prime_get_par(x);
+			d = RLC_CEIL(bn_bits(q), s * RLC_DIG) + 1;
+		} else {
+			for (i = 0; i < n; i++) {
+				l = RLC_MAX(l, bn_bits(b[i]));
+			}
+			d = RLC_MAX(1, RLC_CEIL(l, RLC_DIG));
+		}
+		sk = RLC_MALLOC(dig_t, s * n * d);
+		sg = RLC_MALLOC(int8_t, s * n);
+		cr = RLC_MALLOC(uint8_t, s * n);
+		if (sk == NULL || sg == NULL || cr == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+
+		for (i = 0; i < n; i++) {
+			if (s > 1) {
+				bn_mod(_b[0], b[i], q);
+				bn_rec_frb(_b, s, _b[0], x, q, ep_curve_is_pairf() == EP_B12 ||
+					ep_curve_is_pairf() == EP_B24 ||
+					ep_curve_is_pairf() == EP_B48);
+			} else {
+				bn_copy(_b[0], b[i]);
+			}
+			for (j = 0; j < s; j++) {
+				bn_write_raw(sk + (s * i + j) * d, d, _b[j]);
+				sg[s * i + j] = (bn_sign(_b[j]) == RLC_NEG ? -1 : 1);
+				cr[s * i + j] = 0;
+				l = RLC_MAX(l, bn_bits(_b[j]));
+			}
+		}
+
+		bn_rec_bkt(&w, s * n, l, FP_CYC_WMAX);
+		h = 1 << (w - 1);
+		win = l / w + 1;
+		bkt = RLC_MALLOC(fp12_t, s * h);
+		emp = RLC_MALLOC(uint8_t, s * h);
+		_w = RLC_MALLOC(fp12_t, win);
+		if (bkt == NULL || emp == NULL || _w == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < s * h; i++) {
+			fp12_null(bkt[i]);
+			fp12_new(bkt[i]);
+		}
+		for (i = 0; i < win; i++) {
+			fp12_null(_w[i]);
+			fp12_new(_w[i]);
+		}
+
+		/* Process windows from the least significant to propagate carries. */
+		for (j = 0; j < win; j++) {
+			for (i = 0; i < s * h; i++) {
+				emp[i] = 1;
+			}
+			for (i = 0; i < s * n; i++) {
+				u = bn_rec_get(sk + i * d, d, j * w, w) + cr[i];
+				cr[i] = 0;
+				if (u > h) {
+					u -= (1 << w);
+					cr[i] = 1;
+				}
+				if (u != 0) {
+					e = (i % s) * h + (u > 0 ? u : -u) - 1;
+					/* Inversion is a conjugation in the cyclotomic subgroup. */
+					if ((u > 0) == (sg[i] > 0)) {
+						fp12_copy(t, a[i / s]);
+					} else {
+						fp12_inv_cyc(t, a[i / s]);
+					}
+					if (emp[e]) {
+						fp12_copy(bkt[e], t);
+						emp[e] = 0;
+					} else {
+						fp12_mul(bkt[e], bkt[e], t);
+					}
+				}
+			}
+
+			/* Aggregate buckets as \Prod_e B_e^e using running products. */
+			fp12_set_dig(acc, 1);
+			for (m = s - 1; m >= 0; m--) {
+				if (m < s - 1) {
+					fp12_frb(acc, acc, 1);
+				}
+				one = two = 1;
+				for (e = h - 1; e >= 0; e--) {
+					if (!emp[m * h + e]) {
+						if (one) {
+							fp12_copy(t, bkt[m * h + e]);
+						} else {
+							fp12_mul(t, t, bkt[m * h + e]);
+						}
+						one = 0;
+					}
+					if (!one) {
+						if (two) {
+							fp12_copy(v, t);
+						} else {
+							fp12_mul(v, v, t);
+						}
+						two = 0;
+					}
+				}
+				if (!two) {
+					fp12_mul(acc, acc, v);
+				}
+			}
+			fp12_copy(_w[j], acc);
+		}
+
+		fp12_copy(acc, _w[win - 1]);
+		for (j = win - 2; j >= 0; j--) {
+			for (i = 0; i < w; i++) {
+				fp12_sqr_cyc(acc, acc);
+			}
+			fp12_mul(acc, acc, _w[j]);
+		}
+		fp12_copy(c, acc);
+	} RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	} RLC_FINALLY {
+		bn_free(q);
+		bn_free(x);
+		fp12_free(t);
+		fp12_free(v);
+		fp12_free(acc);
+		for (j = 0; j < 4; j++) {
+			bn_free(_b[j]);
+		}
+		if (bkt != NULL) {
+			for (i = 0; i < s * h; i++) {
+				fp12_free(bkt[i]);
+			}
+		}
+		if (_w != NULL) {
+			for (i = 0; i < win; i++) {
+				fp12_free(_w[i]);
+			}
+		}
+		alloc_free((void *)bkt);
+		alloc_free((void *)emp);
+		alloc_free((void *)_w);
+		alloc_free((void *)sk);
+		alloc_free((void *)sg);
+		alloc_free((void *)cr);
+	}
+}
+
 void fp12_exp_cyc_sps(fp12_t c, fp12_t a, const int *b, int len, int sign) {
 	int i, j, k, w = len;
     fp12_t t, *u = RLC_ALLOCA(fp12_t, w);
@@ -1333,6 +1676,190 @@ void fp24_exp_cyc_sim(fp24_t e, fp24_t a, bn_t b, fp24_t c, bn_t d) {
 	}
 }
 
+void fp24_exp_cyc_lot(fp24_t c, fp24_t a[], bn_t b[], int n) {
+	int s = 1;
+	int i, j, m, e, w, d, u, h = 0, l = 0, win = 0, one, two;
+	bn_t q, x, _b[8];
+	fp24_t t, v, acc, *bkt = NULL, *_w = NULL;
+	dig_t *sk = NULL;
+	int8_t *sg = NULL;
+	uint8_t *cr = NULL, *emp = NULL;
+
+	if (n == 0) {
+		fp24_set_dig(c, 1);
+		return;
+	}
+
+	bn_null(q);
+	bn_null(x);
+	fp24_null(t);
+	fp24_null(v);
+	fp24_null(acc);
+
+	RLC_TRY {
+		bn_new(q);
+		bn_new(x);
+		fp24_new(t);
+		fp24_new(v);
+		fp24_new(acc);
+		for (j = 0; j < 8; j++) {
+			bn_null(_b[j]);
+			bn_new(_b[j]);
+		}
+
+		if (ep_curve_is_pairf()) {
+			s = 8;
+		}
+		/* Recode the exponents as vectors of digits. */
+		if (s > 1) {
+			ep_curve_get_ord(q);
+			fp_prime_get_par(x);
+			d = RLC_CEIL(bn_bits(q), s * RLC_DIG) + 1;
+		} else {
+			for (i = 0; i < n; i++) {
+				l = RLC_MAX(l, bn_bits(b[i]));
+			}
+			d = RLC_MAX(1, RLC_CEIL(l, RLC_DIG));
+		}
+		sk = RLC_MALLOC(dig_t, s * n * d);
+		sg = RLC_MALLOC(int8_t, s * n);
+		cr = RLC_MALLOC(uint8_t, s * n);
+		if (sk == NULL || sg == NULL || cr == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+
+		for (i = 0; i < n; i++) {
+			if (s > 1) {
+				bn_mod(_b[0], b[i], q);
+				bn_rec_frb(_b, s, _b[0], x, q, ep_curve_is_pairf());
+			} else {
+				bn_copy(_b[0], b[i]);
+			}
+			for (j = 0; j < s; j++) {
+				bn_write_raw(sk + (s * i + j) * d, d, _b[j]);
+				sg[s * i + j] = (bn_sign(_b[j]) == RLC_NEG ? -1 : 1);
+				cr[s * i + j] = 0;
+				l = RLC_MAX(l, bn_bits(_b[j]));
+			}
+		}
+
+		bn_rec_bkt(&w, s * n, l, FP_CYC_WMAX);
+		h = 1 << (w - 1);
+		win = l / w + 1;
+		bkt = RLC_MALLOC(fp24_t, s * h);
+		emp = RLC_MALLOC(uint8_t, s * h);
+		_w = RLC_MALLOC(fp24_t, win);
+		if (bkt == NULL || emp == NULL || _w == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < s * h; i++) {
+			fp24_null(bkt[i]);
+			fp24_new(bkt[i]);
+		}
+		for (i = 0; i < win; i++) {
+			fp24_null(_w[i]);
+			fp24_new(_w[i]);
+		}
+
+		/* Process windows from the least significant to propagate carries. */
+		for (j = 0; j < win; j++) {
+			for (i = 0; i < s * h; i++) {
+				emp[i] = 1;
+			}
+			for (i = 0; i < s * n; i++) {
+				u = bn_rec_get(sk + i * d, d, j * w, w) + cr[i];
+				cr[i] = 0;
+				if (u > h) {
+					u -= (1 << w);
+					cr[i] = 1;
+				}
+				if (u != 0) {
+					e = (i % s) * h + (u > 0 ? u : -u) - 1;
+					/* Inversion is a conjugation in the cyclotomic subgroup. */
+					if ((u > 0) == (sg[i] > 0)) {
+						fp24_copy(t, a[i / s]);
+					} else {
+						fp24_inv_cyc(t, a[i / s]);
+					}
+					if (emp[e]) {
+						fp24_copy(bkt[e], t);
+						emp[e] = 0;
+					} else {
+						fp24_mul(bkt[e], bkt[e], t);
+					}
+				}
+			}
+
+			/* Aggregate buckets as \Prod_e B_e^e using running products. */
+			fp24_set_dig(acc, 1);
+			for (m = s - 1; m >= 0; m--) {
+				if (m < s - 1) {
+					fp24_frb(acc, acc, 1);
+				}
+				one = two = 1;
+				for (e = h - 1; e >= 0; e--) {
+					if (!emp[m * h + e]) {
+						if (one) {
+							fp24_copy(t, bkt[m * h + e]);
+						} else {
+							fp24_mul(t, t, bkt[m * h + e]);
+						}
+						one = 0;
+					}
+					if (!one) {
+						if (two) {
+							fp24_copy(v, t);
+						} else {
+							fp24_mul(v, v, t);
+						}
+						two = 0;
+					}
+				}
+				if (!two) {
+					fp24_mul(acc, acc, v);
+				}
+			}
+			fp24_copy(_w[j], acc);
+		}
+
+		fp24_copy(acc, _w[win - 1]);
+		for (j = win - 2; j >= 0; j--) {
+			for (i = 0; i < w; i++) {
+				fp24_sqr_cyc(acc, acc);
+			}
+			fp24_mul(acc, acc, _w[j]);
+		}
+		fp24_copy(c, acc);
+	} RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	} RLC_FINALLY {
+		bn_free(q);
+		bn_free(x);
+		fp24_free(t);
+		fp24_free(v);
+		fp24_free(acc);
+		for (j = 0; j < 8; j++) {
+			bn_free(_b[j]);
+		}
+		if (bkt != NULL) {
+			for (i = 0; i < s * h; i++) {
+				fp24_free(bkt[i]);
+			}
+		}
+		if (_w != NULL) {
+			for (i = 0; i < win; i++) {
+				fp24_free(_w[i]);
+			}
+		}
+		alloc_free((void *)bkt);
+		alloc_free((void *)emp);
+		alloc_free((void *)_w);
+		alloc_free((void *)sk);
+		alloc_free((void *)sg);
+		alloc_free((void *)cr);
+	}
+}
+
 void fp24_exp_cyc_sps(fp24_t c, fp24_t a, const int *b, int len, int sign) {
 	int i, j, k, w = len;
     fp24_t t, *u = RLC_ALLOCA(fp24_t, w);
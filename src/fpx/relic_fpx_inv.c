@@ -609,6 +609,49 @@ void fp12_inv_cyc(fp12_t c, fp12_t a) {
 	fp6_neg(c[1], a[1]);
 }
 
+void fp12_inv_sim(fp12_t *c, fp12_t *a, int n) {
+	int i;
+	fp12_t u, *t = RLC_ALLOCA(fp12_t, n);
+
+	for (i = 0; i < n; i++) {
+		fp12_null(t[i]);
+	}
+	fp12_null(u);
+
+	RLC_TRY {
+		for (i = 0; i < n; i++) {
+			fp12_new(t[i]);
+		}
+		fp12_new(u);
+
+		fp12_copy(c[0], a[0]);
+		fp12_copy(t[0], a[0]);
+
+		for (i = 1; i < n; i++) {
+			fp12_copy(t[i], a[i]);
+			fp12_mul(c[i], c[i - 1], t[i]);
+		}
+
+		fp12_inv(u, c[n - 1]);
+
+		for (i = n - 1; i > 0; i--) {
+			fp12_mul(c[i], c[i - 1], u);
+			fp12_mul(u, u, t[i]);
+		}
+		fp12_copy(c[0], u);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < n; i++) {
+			fp12_free(t[i]);
+		}
+		fp12_free(u);
+		RLC_FREE(t);
+	}
+}
+
 void fp18_inv(fp18_t c, fp18_t a) {
 	fp9_t t0;
 	fp9_t t1;
@@ -708,6 +751,49 @@ void fp24_inv_cyc(fp24_t c, fp24_t a) {
 	fp8_inv_cyc(c[2], a[2]);
 }
 
+void fp24_inv_sim(fp24_t *c, fp24_t *a, int n) {
+	int i;
+	fp24_t u, *t = RLC_ALLOCA(fp24_t, n);
+
+	for (i = 0; i < n; i++) {
+		fp24_null(t[i]);
+	}
+	fp24_null(u);
+
+	RLC_TRY {
+		for (i = 0; i < n; i++) {
+			fp24_new(t[i]);
+		}
+		fp24_new(u);
+
+		fp24_copy(c[0], a[0]);
+		fp24_copy(t[0], a[0]);
+
+		for (i = 1; i < n; i++) {
+			fp24_copy(t[i], a[i]);
+			fp24_mul(c[i], c[i - 1], t[i]);
+		}
+
+		fp24_inv(u, c[n - 1]);
+
+		for (i = n - 1; i > 0; i--) {
+			fp24_mul(c[i], c[i - 1], u);
+			fp24_mul(u, u, t[i]);
+		}
+		fp24_copy(c[0], u);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < n; i++) {
+			fp24_free(t[i]);
+		}
+		fp24_free(u);
+		RLC_FREE(t);
+	}
+}
+
 void fp48_inv(fp48_t c, fp48_t a) {
 	fp24_t t0;
 	fp24_t t1;
@@ -741,6 +827,49 @@ void fp48_inv_cyc(fp48_t c, fp48_t a) {
 	fp24_neg(c[1], a[1]);
 }
 
+void fp48_inv_sim(fp48_t *c, fp48_t *a, int n) {
+	int i;
+	fp48_t u, *t = RLC_ALLOCA(fp48_t, n);
+
+	for (i = 0; i < n; i++) {
+		fp48_null(t[i]);
+	}
+	fp48_null(u);
+
+	RLC_TRY {
+		for (i = 0; i < n; i++) {
+			fp48_new(t[i]);
+		}
+		fp48_new(u);
+
+		fp48_copy(c[0], a[0]);
+		fp48_copy(t[0], a[0]);
+
+		for (i = 1; i < n; i++) {
+			fp48_copy(t[i], a[i]);
+			fp48_mul(c[i], c[i - 1], t[i]);
+		}
+
+		fp48_inv(u, c[n - 1]);
+
+		for (i = n - 1; i > 0; i--) {
+			fp48_mul(c[i], c[i - 1], u);
+			fp48_mul(u, u, t[i]);
+		}
+		fp48_copy(c[0], u);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < n; i++) {
+			fp48_free(t[i]);
+		}
+		fp48_free(u);
+		RLC_FREE(t);
+	}
+}
+
 void fp54_inv(fp54_t c, fp54_t a) {
 	fp18_t v0;
 	fp18_t v1;
@@ -127,6 +127,116 @@ int fp2_srt(fp2_t c, fp2_t a) {
 	return r;
 }
 
+int fp2_srt_many(fp2_t *c, int *b, fp2_t *a, int n) {
+	int i, j, k, h, l, q, r = 1, m = RLC_MIN(n, 32);
+	int f[32], g[32], idx[32], pos[32];
+	fp_t *t, *u, *v, *w;
+
+	if (n <= 0) {
+		return 1;
+	}
+
+	t = RLC_ALLOCA(fp_t, 4 * m);
+
+	RLC_TRY {
+		if (t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < 4 * m; i++) {
+			fp_null(t[i]);
+			fp_new(t[i]);
+		}
+		u = t + m;
+		v = t + 2 * m;
+		w = t + 3 * m;
+
+		for (j = 0; j < n; j += m) {
+			l = RLC_MIN(m, n - j);
+
+			/* Handle a_1 = 0 apart, else compute t = a_0^2 - i^2 * a_1^2. */
+			for (i = k = 0; i < l; i++) {
+				if (fp_is_zero(a[j + i][1])) {
+					f[i] = fp2_srt(c[j + i], a[j + i]);
+					continue;
+				}
+				f[i] = 0;
+				idx[k] = i;
+				fp_sqr(t[k], a[j + i][0]);
+				fp_sqr(u[k], a[j + i][1]);
+				for (q = -1; q > fp_prime_get_qnr(); q--) {
+					fp_add(t[k], t[k], u[k]);
+				}
+				fp_add(t[k], t[k], u[k]);
+				k++;
+			}
+
+			/* Elements whose norms are not squares have no square roots. */
+			fp_srt_many(u, g, (const fp_t *)t, k);
+			for (q = h = 0; q < k; q++) {
+				if (g[q]) {
+					idx[h] = idx[q];
+					fp_copy(u[h], u[q]);
+					fp_add(v[h], a[j + idx[h]][0], u[h]);
+					fp_hlv(v[h], v[h]);
+					h++;
+				}
+			}
+			k = h;
+
+			/* Try (a_0 + sqrt(t)) / 2 first, then (a_0 - sqrt(t)) / 2. */
+			fp_srt_many(w, g, (const fp_t *)v, k);
+			for (q = h = 0; q < k; q++) {
+				if (!g[q]) {
+					pos[h] = q;
+					fp_sub(t[h], a[j + idx[q]][0], u[q]);
+					fp_hlv(t[h], t[h]);
+					h++;
+				}
+			}
+			if (!fp_srt_many(t, NULL, (const fp_t *)t, h)) {
+				/* should never happen! */
+				RLC_THROW(ERR_NO_VALID);
+			}
+			for (q = 0; q < h; q++) {
+				fp_copy(w[pos[q]], t[q]);
+			}
+
+			/* c_0 = sqrt(t0), c_1 = a_1 / (2 * c_0), sharing the inversions. */
+			for (q = 0; q < k; q++) {
+				fp_dbl(v[q], w[q]);
+			}
+			if (k > 0) {
+				fp_inv_sim(v, (const fp_t *)v, k);
+			}
+			for (q = 0; q < k; q++) {
+				i = idx[q];
+				fp_copy(c[j + i][0], w[q]);
+				fp_mul(c[j + i][1], a[j + i][1], v[q]);
+				f[i] = 1;
+			}
+
+			for (i = 0; i < l; i++) {
+				if (b != NULL) {
+					b[j + i] = f[i];
+				}
+				r &= f[i];
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		if (t != NULL) {
+			for (i = 0; i < 4 * m; i++) {
+				fp_free(t[i]);
+			}
+		}
+		RLC_FREE(t);
+	}
+	return r;
+}
+
 int fp3_srt(fp3_t c, fp3_t a) {
 	int r = 0;
 	fp3_t t0, t1, t2, t3;
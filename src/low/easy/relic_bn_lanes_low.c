@@ -0,0 +1,63 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2023 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the low-level multiple precision modular arithmetic
+ * functions operating on several independent integers at once.
+ *
+ * @ingroup bn
+ */
+
+#include "relic_core.h"
+#include "relic_bn_low.h"
+#include "relic_util.h"
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void bn_mulm_x8_low(dig_t *c[], const dig_t *a[], const dig_t *b[],
+		const dig_t *m, dig_t u, int size) {
+	dig_t t[2 * RLC_BN_SIZE];
+	int i;
+
+	for (i = 0; i < 8; i++) {
+		bn_muln_low(t, a[i], b[i], size);
+		bn_modn_low(c[i], t, 2 * size, m, size, u);
+		if (dv_cmp(c[i], m, size) != RLC_LT) {
+			bn_subn_low(c[i], c[i], m, size);
+		}
+	}
+}
+
+void bn_rdcm_x8_low(dig_t *c[], const dig_t *a[], const dig_t *m, dig_t u,
+		int size) {
+	for (int i = 0; i < 8; i++) {
+		bn_modn_low(c[i], a[i], 2 * size, m, size, u);
+		if (dv_cmp(c[i], m, size) != RLC_LT) {
+			bn_subn_low(c[i], c[i], m, size);
+		}
+	}
+}
@@ -0,0 +1,105 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2023 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the low-level division steps used by the constant-time
+ * inversion and Legendre symbol computation.
+ *
+ * @ingroup fp
+ */
+
+#include "relic_fp.h"
+#include "relic_fp_low.h"
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+dis_t fp_invds_low(dis_t m[4], dis_t delta, dig_t f, dig_t g, int s) {
+	dig_t u = 1, v = 0, q = 0, r = 1, c0, c1;
+
+	/* Several tricks from
+	 * https://github.com/bitcoin-core/secp256k1/blob/master/src/modinv64_impl.h
+	 */
+	for (; s > 0; s--) {
+		/* Negate (f,u,v) if delta < 0, independently of g. */
+		c0 = delta >> (RLC_DIG - 1);
+		c1 = -(g & 1);
+		/* Conditionally add -(f,u,v) or (f,u,v) to (g,q,r). */
+		g += ((f ^ c0) - c0) & c1;
+		q += ((u ^ c0) - c0) & c1;
+		r += ((v ^ c0) - c0) & c1;
+		/* Now handle the 'if' part, so c0 will be (delta < 0) && (g & 1)) */
+		c0 &= c1;
+		/* delta = RLC_SEL(delta, -delta, c0 & 1) - 2 (for half-divstep), thus
+		 * delta = - delta - 2 or delta - 1 */
+		delta = (delta ^ c0) - 1;
+		f += g & c0;
+		u += q & c0;
+		v += r & c0;
+		g >>= 1;
+		u += u;
+		v += v;
+	}
+	m[0] = u;
+	m[1] = v;
+	m[2] = q;
+	m[3] = r;
+	return delta;
+}
+
+dis_t fp_smbds_low(dis_t m[4], dig_t *k, dis_t delta, dig_t f, dig_t g,
+		int s) {
+	dig_t c0, c1, fi, a = 1, b = 0, c = 0, d = 1, u = 0;
+
+	for (; s > 0; s--) {
+		fi = g;
+		/* Negate (g,c,d) if delta >= 0, independently of f. */
+		c0 = ~(delta >> (RLC_DIG - 1));
+		c1 = -(f & 1);
+		f += ((g ^ c0) - c0) & c1;
+		a += ((c ^ c0) - c0) & c1;
+		b += ((d ^ c0) - c0) & c1;
+		c0 &= c1;
+		/* delta = RLC_SEL(delta + 1, -delta, c0) */
+		delta = (delta ^ c0) + 1;
+		g += f & c0;
+		c += a & c0;
+		d += b & c0;
+		f = (dis_t)f >> 1;
+		c += c;
+		d += d;
+
+		u += ((fi & g) ^ ((dis_t)g >> 1)) & 2;
+		u += (u & (dig_t)1) ^ (c >> (RLC_DIG - 1));
+		u %= 4;
+	}
+	m[0] = a;
+	m[1] = b;
+	m[2] = c;
+	m[3] = d;
+	*k = u;
+	return delta;
+}
@@ -0,0 +1,69 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2023 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the low-level prime field arithmetic functions
+ * operating on several independent elements at once.
+ *
+ * @ingroup fp
+ */
+
+#include "relic_fp.h"
+#include "relic_fp_low.h"
+#include "relic_util.h"
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void fp_addm_x8_low(dig_t *c[], const dig_t *a[], const dig_t *b[]) {
+	for (int i = 0; i < 8; i++) {
+		fp_addm_low(c[i], a[i], b[i]);
+	}
+}
+
+void fp_subm_x8_low(dig_t *c[], const dig_t *a[], const dig_t *b[]) {
+	for (int i = 0; i < 8; i++) {
+		fp_subm_low(c[i], a[i], b[i]);
+	}
+}
+
+void fp_mulm_x8_low(dig_t *c[], const dig_t *a[], const dig_t *b[]) {
+	for (int i = 0; i < 8; i++) {
+		fp_mulm_low(c[i], a[i], b[i]);
+	}
+}
+
+void fp_sqrm_x8_low(dig_t *c[], const dig_t *a[]) {
+	for (int i = 0; i < 8; i++) {
+		fp_sqrm_low(c[i], a[i]);
+	}
+}
+
+void fp_rdcn_x8_low(dig_t *c[], const dig_t *a[]) {
+	for (int i = 0; i < 8; i++) {
+		fp_rdcn_low(c[i], (dig_t *)a[i]);
+	}
+}
@@ -0,0 +1,174 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2023 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the low-level division steps used by the constant-time
+ * inversion and Legendre symbol computation.
+ *
+ * The division steps are computed in chunks. In each chunk, the least
+ * significant bits of f and the entries of its row of the transition matrix
+ * are packed in a single 64-bit word, and the same for g, so that every step
+ * only updates two words.
+ *
+ * @ingroup fp
+ */
+
+#include "relic_fp.h"
+#include "relic_fp_low.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Maximum number of division steps in a chunk.
+ */
+#define STEPS		19
+
+/**
+ * Position of the first entry of the transition matrix in a packed word.
+ */
+#define LO			20
+
+/**
+ * Position of the second entry of the transition matrix in a packed word.
+ */
+#define HI			41
+
+/**
+ * Applies division steps to two packed words for the inversion.
+ *
+ * @param[in,out] v			- the packed words for f and g.
+ * @param[in] delta			- the current value of delta.
+ * @param[in] k				- the number of division steps.
+ * @return the updated value of delta.
+ */
+dis_t fp_invds_asm(dis_t *v, dis_t delta, int k);
+
+/**
+ * Applies division steps to two packed words for the Legendre symbol.
+ *
+ * @param[in,out] v			- the packed words for f and g, followed by two
+ * 							  coefficients derived from the first column of
+ * 							  the transition matrix and the sign changes.
+ * @param[in] delta			- the current value of delta.
+ * @param[in] k				- the number of division steps.
+ * @return the updated value of delta.
+ */
+dis_t fp_smbds_asm(dis_t *v, dis_t delta, int k);
+
+/**
+ * Packs the least significant bits of a value and the entry of the transition
+ * matrix scaling it in a chunk of k steps.
+ *
+ * @param[in] a				- the value.
+ * @param[in] pos			- the position of the entry.
+ * @param[in] k				- the number of division steps.
+ * @return the packed word.
+ */
+static dis_t fp_pack(dig_t a, int pos, int k) {
+	return (a & RLC_MASK(STEPS)) + ((dig_t)1 << (k + pos));
+}
+
+/**
+ * Extracts the entries of the transition matrix from a packed word.
+ *
+ * @param[out] a			- the first entry.
+ * @param[out] b			- the second entry.
+ * @param[in] w				- the packed word.
+ */
+static void fp_unpack(dis_t *a, dis_t *b, dis_t w) {
+	w = (w + ((dis_t)1 << (LO - 1))) >> LO;
+	*b = (w + ((dis_t)1 << (HI - LO - 1))) >> (HI - LO);
+	*a = w - (dis_t)((dig_t)*b << (HI - LO));
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+dis_t fp_invds_low(dis_t m[4], dis_t delta, dig_t f, dig_t g, int s) {
+	dig_t u = 1, v = 0, q = 0, r = 1, x = f, y = g, t0, t1;
+	dis_t w[2], a, b, c, d;
+	int i, k;
+
+	for (i = 0; i < s; i += k) {
+		k = RLC_MIN(STEPS, s - i);
+		w[0] = fp_pack(x, LO, k);
+		w[1] = fp_pack(y, HI, k);
+		delta = fp_invds_asm(w, delta, k);
+		fp_unpack(&a, &b, w[0]);
+		fp_unpack(&c, &d, w[1]);
+		/* Compose with the transition matrix of the previous chunks. */
+		t0 = a * u + b * q;
+		t1 = a * v + b * r;
+		q = c * u + d * q;
+		r = c * v + d * r;
+		u = t0;
+		v = t1;
+		/* Recompute the bits needed for the next chunk. */
+		x = (u * f + v * g) >> (i + k);
+		y = (q * f + r * g) >> (i + k);
+	}
+	m[0] = u;
+	m[1] = v;
+	m[2] = q;
+	m[3] = r;
+	return delta;
+}
+
+dis_t fp_smbds_low(dis_t m[4], dig_t *k, dis_t delta, dig_t f, dig_t g,
+		int s) {
+	dig_t a = 1, b = 0, c = 0, d = 1, x = f, y = g, t0, t1;
+	dis_t w[5] = { 0 }, e0, e1, e2, e3;
+	int i, j;
+
+	/* Tracking the sign changes needs two more valid bits of g. */
+	for (i = 0; i < s; i += j) {
+		j = RLC_MIN(STEPS - 2, s - i);
+		w[0] = fp_pack(x, LO, j);
+		w[1] = fp_pack(y, HI, j);
+		/* The sign of the first entry is taken from e2 * a + e3 * c. */
+		w[2] = a;
+		w[3] = c - (a << (HI - LO));
+		delta = fp_smbds_asm(w, delta, j);
+		fp_unpack(&e0, &e1, w[0]);
+		fp_unpack(&e2, &e3, w[1]);
+		t0 = e0 * a + e1 * c;
+		t1 = e0 * b + e1 * d;
+		c = e2 * a + e3 * c;
+		d = e2 * b + e3 * d;
+		a = t0;
+		b = t1;
+		x = (a * f + b * g) >> (i + j);
+		y = (c * f + d * g) >> (i + j);
+	}
+	m[0] = a;
+	m[1] = b;
+	m[2] = c;
+	m[3] = d;
+	*k = w[4];
+	return delta;
+}
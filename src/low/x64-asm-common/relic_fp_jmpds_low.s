@@ -0,0 +1,155 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2023 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the low-level division steps used by the constant-time
+ * inversion and Legendre symbol computation.
+ *
+ * Each step replaces the masks of the portable code by conditional moves, so
+ * that the dependency chain through g is four instructions long.
+ *
+ * @ingroup fp
+ */
+
+/* Position of the first entry of the transition matrix in a packed word. */
+#define LO		20
+/* Position of the second entry of the transition matrix in a packed word. */
+#define HI		41
+
+.text
+
+.global fp_invds_asm
+.global fp_smbds_asm
+
+/*
+ * rdi = v, rsi = delta, edx = k.
+ */
+fp_invds_asm:
+	movq	0(%rdi), %r8
+	movq	8(%rdi), %r9
+	movq	%rsi, %rax
+
+1:
+	movq	%r9, %rsi
+	leaq	(%r9,%r8), %r10
+	movq	%r9, %r11
+	subq	%r8, %r11
+	/* If g is odd, g = g + f. */
+	testb	$1, %r9b
+	cmovnzq	%r10, %r9
+	/* Sign flag set if delta < 0 and g is odd. */
+	movq	%rsi, %rcx
+	shlq	$63, %rcx
+	andq	%rax, %rcx
+	/* delta = -delta - 2 or delta - 1, without touching the flags. */
+	leaq	-1(%rax), %r10
+	notq	%rax
+	leaq	-1(%rax), %rax
+	cmovnsq	%r10, %rax
+	/* If swapping, (f, g) = (g, g - f). */
+	cmovsq	%rsi, %r8
+	cmovsq	%r11, %r9
+	sarq	$1, %r9
+	decl	%edx
+	jnz		1b
+
+	movq	%r8, 0(%rdi)
+	movq	%r9, 8(%rdi)
+	ret
+
+/*
+ * rdi = v, rsi = delta, edx = k.
+ */
+fp_smbds_asm:
+	push	%rbx
+	push	%r12
+	push	%r13
+	push	%r14
+	push	%r15
+	movq	0(%rdi), %r8
+	movq	8(%rdi), %r9
+	movq	16(%rdi), %r10
+	movq	24(%rdi), %r11
+	movq	32(%rdi), %r15
+	movq	%rsi, %rax
+
+1:
+	movq	%r9, %r14
+	movq	%r8, %rsi
+	leaq	(%r8,%r9), %r12
+	movq	%r8, %r13
+	subq	%r9, %r13
+	/* If f is odd, f = f + g. */
+	testb	$1, %r8b
+	cmovnzq	%r12, %r8
+	/* Sign flag set if delta >= 0 and f is odd. */
+	movq	%rax, %rcx
+	notq	%rcx
+	movq	%rsi, %rbx
+	shlq	$63, %rbx
+	andq	%rcx, %rbx
+	/* delta = -delta or delta + 1, without touching the flags. */
+	leaq	1(%rax), %rbx
+	leaq	1(%rcx), %rax
+	cmovnsq	%rbx, %rax
+	/* If swapping, (f, g) = (f - g, f). */
+	cmovsq	%rsi, %r9
+	cmovsq	%r13, %r8
+	sarq	$1, %r8
+
+	/* k += ((g_old & g) ^ (g >> 1)) & 2. */
+	andq	%r9, %r14
+	movq	%r9, %rbx
+	shrq	$1, %rbx
+	xorq	%rbx, %r14
+	andq	$2, %r14
+	addq	%r14, %r15
+	/* Compute the sign of the first entry of the accumulated matrix. */
+	leaq	(1 << (LO - 1))(%r9), %rbx
+	sarq	$LO, %rbx
+	leaq	(1 << (HI - LO - 1))(%rbx), %rcx
+	sarq	$(HI - LO), %rcx
+	imulq	%r10, %rbx
+	imulq	%r11, %rcx
+	addq	%rcx, %rbx
+	shrq	$63, %rbx
+	/* k += (k & 1) ^ sign, reduced modulo 4 at the end. */
+	movq	%r15, %rcx
+	xorq	%rbx, %rcx
+	andq	$1, %rcx
+	addq	%rcx, %r15
+	decl	%edx
+	jnz		1b
+
+	movq	%r8, 0(%rdi)
+	movq	%r9, 8(%rdi)
+	andq	$3, %r15
+	movq	%r15, 32(%rdi)
+	pop		%r15
+	pop		%r14
+	pop		%r13
+	pop		%r12
+	pop		%rbx
+	ret
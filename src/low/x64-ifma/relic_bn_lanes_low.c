@@ -0,0 +1,349 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2023 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the low-level multiple precision modular arithmetic
+ * functions operating on several independent integers at once, using the
+ * 52-bit integer fused multiply-add instructions of AVX-512 IFMA.
+ *
+ * @ingroup bn
+ */
+
+#include <immintrin.h>
+
+#include "relic_core.h"
+#include "relic_bn_low.h"
+#include "relic_util.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Size in bits of a limb in the vector representation.
+ */
+#define LIMB		52
+
+/**
+ * Mask selecting the bits of a limb.
+ */
+#define MASK		(((uint64_t)1 << LIMB) - 1)
+
+/**
+ * Maximum number of limbs of an integer in the vector representation.
+ */
+#define LIMBS		RLC_CEIL(RLC_BN_SIZE * RLC_DIG, LIMB)
+
+/**
+ * Attribute enabling the vector instructions in a function.
+ */
+#define TARGET		__attribute__((target("avx512f,avx512ifma")))
+
+/**
+ * Extracts a limb from a digit vector.
+ *
+ * @param[in] a				- the digit vector.
+ * @param[in] size			- the number of digits.
+ * @param[in] j				- the index of the limb.
+ * @return the limb.
+ */
+static uint64_t bn_limb(const dig_t *a, int size, int j) {
+	int d = (LIMB * j) / RLC_DIG, o = (LIMB * j) % RLC_DIG;
+	uint64_t r = 0;
+
+	if (d < size) {
+		r = a[d] >> o;
+		if (o > RLC_DIG - LIMB && d + 1 < size) {
+			r |= a[d + 1] << (RLC_DIG - o);
+		}
+	}
+	return r & MASK;
+}
+
+/**
+ * Loads one integer in each lane and splits them into limbs.
+ *
+ * @param[out] x			- the limbs.
+ * @param[in] a				- the integers.
+ * @param[in] size			- the number of digits of each integer.
+ * @param[in] n				- the number of limbs of each integer.
+ */
+static TARGET void bn_load_ifma(__m512i *x, const dig_t *a[], int size, int n) {
+	const __m512i mask = _mm512_set1_epi64(MASK);
+	__m512i p = _mm512_loadu_si512((const void *)a), lo, hi;
+	int j, d, o;
+
+	for (j = 0; j < n; j++) {
+		d = (LIMB * j) / RLC_DIG;
+		o = (LIMB * j) % RLC_DIG;
+		lo = _mm512_i64gather_epi64(_mm512_add_epi64(p,
+				_mm512_set1_epi64(d * sizeof(dig_t))), NULL, 1);
+		x[j] = _mm512_srli_epi64(lo, o);
+		if (o > RLC_DIG - LIMB && d + 1 < size) {
+			hi = _mm512_i64gather_epi64(_mm512_add_epi64(p,
+					_mm512_set1_epi64((d + 1) * sizeof(dig_t))), NULL, 1);
+			x[j] = _mm512_or_si512(x[j], _mm512_slli_epi64(hi, RLC_DIG - o));
+		}
+		x[j] = _mm512_and_si512(x[j], mask);
+	}
+}
+
+/**
+ * Joins the limbs of the integer in each lane and stores them.
+ *
+ * @param[out] c			- the integers.
+ * @param[in] x				- the limbs.
+ * @param[in] size			- the number of digits of each integer.
+ * @param[in] n				- the number of limbs of each integer.
+ */
+static TARGET void bn_store_ifma(dig_t *c[], const __m512i *x, int size,
+		int n) {
+	__m512i p = _mm512_loadu_si512((const void *)c), t;
+	int d, j, o;
+
+	for (d = 0; d < size; d++) {
+		t = _mm512_setzero_si512();
+		for (j = (RLC_DIG * d) / LIMB; j < n && LIMB * j < RLC_DIG * (d + 1);
+				j++) {
+			o = LIMB * j - RLC_DIG * d;
+			if (o >= 0) {
+				t = _mm512_or_si512(t, _mm512_slli_epi64(x[j], o));
+			} else {
+				t = _mm512_or_si512(t, _mm512_srli_epi64(x[j], -o));
+			}
+		}
+		_mm512_i64scatter_epi64(NULL, _mm512_add_epi64(p,
+				_mm512_set1_epi64(d * sizeof(dig_t))), t, 1);
+	}
+}
+
+/**
+ * Multiplies eight pairs of integers with Montgomery reduction, one pair in
+ * each 64-bit lane of a vector. The integers are split into 52-bit limbs and
+ * the reduction removes exactly size * RLC_DIG bits, so the result matches the
+ * Montgomery representation used by the scalar code.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the first integers to multiply.
+ * @param[in] b				- the second integers to multiply.
+ * @param[in] m				- the modulus.
+ * @param[in] u				- the reciprocal of the modulus.
+ * @param[in] size			- the number of digits of the modulus.
+ */
+static TARGET void bn_mulm_ifma(dig_t *c[], const dig_t *a[], const dig_t *b[],
+		const dig_t *m, dig_t u, int size) {
+	__m512i x[LIMBS], y[LIMBS], p[LIMBS + 1], t[LIMBS + 2], q, v, w;
+	const __m512i zero = _mm512_setzero_si512();
+	const __m512i mask = _mm512_set1_epi64(MASK);
+	const __m512i r = _mm512_set1_epi64(u & MASK);
+	__mmask8 k;
+	int i, j, s, n = RLC_CEIL(size * RLC_DIG, LIMB);
+
+	/* Transpose the operands so that lane k holds the k-th integer. */
+	bn_load_ifma(x, a, size, n);
+	bn_load_ifma(y, b, size, n);
+	for (j = 0; j < n; j++) {
+		p[j] = _mm512_set1_epi64(bn_limb(m, size, j));
+	}
+	p[n] = zero;
+	for (j = 0; j < n + 2; j++) {
+		t[j] = zero;
+	}
+
+	for (i = 0; i < n; i++) {
+		for (j = 0; j < n; j++) {
+			t[j] = _mm512_madd52lo_epu64(t[j], x[j], y[i]);
+			t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], x[j], y[i]);
+		}
+		/* The last step removes only the bits left to reach size digits. */
+		s = RLC_MIN(LIMB, size * RLC_DIG - LIMB * i);
+		q = _mm512_madd52lo_epu64(zero, t[0], r);
+		if (s < LIMB) {
+			q = _mm512_and_si512(q, _mm512_set1_epi64(((uint64_t)1 << s) - 1));
+		}
+		for (j = 0; j < n; j++) {
+			t[j] = _mm512_madd52lo_epu64(t[j], q, p[j]);
+			t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], q, p[j]);
+		}
+		if (s == LIMB) {
+			t[1] = _mm512_add_epi64(t[1], _mm512_srli_epi64(t[0], LIMB));
+			for (j = 0; j <= n; j++) {
+				t[j] = t[j + 1];
+			}
+			t[n + 1] = zero;
+		} else {
+			for (j = 0; j <= n; j++) {
+				t[j + 1] = _mm512_add_epi64(t[j + 1],
+						_mm512_srli_epi64(t[j], LIMB));
+				t[j] = _mm512_and_si512(t[j], mask);
+			}
+			for (j = 0; j <= n; j++) {
+				v = _mm512_slli_epi64(t[j + 1], LIMB - s);
+				t[j] = _mm512_or_si512(_mm512_srli_epi64(t[j], s),
+						_mm512_and_si512(v, mask));
+			}
+			t[n + 1] = _mm512_srli_epi64(t[n + 1], s);
+		}
+	}
+	for (j = 0; j < n; j++) {
+		t[j + 1] = _mm512_add_epi64(t[j + 1], _mm512_srli_epi64(t[j], LIMB));
+		t[j] = _mm512_and_si512(t[j], mask);
+	}
+
+	/* Subtract the modulus in the lanes where the result is not below it. */
+	w = zero;
+	for (j = 0; j <= n; j++) {
+		x[j] = _mm512_sub_epi64(_mm512_sub_epi64(t[j], p[j]), w);
+		w = _mm512_srli_epi64(x[j], RLC_DIG - 1);
+		x[j] = _mm512_and_si512(x[j], mask);
+	}
+	k = _mm512_cmpeq_epi64_mask(w, zero);
+	for (j = 0; j < n; j++) {
+		t[j] = _mm512_mask_blend_epi64(k, t[j], x[j]);
+	}
+
+	bn_store_ifma(c, t, size, n);
+}
+
+/**
+ * Reduces eight double-precision integers with Montgomery reduction, one
+ * integer in each 64-bit lane of a vector. The reduction removes exactly
+ * size * RLC_DIG bits, as in bn_mulm_ifma().
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the integers to reduce.
+ * @param[in] m				- the modulus.
+ * @param[in] u				- the reciprocal of the modulus.
+ * @param[in] size			- the number of digits of the modulus.
+ */
+static TARGET void bn_rdcm_ifma(dig_t *c[], const dig_t *a[], const dig_t *m,
+		dig_t u, int size) {
+	__m512i x[LIMBS + 1], p[LIMBS + 1], t[2 * LIMBS + 1], q, v, w;
+	const __m512i zero = _mm512_setzero_si512();
+	const __m512i mask = _mm512_set1_epi64(MASK);
+	const __m512i r = _mm512_set1_epi64(u & MASK);
+	__mmask8 k;
+	int i, j, s, n = RLC_CEIL(size * RLC_DIG, LIMB);
+	int l = RLC_CEIL(2 * size * RLC_DIG, LIMB);
+
+	/* Transpose the inputs so that lane k holds the k-th integer. */
+	bn_load_ifma(t, a, 2 * size, l);
+	t[l] = zero;
+	for (j = 0; j < n; j++) {
+		p[j] = _mm512_set1_epi64(bn_limb(m, size, j));
+	}
+	p[n] = zero;
+
+	for (i = 0; i < n; i++) {
+		/* The last step removes only the bits left to reach size digits. */
+		s = RLC_MIN(LIMB, size * RLC_DIG - LIMB * i);
+		q = _mm512_madd52lo_epu64(zero, t[0], r);
+		if (s < LIMB) {
+			q = _mm512_and_si512(q, _mm512_set1_epi64(((uint64_t)1 << s) - 1));
+		}
+		for (j = 0; j < n; j++) {
+			t[j] = _mm512_madd52lo_epu64(t[j], q, p[j]);
+			t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], q, p[j]);
+		}
+		if (s == LIMB) {
+			t[1] = _mm512_add_epi64(t[1], _mm512_srli_epi64(t[0], LIMB));
+			for (j = 0; j < l; j++) {
+				t[j] = t[j + 1];
+			}
+			t[l] = zero;
+		} else {
+			for (j = 0; j < l; j++) {
+				t[j + 1] = _mm512_add_epi64(t[j + 1],
+						_mm512_srli_epi64(t[j], LIMB));
+				t[j] = _mm512_and_si512(t[j], mask);
+			}
+			for (j = 0; j < l; j++) {
+				v = _mm512_slli_epi64(t[j + 1], LIMB - s);
+				t[j] = _mm512_or_si512(_mm512_srli_epi64(t[j], s),
+						_mm512_and_si512(v, mask));
+			}
+			t[l] = _mm512_srli_epi64(t[l], s);
+		}
+	}
+	/* The result is below 2m, so it fits in the lower n + 1 limbs. */
+	for (j = 0; j < l; j++) {
+		t[j + 1] = _mm512_add_epi64(t[j + 1], _mm512_srli_epi64(t[j], LIMB));
+		t[j] = _mm512_and_si512(t[j], mask);
+	}
+
+	/* Subtract the modulus in the lanes where the result is not below it. */
+	w = zero;
+	for (j = 0; j <= n; j++) {
+		x[j] = _mm512_sub_epi64(_mm512_sub_epi64(t[j], p[j]), w);
+		w = _mm512_srli_epi64(x[j], RLC_DIG - 1);
+		x[j] = _mm512_and_si512(x[j], mask);
+	}
+	k = _mm512_cmpeq_epi64_mask(w, zero);
+	for (j = 0; j < n; j++) {
+		t[j] = _mm512_mask_blend_epi64(k, t[j], x[j]);
+	}
+
+	bn_store_ifma(c, t, size, n);
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void bn_mulm_x8_low(dig_t *c[], const dig_t *a[], const dig_t *b[],
+		const dig_t *m, dig_t u, int size) {
+	dig_t t[2 * RLC_BN_SIZE];
+	int i;
+
+	if (__builtin_cpu_supports("avx512ifma")) {
+		bn_mulm_ifma(c, a, b, m, u, size);
+		return;
+	}
+
+	for (i = 0; i < 8; i++) {
+		bn_muln_low(t, a[i], b[i], size);
+		bn_modn_low(c[i], t, 2 * size, m, size, u);
+		if (dv_cmp(c[i], m, size) != RLC_LT) {
+			bn_subn_low(c[i], c[i], m, size);
+		}
+	}
+}
+
+void bn_rdcm_x8_low(dig_t *c[], const dig_t *a[], const dig_t *m, dig_t u,
+		int size) {
+	int i;
+
+	if (__builtin_cpu_supports("avx512ifma")) {
+		bn_rdcm_ifma(c, a, m, u, size);
+		return;
+	}
+
+	for (i = 0; i < 8; i++) {
+		bn_modn_low(c[i], a[i], 2 * size, m, size, u);
+		if (dv_cmp(c[i], m, size) != RLC_LT) {
+			bn_subn_low(c[i], c[i], m, size);
+		}
+	}
+}
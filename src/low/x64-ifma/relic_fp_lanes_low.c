@@ -0,0 +1,248 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2023 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the low-level prime field arithmetic functions operating
+ * on several independent elements at once. Additions and subtractions use the
+ * 64-bit lanes of AVX-512, while multiplications and reductions use the 52-bit
+ * integer fused multiply-add instructions of AVX-512 IFMA.
+ *
+ * @ingroup fp
+ */
+
+#include <immintrin.h>
+
+#include "relic_fp.h"
+#include "relic_fp_low.h"
+#include "relic_bn_low.h"
+#include "relic_util.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Attribute enabling the vector instructions in a function.
+ */
+#define TARGET		__attribute__((target("avx512f")))
+
+/**
+ * Transposes a matrix of eight by eight digits held in eight vectors.
+ *
+ * @param[in,out] r			- the rows of the matrix.
+ */
+static TARGET void fp_tpose_avx(__m512i *r) {
+	__m512i t[8], u[8];
+	int k;
+
+	for (k = 0; k < 8; k += 2) {
+		t[k] = _mm512_unpacklo_epi64(r[k], r[k + 1]);
+		t[k + 1] = _mm512_unpackhi_epi64(r[k], r[k + 1]);
+	}
+	for (k = 0; k < 8; k += 4) {
+		u[k] = _mm512_shuffle_i64x2(t[k], t[k + 2], 0x88);
+		u[k + 1] = _mm512_shuffle_i64x2(t[k], t[k + 2], 0xDD);
+		u[k + 2] = _mm512_shuffle_i64x2(t[k + 1], t[k + 3], 0x88);
+		u[k + 3] = _mm512_shuffle_i64x2(t[k + 1], t[k + 3], 0xDD);
+	}
+	for (k = 0; k < 4; k++) {
+		r[(k >> 1) + 2 * (k & 1)] = _mm512_shuffle_i64x2(u[k], u[k + 4], 0x88);
+		r[(k >> 1) + 2 * (k & 1) + 4] = _mm512_shuffle_i64x2(u[k], u[k + 4],
+				0xDD);
+	}
+}
+
+/**
+ * Loads eight prime field elements so that lane k of the i-th vector holds the
+ * i-th digit of the k-th element.
+ *
+ * @param[out] x			- the digits.
+ * @param[in] a				- the elements.
+ */
+static TARGET void fp_load_avx(__m512i *x, const dig_t *a[]) {
+	__mmask8 m;
+	int d, k;
+
+	for (d = 0; d < RLC_FP_DIGS; d += 8) {
+		m = (__mmask8)((1 << RLC_MIN(8, RLC_FP_DIGS - d)) - 1);
+		for (k = 0; k < 8; k++) {
+			x[d + k] = _mm512_maskz_loadu_epi64(m, a[k] + d);
+		}
+		fp_tpose_avx(x + d);
+	}
+}
+
+/**
+ * Stores eight prime field elements loaded by fp_load_avx().
+ *
+ * @param[out] c			- the elements.
+ * @param[in,out] x			- the digits, destroyed on output.
+ */
+static TARGET void fp_store_avx(dig_t *c[], __m512i *x) {
+	__mmask8 m;
+	int d, k;
+
+	for (d = 0; d < RLC_FP_DIGS; d += 8) {
+		m = (__mmask8)((1 << RLC_MIN(8, RLC_FP_DIGS - d)) - 1);
+		fp_tpose_avx(x + d);
+		for (k = 0; k < 8; k++) {
+			_mm512_mask_storeu_epi64(c[k] + d, m, x[d + k]);
+		}
+	}
+}
+
+/**
+ * Number of vectors holding the digits of eight prime field elements.
+ */
+#define VECS		(8 * RLC_CEIL(RLC_FP_DIGS, 8))
+
+/**
+ * Adds eight pairs of prime field elements, one pair in each 64-bit lane of a
+ * vector, and subtracts the prime from the lanes where the sum is not below it.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the first elements to add.
+ * @param[in] b				- the second elements to add.
+ */
+static TARGET void fp_addm_avx(dig_t *c[], const dig_t *a[], const dig_t *b[]) {
+	__m512i x[VECS], y[VECS], t[RLC_FP_DIGS], p;
+	const __m512i one = _mm512_set1_epi64(1), zero = _mm512_setzero_si512();
+	const dig_t *prime = fp_prime_get();
+	__mmask8 carry = 0, borrow = 0, k;
+	int i;
+
+	fp_load_avx(x, a);
+	fp_load_avx(y, b);
+	for (i = 0; i < RLC_FP_DIGS; i++) {
+		k = _mm512_cmplt_epu64_mask(_mm512_add_epi64(x[i], y[i]), x[i]);
+		x[i] = _mm512_add_epi64(x[i], y[i]);
+		x[i] = _mm512_mask_add_epi64(x[i], carry, x[i], one);
+		carry = k | (carry & _mm512_cmpeq_epi64_mask(x[i], zero));
+	}
+	for (i = 0; i < RLC_FP_DIGS; i++) {
+		p = _mm512_set1_epi64(prime[i]);
+		t[i] = _mm512_sub_epi64(x[i], p);
+		k = _mm512_cmplt_epu64_mask(x[i], p);
+		k |= borrow & _mm512_cmpeq_epi64_mask(t[i], zero);
+		t[i] = _mm512_mask_sub_epi64(t[i], borrow, t[i], one);
+		borrow = k;
+	}
+	/* Keep the difference if the sum overflowed or did not borrow. */
+	k = carry | ~borrow;
+	for (i = 0; i < RLC_FP_DIGS; i++) {
+		x[i] = _mm512_mask_blend_epi64(k, x[i], t[i]);
+	}
+	fp_store_avx(c, x);
+}
+
+/**
+ * Subtracts eight pairs of prime field elements, one pair in each 64-bit lane
+ * of a vector, and adds the prime to the lanes where the difference borrows.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the elements.
+ * @param[in] b				- the elements to subtract.
+ */
+static TARGET void fp_subm_avx(dig_t *c[], const dig_t *a[], const dig_t *b[]) {
+	__m512i x[VECS], y[VECS], t;
+	const __m512i one = _mm512_set1_epi64(1), zero = _mm512_setzero_si512();
+	const dig_t *prime = fp_prime_get();
+	__mmask8 carry = 0, borrow = 0, k;
+	int i;
+
+	fp_load_avx(x, a);
+	fp_load_avx(y, b);
+	for (i = 0; i < RLC_FP_DIGS; i++) {
+		k = _mm512_cmplt_epu64_mask(x[i], y[i]);
+		x[i] = _mm512_sub_epi64(x[i], y[i]);
+		k |= borrow & _mm512_cmpeq_epi64_mask(x[i], zero);
+		x[i] = _mm512_mask_sub_epi64(x[i], borrow, x[i], one);
+		borrow = k;
+	}
+	/* Add the prime only in the lanes that borrowed. */
+	for (i = 0; i < RLC_FP_DIGS; i++) {
+		t = _mm512_add_epi64(x[i], _mm512_maskz_set1_epi64(borrow, prime[i]));
+		k = _mm512_cmplt_epu64_mask(t, x[i]);
+		x[i] = _mm512_mask_add_epi64(t, carry, t, one);
+		carry = k | (carry & _mm512_cmpeq_epi64_mask(x[i], zero));
+	}
+	fp_store_avx(c, x);
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void fp_addm_x8_low(dig_t *c[], const dig_t *a[], const dig_t *b[]) {
+	if (__builtin_cpu_supports("avx512f")) {
+		fp_addm_avx(c, a, b);
+		return;
+	}
+
+	for (int i = 0; i < 8; i++) {
+		fp_addm_low(c[i], a[i], b[i]);
+	}
+}
+
+void fp_subm_x8_low(dig_t *c[], const dig_t *a[], const dig_t *b[]) {
+	if (__builtin_cpu_supports("avx512f")) {
+		fp_subm_avx(c, a, b);
+		return;
+	}
+
+	for (int i = 0; i < 8; i++) {
+		fp_subm_low(c[i], a[i], b[i]);
+	}
+}
+
+void fp_mulm_x8_low(dig_t *c[], const dig_t *a[], const dig_t *b[]) {
+#if FP_RDC == MONTY
+	bn_mulm_x8_low(c, a, b, fp_prime_get(), *fp_prime_get_rdc(), RLC_FP_DIGS);
+#else
+	for (int i = 0; i < 8; i++) {
+		fp_mulm_low(c[i], a[i], b[i]);
+	}
+#endif
+}
+
+void fp_sqrm_x8_low(dig_t *c[], const dig_t *a[]) {
+#if FP_RDC == MONTY
+	bn_mulm_x8_low(c, a, a, fp_prime_get(), *fp_prime_get_rdc(), RLC_FP_DIGS);
+#else
+	for (int i = 0; i < 8; i++) {
+		fp_sqrm_low(c[i], a[i]);
+	}
+#endif
+}
+
+void fp_rdcn_x8_low(dig_t *c[], const dig_t *a[]) {
+#if FP_RDC == MONTY
+	bn_rdcm_x8_low(c, a, fp_prime_get(), *fp_prime_get_rdc(), RLC_FP_DIGS);
+#else
+	for (int i = 0; i < 8; i++) {
+		fp_rdcn_low(c[i], (dig_t *)a[i]);
+	}
+#endif
+}
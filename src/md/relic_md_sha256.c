@@ -29,20 +29,287 @@
  * @ingroup md
  */
 
+#include <string.h>
+
 #include "relic_conf.h"
 #include "relic_core.h"
 #include "relic_md.h"
 #include "sha.h"
 
+#if MD_MAP == SH256 || !defined(STRIP)
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Implementations enabled by md_sh256_set().
+ */
+static int sha256_mask = RLC_MD_SH256_ALL;
+
+/**
+ * Initial chaining value of SHA-256.
+ */
+static const uint32_t sha256_iv[8] = {
+	0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A,
+	0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19
+};
+
+/**
+ * Writes a chaining value as a big-endian digest.
+ *
+ * @param[out] hash			- the digest.
+ * @param[in] s				- the chaining value, word i at position i * step.
+ * @param[in] step			- the distance between consecutive words.
+ */
+static void sha256_put(uint8_t *hash, const uint32_t *s, int step) {
+	for (int i = 0; i < 8; i++) {
+		hash[4 * i] = (uint8_t)(s[i * step] >> 24);
+		hash[4 * i + 1] = (uint8_t)(s[i * step] >> 16);
+		hash[4 * i + 2] = (uint8_t)(s[i * step] >> 8);
+		hash[4 * i + 3] = (uint8_t)s[i * step];
+	}
+}
+
+/**
+ * Pads the last partial block of a message.
+ *
+ * @param[out] tail			- the padded blocks.
+ * @param[in] msg			- the message.
+ * @param[in] len			- the message length in bytes.
+ * @return the number of padded blocks, one or two.
+ */
+static int sha256_pad(uint8_t tail[128], const uint8_t *msg, int len) {
+	int r = len % 64, b = (r < 56 ? 1 : 2);
+	uint64_t l = (uint64_t)len << 3;
+
+	memset(tail, 0, 64 * b);
+	memcpy(tail, msg + len - r, r);
+	tail[r] = 0x80;
+	for (int i = 0; i < 8; i++) {
+		tail[64 * b - 1 - i] = (uint8_t)(l >> (8 * i));
+	}
+	return b;
+}
+
+#if defined(__GNUC__) && defined(__x86_64__)
+
+#include <cpuid.h>
+#include <immintrin.h>
+
+/**
+ * Round constants of SHA-256.
+ */
+static const uint32_t sha256_k[64] __attribute__((aligned(16))) = {
+	0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1,
+	0x923F82A4, 0xAB1C5ED5, 0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3,
+	0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174, 0xE49B69C1, 0xEFBE4786,
+	0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+	0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147,
+	0x06CA6351, 0x14292967, 0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13,
+	0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85, 0xA2BFE8A1, 0xA81A664B,
+	0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+	0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A,
+	0x5B9CCA4F, 0x682E6FF3, 0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208,
+	0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+};
+
+/**
+ * Detects the implementations supported by the processor and by the operating
+ * system, among those enabled by md_sh256_set().
+ *
+ * @return the flags of the available implementations.
+ */
+static int sha256_cpu(void) {
+	static int flags = -1;
+	unsigned int a, b, c, d, lo = 0, hi = 0;
+	/* SSE2 is part of the x86-64 baseline. */
+	int f = RLC_MD_SH256_SSE2;
+
+	if (flags >= 0) {
+		return flags & sha256_mask;
+	}
+	if (__get_cpuid(1, &a, &b, &c, &d)) {
+		/* Check for OSXSAVE before reading the enabled register state. */
+		if (c & (1 << 27)) {
+			__asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+		}
+		/* The SHA extensions need SSSE3 and SSE4.1 for the message loads. */
+		if ((c & (1 << 9)) && (c & (1 << 19)) &&
+				__get_cpuid_count(7, 0, &a, &b, &c, &d)) {
+			if (b & (1 << 29)) {
+				f |= RLC_MD_SH256_NI;
+			}
+			if ((b & (1 << 5)) && (lo & 0x06) == 0x06) {
+				f |= RLC_MD_SH256_AVX2;
+			}
+			if ((b & (1 << 16)) && (lo & 0xE6) == 0xE6) {
+				f |= RLC_MD_SH256_AVX512;
+			}
+		}
+	}
+	(void)hi;
+	flags = f;
+	return flags & sha256_mask;
+}
+
+/**
+ * Compresses a sequence of blocks with the SHA extensions.
+ *
+ * @param[in,out] s			- the chaining value.
+ * @param[in] blk			- the blocks to compress.
+ * @param[in] n				- the number of blocks.
+ */
+static __attribute__((target("sha,sse4.1"))) void sha256_ni(uint32_t s[8],
+		const uint8_t *blk, size_t n) {
+	const __m128i mask = _mm_set_epi64x(0x0C0D0E0F08090A0BULL,
+			0x0405060700010203ULL);
+	__m128i s0, s1, t, abef, cdgh, m[4];
+
+	/* Rearrange the chaining value into the ABEF and CDGH layout. */
+	t = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&s[0]), 0xB1);
+	s1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&s[4]), 0x1B);
+	s0 = _mm_alignr_epi8(t, s1, 8);
+	s1 = _mm_blend_epi16(s1, t, 0xF0);
+
+	for (; n > 0; n--, blk += 64) {
+		abef = s0;
+		cdgh = s1;
+		for (int i = 0; i < 4; i++) {
+			m[i] = _mm_loadu_si128((const __m128i *)(blk + 16 * i));
+			m[i] = _mm_shuffle_epi8(m[i], mask);
+		}
+		for (int i = 0; i < 16; i++) {
+			t = _mm_add_epi32(m[i & 3],
+					_mm_load_si128((const __m128i *)&sha256_k[4 * i]));
+			s1 = _mm_sha256rnds2_epu32(s1, s0, t);
+			s0 = _mm_sha256rnds2_epu32(s0, s1, _mm_shuffle_epi32(t, 0x0E));
+			if (i < 12) {
+				t = _mm_sha256msg1_epu32(m[i & 3], m[(i + 1) & 3]);
+				t = _mm_add_epi32(t, _mm_alignr_epi8(m[(i + 3) & 3],
+								m[(i + 2) & 3], 4));
+				m[i & 3] = _mm_sha256msg2_epu32(t, m[(i + 3) & 3]);
+			}
+		}
+		s0 = _mm_add_epi32(s0, abef);
+		s1 = _mm_add_epi32(s1, cdgh);
+	}
+
+	t = _mm_shuffle_epi32(s0, 0x1B);
+	s1 = _mm_shuffle_epi32(s1, 0xB1);
+	_mm_storeu_si128((__m128i *)&s[0], _mm_blend_epi16(t, s1, 0xF0));
+	_mm_storeu_si128((__m128i *)&s[4], _mm_alignr_epi8(s1, t, 8));
+}
+
+/**
+ * Hashes a single message with the SHA extensions.
+ *
+ * @param[out] hash			- the digest.
+ * @param[in] msg			- the message.
+ * @param[in] len			- the message length in bytes.
+ */
+static void sha256_one(uint8_t *hash, const uint8_t *msg, int len) {
+	uint8_t tail[128];
+	uint32_t s[8];
+	int b;
+
+	memcpy(s, sha256_iv, sizeof(s));
+	sha256_ni(s, msg, len / 64);
+	b = sha256_pad(tail, msg, len);
+	sha256_ni(s, tail, b);
+	sha256_put(hash, s, 1);
+}
+
+#define LANES	4
+#define TARGET
+#include "sha256-lanes.inc"
+#undef LANES
+#undef TARGET
+
+#define LANES	8
+#define TARGET	__attribute__((target("avx2")))
+#include "sha256-lanes.inc"
+#undef LANES
+#undef TARGET
+
+#define LANES	16
+#define TARGET	__attribute__((target("avx512f")))
+#include "sha256-lanes.inc"
+#undef LANES
+#undef TARGET
+
+/**
+ * Hashes a group of messages, one in each lane of a multi-lane compression
+ * function. Lanes holding shorter messages compress dummy blocks until the
+ * longest message is processed.
+ *
+ * @param[out] out			- the digests.
+ * @param[in] in			- the messages.
+ * @param[in] len			- the message lengths in bytes.
+ * @param[in] f				- the compression function.
+ * @param[in] lanes			- the number of lanes.
+ */
+static void sha256_lanes(uint8_t *out[], const uint8_t *in[], const int len[],
+		void (*f)(uint32_t *, const uint8_t **), int lanes) {
+	static const uint8_t zero[64] = { 0 };
+	uint8_t tail[16][128];
+	uint32_t s[8 * 16];
+	const uint8_t *blk[16];
+	int i, j, b, max = 0, full[16], total[16];
+
+	for (j = 0; j < lanes; j++) {
+		for (i = 0; i < 8; i++) {
+			s[i * lanes + j] = sha256_iv[i];
+		}
+		full[j] = len[j] / 64;
+		total[j] = full[j] + sha256_pad(tail[j], in[j], len[j]);
+		max = RLC_MAX(max, total[j]);
+	}
+
+	for (b = 0; b < max; b++) {
+		for (j = 0; j < lanes; j++) {
+			if (b < full[j]) {
+				blk[j] = in[j] + 64 * b;
+			} else if (b < total[j]) {
+				blk[j] = tail[j] + 64 * (b - full[j]);
+			} else {
+				blk[j] = zero;
+			}
+		}
+		f(s, blk);
+		for (j = 0; j < lanes; j++) {
+			if (b == total[j] - 1) {
+				sha256_put(out[j], s + j, lanes);
+			}
+		}
+	}
+}
+
+#endif
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
 
-#if MD_MAP == SH256 || !defined(STRIP)
+int md_sh256_set(int mask) {
+	sha256_mask = mask & RLC_MD_SH256_ALL;
+#if defined(__GNUC__) && defined(__x86_64__)
+	return sha256_cpu();
+#else
+	return 0;
+#endif
+}
 
 void md_map_sh256(uint8_t *hash, const uint8_t *msg, int len) {
 	SHA256Context ctx;
 
+#if defined(__GNUC__) && defined(__x86_64__)
+	if (sha256_cpu() & RLC_MD_SH256_NI) {
+		sha256_one(hash, msg, len);
+		return;
+	}
+#endif
+
 	if (SHA256Reset(&ctx) != shaSuccess) {
 		RLC_THROW(ERR_NO_VALID);
 		return;
@@ -57,4 +324,36 @@ void md_map_sh256(uint8_t *hash, const uint8_t *msg, int len) {
 	}
 }
 
+void md_map_sh256_many(uint8_t *out[], const uint8_t *in[], const int len[],
+		int n) {
+	int i = 0;
+
+#if defined(__GNUC__) && defined(__x86_64__)
+	int f = sha256_cpu();
+
+	if (f & RLC_MD_SH256_AVX512) {
+		for (; i + 16 <= n; i += 16) {
+			sha256_lanes(out + i, in + i, len + i, sha256_x16, 16);
+		}
+	}
+	/* The SHA extensions are faster than the narrower kernels. */
+	if (!(f & RLC_MD_SH256_NI)) {
+		if (f & RLC_MD_SH256_AVX2) {
+			for (; i + 8 <= n; i += 8) {
+				sha256_lanes(out + i, in + i, len + i, sha256_x8, 8);
+			}
+		}
+		if (f & RLC_MD_SH256_SSE2) {
+			for (; i + 4 <= n; i += 4) {
+				sha256_lanes(out + i, in + i, len + i, sha256_x4, 4);
+			}
+		}
+	}
+#endif
+
+	for (; i < n; i++) {
+		md_map_sh256(out[i], in[i], len[i]);
+	}
+}
+
 #endif
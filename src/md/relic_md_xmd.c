@@ -33,6 +33,7 @@
 
 #include "relic_conf.h"
 #include "relic_core.h"
+#include "relic_md.h"
 #include "sha.h"
 
 /*============================================================================*/
@@ -111,6 +112,11 @@
 		}                                                                                                         \
 	}
 
+/**
+ * Number of messages expanded at once by the multi-message functions.
+ */
+#define XMD_GROUP	16
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -121,6 +127,80 @@ make_md_xmd(SHA224, sh224)
 
 #if MD_MAP == SH256 || !defined(STRIP)
 make_md_xmd(SHA256, sh256)
+
+void md_xmd_sh256_many(uint8_t *buf[], int buf_len, const uint8_t *in[],
+		const int in_len[], int n, const uint8_t *dst, int dst_len) {
+	const int ell = (buf_len + SHA256HashSize - 1) / SHA256HashSize;
+	const int blen = SHA256HashSize + 1 + dst_len + 1;
+	const uint8_t *msg[XMD_GROUP];
+	uint8_t *str, *out[XMD_GROUP], b_0[XMD_GROUP][SHA256HashSize];
+	uint8_t b_i[XMD_GROUP][SHA256HashSize];
+	int i, j, k, m, len[XMD_GROUP], size, copy;
+
+	if (buf_len < 0 || ell > 255 || dst_len > 255 || dst_len < 0) {
+		RLC_THROW(ERR_NO_VALID);
+		return;
+	}
+
+	/* Reserve room for the longest messages in a single heap buffer. */
+	size = blen;
+	for (j = 0; j < n; j++) {
+		size = RLC_MAX(size, SHA256_Message_Block_Size + in_len[j] + 4 + dst_len);
+	}
+	str = RLC_MALLOC(uint8_t, XMD_GROUP * size);
+	if (str == NULL) {
+		RLC_THROW(ERR_NO_MEMORY);
+		return;
+	}
+
+	for (k = 0; k < n; k += XMD_GROUP) {
+		m = RLC_MIN(XMD_GROUP, n - k);
+
+		/* Z_pad || msg || I2OSP(len, 2) || I2OSP(0, 1) || DST || I2OSP(len(DST), 1). */
+		size = 0;
+		for (j = 0; j < m; j++) {
+			msg[j] = str + size;
+			len[j] = SHA256_Message_Block_Size + in_len[k + j] + 4 + dst_len;
+			memset(str + size, 0, SHA256_Message_Block_Size);
+			size += SHA256_Message_Block_Size;
+			memcpy(str + size, in[k + j], in_len[k + j]);
+			size += in_len[k + j];
+			str[size++] = (uint8_t)(buf_len >> 8);
+			str[size++] = (uint8_t)(buf_len & 0xFF);
+			str[size++] = 0;
+			memcpy(str + size, dst, dst_len);
+			size += dst_len;
+			str[size++] = (uint8_t)dst_len;
+			out[j] = b_0[j];
+		}
+		md_map_sh256_many(out, msg, len, m);
+
+		/* (b_0 XOR b_(i-1)) || I2OSP(i, 1) || DST || I2OSP(len(DST), 1). */
+		memset(b_i, 0, sizeof(b_i));
+		for (j = 0; j < m; j++) {
+			msg[j] = str + j * blen;
+			len[j] = blen;
+			out[j] = b_i[j];
+			memcpy(str + j * blen + SHA256HashSize + 1, dst, dst_len);
+			str[j * blen + blen - 1] = (uint8_t)dst_len;
+		}
+		for (i = 1; i <= ell; i++) {
+			for (j = 0; j < m; j++) {
+				for (int l = 0; l < SHA256HashSize; l++) {
+					str[j * blen + l] = b_0[j][l] ^ b_i[j][l];
+				}
+				str[j * blen + SHA256HashSize] = (uint8_t)i;
+			}
+			md_map_sh256_many(out, msg, len, m);
+
+			copy = RLC_MIN(SHA256HashSize, buf_len - (i - 1) * SHA256HashSize);
+			for (j = 0; j < m; j++) {
+				memcpy(buf[k + j] + (i - 1) * SHA256HashSize, b_i[j], copy);
+			}
+		}
+	}
+	alloc_free(str);
+}
 #endif
 
 #if MD_MAP == SH384 || !defined(STRIP)
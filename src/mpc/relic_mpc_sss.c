@@ -63,8 +63,8 @@ int mpc_sss_gen(bn_t *x, bn_t *y, const bn_t secret, const bn_t order,
         }
         for (int i = 0; i < n; i++) {
             bn_set_dig(x[i], i + 1);
-            bn_evl(y[i], a, x[i], order, k);
         }
+        bn_evl_sim(y, a, x, order, k, n);
     } RLC_CATCH_ANY {
         RLC_THROW(ERR_CAUGHT);
     } RLC_FINALLY {
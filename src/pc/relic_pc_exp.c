@@ -226,6 +226,39 @@ void gt_exp_sim(gt_t e, gt_t a, bn_t b, gt_t c, bn_t d) {
 	}
 }
 
+void gt_exp_sim_lot(gt_t r, gt_t a[], bn_t k[], int n) {
+	bn_t m, *_k = RLC_ALLOCA(bn_t, n);
+	int i;
+
+	bn_null(m);
+
+	RLC_TRY {
+		if (n > 0 && _k == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		bn_new(m);
+		for (i = 0; i < n; i++) {
+			bn_null(_k[i]);
+			bn_new(_k[i]);
+		}
+
+		gt_get_ord(m);
+		for (i = 0; i < n; i++) {
+			bn_mod(_k[i], k[i], m);
+		}
+
+		RLC_CAT(RLC_GT_LOWER, exp_cyc_lot)(r, a, _k, n);
+	} RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	} RLC_FINALLY {
+		bn_free(m);
+		for (i = 0; i < n; i++) {
+			bn_free(_k[i]);
+		}
+		RLC_FREE(_k);
+	}
+}
+
 void gt_exp_gen(gt_t c, bn_t b) {
 	bn_t n, _b;
 	gt_t g;
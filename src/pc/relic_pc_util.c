@@ -236,6 +236,35 @@ int g2_is_valid(g2_t a) {
 #endif
 }
 
+int g1_upk_many(g1_t *r, const g1_t *p, int n, int check) {
+	int result = ep_upk_many(r, p, n);
+
+	/* Decompressed points are on the curve, so only the order is left. */
+	for (int i = 0; result && check && i < n; i++) {
+		result = g1_is_valid(r[i]);
+	}
+	return result;
+}
+
+int g2_upk_many(g2_t *r, const g2_t *p, int n, int check) {
+	int result = 1;
+
+#if FP_PRIME >= 1536
+	result = ep_upk_many(r, p, n);
+#elif FP_PRIME == 315 || FP_PRIME == 317 || FP_PRIME == 509
+	/* Point compression is not available over the quartic extension. */
+	RLC_THROW(ERR_NO_CONFIG);
+	return 0;
+#else
+	result = ep2_upk_many(r, p, n);
+#endif
+
+	for (int i = 0; result && check && i < n; i++) {
+		result = g2_is_valid(r[i]);
+	}
+	return result;
+}
+
 int gt_is_valid(gt_t a) {
 	bn_t p, n;
 	gt_t u, v;
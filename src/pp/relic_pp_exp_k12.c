@@ -234,6 +234,307 @@ static void pp_exp_b12(fp12_t c, fp12_t a) {
 	}
 }
 
+/**
+ * Maps multiple dodecic extension field elements to the cyclotomic subgroup,
+ * sharing a single inversion among them. Computes c = a^(p^6 - 1)(p^2 + 1).
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the extension field elements to map.
+ * @param[in] n				- the number of elements.
+ */
+static void pp_cyc_sim_k12(fp12_t *c, fp12_t *a, int n) {
+	int i;
+	fp12_t *t = RLC_ALLOCA(fp12_t, n);
+
+	RLC_TRY {
+		if (t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n; i++) {
+			fp12_null(t[i]);
+			fp12_new(t[i]);
+		}
+
+		fp12_inv_sim(t, a, n);
+		for (i = 0; i < n; i++) {
+			fp12_inv_cyc(c[i], a[i]);
+			fp12_mul(c[i], c[i], t[i]);
+			fp12_frb(t[i], c[i], 2);
+			fp12_mul(c[i], c[i], t[i]);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < n; i++) {
+			fp12_free(t[i]);
+		}
+		RLC_FREE(t);
+	}
+}
+
+/**
+ * Exponentiates multiple cyclotomic dodecic extension field elements by a
+ * sparse exponent using compressed squarings, decompressing all the
+ * intermediate powers with a single shared inversion.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the elements to exponentiate.
+ * @param[in] n				- the number of elements.
+ * @param[in] b				- the positions of the non-zero bits.
+ * @param[in] len			- the number of non-zero bits.
+ * @param[in] sign			- the sign of the exponent.
+ */
+static void pp_sps_sim_k12(fp12_t *c, fp12_t *a, int n, const int *b,
+		int len, int sign) {
+	int i, j, k, e, s = (len > 0 && b[0] == 0), w = len - s;
+	fp12_t t, *u = RLC_ALLOCA(fp12_t, n * w);
+
+	if (len == 0) {
+		RLC_FREE(u);
+		for (e = 0; e < n; e++) {
+			fp12_set_dig(c[e], 1);
+		}
+		return;
+	}
+
+	fp12_null(t);
+
+	RLC_TRY {
+		if (u == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n * w; i++) {
+			fp12_null(u[i]);
+			fp12_new(u[i]);
+		}
+		fp12_new(t);
+
+		for (e = 0; e < n; e++) {
+			fp12_copy(t, a[e]);
+			for (j = 0, i = s; i < len; i++) {
+				k = (b[i] < 0 ? -b[i] : b[i]);
+				for (; j < k; j++) {
+					fp12_sqr_pck(t, t);
+				}
+				if (b[i] < 0) {
+					fp12_inv_cyc(u[e * w + i - s], t);
+				} else {
+					fp12_copy(u[e * w + i - s], t);
+				}
+			}
+		}
+
+		fp12_back_cyc_sim(u, u, n * w);
+
+		for (e = 0; e < n; e++) {
+			if (s) {
+				fp12_copy(t, a[e]);
+			} else {
+				fp12_copy(t, u[e * w]);
+			}
+			for (i = 1 - s; i < w; i++) {
+				fp12_mul(t, t, u[e * w + i]);
+			}
+			if (sign == RLC_NEG) {
+				fp12_inv_cyc(c[e], t);
+			} else {
+				fp12_copy(c[e], t);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < n * w; i++) {
+			fp12_free(u[i]);
+		}
+		fp12_free(t);
+		RLC_FREE(u);
+	}
+}
+
+/**
+ * Computes the final exponentiation of multiple pairings defined over a
+ * Barreto-Naehrig curve.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the extension field elements to exponentiate.
+ * @param[in] n				- the number of elements.
+ */
+static void pp_exp_bn_sim(fp12_t *c, fp12_t *a, int n) {
+	fp12_t *t = RLC_ALLOCA(fp12_t, 4 * n);
+	fp12_t *t0 = t, *t1 = t + n, *t2 = t + 2 * n, *t3 = t + 3 * n;
+	bn_t x;
+	const int *b;
+	int i, l;
+
+	bn_null(x);
+
+	RLC_TRY {
+		if (t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < 4 * n; i++) {
+			fp12_null(t[i]);
+			fp12_new(t[i]);
+		}
+		bn_new(x);
+
+		fp_prime_get_par(x);
+		b = fp_prime_get_par_sps(&l);
+
+		/* First, compute m = f^(p^6 - 1)(p^2 + 1). */
+		pp_cyc_sim_k12(c, a, n);
+
+		/* Now compute m^((p^4 - p^2 + 1) / r) as in pp_exp_bn(). */
+		pp_sps_sim_k12(t0, c, n, b, l, RLC_POS);
+		for (i = 0; i < n; i++) {
+			fp12_sqr_cyc(t0[i], t0[i]);
+			fp12_sqr_cyc(t1[i], t0[i]);
+			fp12_mul(t1[i], t1[i], t0[i]);
+		}
+		pp_sps_sim_k12(t2, t1, n, b, l, RLC_POS);
+		for (i = 0; i < n; i++) {
+			fp12_sqr_cyc(t3[i], t2[i]);
+		}
+		pp_sps_sim_k12(t3, t3, n, b, l, RLC_POS);
+
+		for (i = 0; i < n; i++) {
+			if (bn_sign(x) == RLC_NEG) {
+				fp12_inv_cyc(t0[i], t0[i]);
+				fp12_inv_cyc(t1[i], t1[i]);
+				fp12_inv_cyc(t3[i], t3[i]);
+			}
+
+			fp12_mul(t3[i], t3[i], t2[i]);
+			fp12_mul(t3[i], t3[i], t1[i]);
+
+			fp12_inv_cyc(t0[i], t0[i]);
+			fp12_mul(t0[i], t0[i], t3[i]);
+
+			fp12_mul(t2[i], t2[i], t3[i]);
+			fp12_mul(t2[i], t2[i], c[i]);
+			fp12_inv_cyc(c[i], c[i]);
+			fp12_mul(c[i], c[i], t0[i]);
+			fp12_frb(c[i], c[i], 3);
+			fp12_mul(c[i], c[i], t2[i]);
+			fp12_frb(t0[i], t0[i], 1);
+			fp12_mul(c[i], c[i], t0[i]);
+			fp12_frb(t3[i], t3[i], 2);
+			fp12_mul(c[i], c[i], t3[i]);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < 4 * n; i++) {
+			fp12_free(t[i]);
+		}
+		RLC_FREE(t);
+		bn_free(x);
+	}
+}
+
+/**
+ * Computes the final exponentiation of multiple pairings defined over a
+ * Barreto-Lynn-Scott curve.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the extension field elements to exponentiate.
+ * @param[in] n				- the number of elements.
+ */
+static void pp_exp_b12_sim(fp12_t *c, fp12_t *a, int n) {
+	fp12_t *t = RLC_ALLOCA(fp12_t, 4 * n);
+	fp12_t *t0 = t, *t1 = t + n, *t2 = t + 2 * n, *t3 = t + 3 * n;
+	bn_t x;
+	const int *b;
+	int i, l;
+
+	bn_null(x);
+
+	RLC_TRY {
+		if (t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < 4 * n; i++) {
+			fp12_null(t[i]);
+			fp12_new(t[i]);
+		}
+		bn_new(x);
+
+		fp_prime_get_par(x);
+		b = fp_prime_get_par_sps(&l);
+
+		/* First, compute m^(p^6 - 1)(p^2 + 1). */
+		pp_cyc_sim_k12(c, a, n);
+
+		/* Now compute m^((p^4 - p^2 + 1) / r) as in pp_exp_b12(). */
+		for (i = 0; i < n; i++) {
+			fp12_sqr_cyc(t0[i], c[i]);
+			fp12_inv_cyc(t3[i], c[i]);
+		}
+
+		if (b[0] == 0) {
+			pp_sps_sim_k12(t1, c, n, b, l, bn_sign(x));
+			pp_sps_sim_k12(t2, t1, n, b, l, bn_sign(x));
+			for (i = 0; i < n; i++) {
+				fp12_sqr_cyc(t1[i], t1[i]);
+			}
+		} else {
+			int _b[RLC_TERMS + 1];
+
+			for (i = 0; i < l; i++) {
+				if (b[i] > 0) {
+					_b[i] = b[i] - 1;
+				} else {
+					_b[i] = b[i] + 1;
+				}
+			}
+
+			pp_sps_sim_k12(t1, t0, n, b, l, bn_sign(x));
+			pp_sps_sim_k12(t2, t1, n, _b, l, bn_sign(x));
+		}
+
+		for (i = 0; i < n; i++) {
+			fp12_mul(t1[i], t1[i], t3[i]);
+			fp12_inv_cyc(t1[i], t1[i]);
+			fp12_mul(t1[i], t1[i], t2[i]);
+		}
+
+		pp_sps_sim_k12(t2, t1, n, b, l, bn_sign(x));
+		for (i = 0; i < n; i++) {
+			fp12_frb(t3[i], t1[i], 1);
+			fp12_mul(t2[i], t2[i], t3[i]);
+		}
+
+		pp_sps_sim_k12(t3, t2, n, b, l, bn_sign(x));
+		pp_sps_sim_k12(t3, t3, n, b, l, bn_sign(x));
+		for (i = 0; i < n; i++) {
+			fp12_frb(t1[i], t2[i], 2);
+			fp12_inv_cyc(t2[i], t2[i]);
+			fp12_mul(t1[i], t1[i], t2[i]);
+			fp12_mul(t3[i], t3[i], t1[i]);
+
+			fp12_mul(t0[i], t0[i], c[i]);
+			fp12_mul(c[i], t0[i], t3[i]);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < 4 * n; i++) {
+			fp12_free(t[i]);
+		}
+		RLC_FREE(t);
+		bn_free(x);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -248,3 +549,16 @@ void pp_exp_k12(fp12_t c, fp12_t a) {
 			break;
 	}
 }
+
+void pp_exp_k12_many(fp12_t *c, fp12_t *a, int n) {
+	for (int i = 0; i < n; i += RLC_PP_EXP_BLK) {
+		switch (ep_curve_is_pairf()) {
+			case EP_BN:
+				pp_exp_bn_sim(c + i, a + i, RLC_MIN(RLC_PP_EXP_BLK, n - i));
+				break;
+			case EP_B12:
+				pp_exp_b12_sim(c + i, a + i, RLC_MIN(RLC_PP_EXP_BLK, n - i));
+				break;
+		}
+	}
+}
@@ -33,6 +33,132 @@
 #include "relic_pp.h"
 #include "relic_util.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Maps multiple 24-degree extension field elements to the cyclotomic subgroup,
+ * sharing a single inversion among them. Computes c = a^(p^12 - 1)(p^4 + 1).
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the extension field elements to map.
+ * @param[in] n				- the number of elements.
+ */
+static void pp_cyc_sim_k24(fp24_t *c, fp24_t *a, int n) {
+	int i;
+	fp24_t *t = RLC_ALLOCA(fp24_t, n);
+
+	RLC_TRY {
+		if (t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n; i++) {
+			fp24_null(t[i]);
+			fp24_new(t[i]);
+		}
+
+		fp24_inv_sim(t, a, n);
+		for (i = 0; i < n; i++) {
+			fp24_inv_cyc(c[i], a[i]);
+			fp24_mul(c[i], c[i], t[i]);
+			fp24_frb(t[i], c[i], 4);
+			fp24_mul(c[i], c[i], t[i]);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < n; i++) {
+			fp24_free(t[i]);
+		}
+		RLC_FREE(t);
+	}
+}
+
+/**
+ * Exponentiates multiple cyclotomic 24-degree extension field elements by a
+ * sparse exponent using compressed squarings, decompressing all the
+ * intermediate powers with a single shared inversion.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the elements to exponentiate.
+ * @param[in] n				- the number of elements.
+ * @param[in] b				- the positions of the non-zero bits.
+ * @param[in] len			- the number of non-zero bits.
+ * @param[in] sign			- the sign of the exponent.
+ */
+static void pp_sps_sim_k24(fp24_t *c, fp24_t *a, int n, const int *b,
+		int len, int sign) {
+	int i, j, k, e, s = (len > 0 && b[0] == 0), w = len - s;
+	fp24_t t, *u = RLC_ALLOCA(fp24_t, n * w);
+
+	if (len == 0) {
+		RLC_FREE(u);
+		for (e = 0; e < n; e++) {
+			fp24_set_dig(c[e], 1);
+		}
+		return;
+	}
+
+	fp24_null(t);
+
+	RLC_TRY {
+		if (u == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n * w; i++) {
+			fp24_null(u[i]);
+			fp24_new(u[i]);
+		}
+		fp24_new(t);
+
+		for (e = 0; e < n; e++) {
+			fp24_copy(t, a[e]);
+			for (j = 0, i = s; i < len; i++) {
+				k = (b[i] < 0 ? -b[i] : b[i]);
+				for (; j < k; j++) {
+					fp24_sqr_pck(t, t);
+				}
+				if (b[i] < 0) {
+					fp24_inv_cyc(u[e * w + i - s], t);
+				} else {
+					fp24_copy(u[e * w + i - s], t);
+				}
+			}
+		}
+
+		fp24_back_cyc_sim(u, u, n * w);
+
+		for (e = 0; e < n; e++) {
+			if (s) {
+				fp24_copy(t, a[e]);
+			} else {
+				fp24_copy(t, u[e * w]);
+			}
+			for (i = 1 - s; i < w; i++) {
+				fp24_mul(t, t, u[e * w + i]);
+			}
+			if (sign == RLC_NEG) {
+				fp24_inv_cyc(c[e], t);
+			} else {
+				fp24_copy(c[e], t);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < n * w; i++) {
+			fp24_free(u[i]);
+		}
+		fp24_free(t);
+		RLC_FREE(u);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -112,3 +238,85 @@ void pp_exp_k24(fp24_t c, fp24_t a) {
 		fp24_free(t2);
 	}
 }
+
+void pp_exp_k24_many(fp24_t *c, fp24_t *a, int n) {
+	fp24_t *t = RLC_ALLOCA(fp24_t, 3 * RLC_PP_EXP_BLK);
+	fp24_t *t0 = t, *t1 = t + RLC_PP_EXP_BLK, *t2 = t + 2 * RLC_PP_EXP_BLK;
+	const int *b;
+	bn_t x;
+	int i, j, k, l;
+
+	bn_null(x);
+
+	RLC_TRY {
+		if (t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < 3 * RLC_PP_EXP_BLK; i++) {
+			fp24_null(t[i]);
+			fp24_new(t[i]);
+		}
+		bn_new(x);
+
+		fp_prime_get_par(x);
+		b = fp_prime_get_par_sps(&l);
+
+		for (j = 0; j < n; j += RLC_PP_EXP_BLK, c += k, a += k) {
+			k = RLC_MIN(RLC_PP_EXP_BLK, n - j);
+
+			/* First, compute m^(p^12 - 1)(p^4 + 1). */
+			pp_cyc_sim_k24(c, a, k);
+
+			/* Now follow the same addition chain as pp_exp_k24(). */
+			pp_sps_sim_k24(t0, c, k, b, l, bn_sign(x));
+			for (i = 0; i < k; i++) {
+				fp24_sqr_cyc(t1[i], t0[i]);
+				fp24_inv_cyc(t1[i], t1[i]);
+				fp24_mul(t1[i], t1[i], c[i]);
+			}
+
+			pp_sps_sim_k24(t0, t0, k, b, l, bn_sign(x));
+			for (i = 0; i < k; i++) {
+				fp24_mul(t0[i], t0[i], t1[i]);
+			}
+
+			pp_sps_sim_k24(t1, t0, k, b, l, bn_sign(x));
+			for (i = 0; i < k; i++) {
+				fp24_frb(t0[i], t0[i], 1);
+				fp24_mul(t1[i], t1[i], t0[i]);
+			}
+
+			pp_sps_sim_k24(t0, t1, k, b, l, bn_sign(x));
+			pp_sps_sim_k24(t0, t0, k, b, l, bn_sign(x));
+			for (i = 0; i < k; i++) {
+				fp24_frb(t1[i], t1[i], 2);
+				fp24_mul(t0[i], t0[i], t1[i]);
+			}
+
+			pp_sps_sim_k24(t1, t0, k, b, l, bn_sign(x));
+			pp_sps_sim_k24(t1, t1, k, b, l, bn_sign(x));
+			pp_sps_sim_k24(t1, t1, k, b, l, bn_sign(x));
+			pp_sps_sim_k24(t1, t1, k, b, l, bn_sign(x));
+			for (i = 0; i < k; i++) {
+				fp24_inv_cyc(t2[i], t0[i]);
+				fp24_frb(t0[i], t0[i], 4);
+				fp24_mul(t1[i], t1[i], t0[i]);
+				fp24_mul(t1[i], t1[i], t2[i]);
+
+				fp24_sqr_cyc(t0[i], c[i]);
+				fp24_mul(c[i], c[i], t0[i]);
+				fp24_mul(c[i], c[i], t1[i]);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < 3 * RLC_PP_EXP_BLK; i++) {
+			fp24_free(t[i]);
+		}
+		RLC_FREE(t);
+		bn_free(x);
+	}
+}
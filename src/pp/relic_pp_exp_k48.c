@@ -33,6 +33,132 @@
 #include "relic_pp.h"
 #include "relic_util.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Maps multiple 48-extension field elements to the cyclotomic subgroup,
+ * sharing a single inversion among them. Computes c = a^(p^24 - 1)(p^8 + 1).
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the extension field elements to map.
+ * @param[in] n				- the number of elements.
+ */
+static void pp_cyc_sim_k48(fp48_t *c, fp48_t *a, int n) {
+	int i;
+	fp48_t *t = RLC_ALLOCA(fp48_t, n);
+
+	RLC_TRY {
+		if (t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n; i++) {
+			fp48_null(t[i]);
+			fp48_new(t[i]);
+		}
+
+		fp48_inv_sim(t, a, n);
+		for (i = 0; i < n; i++) {
+			fp48_inv_cyc(c[i], a[i]);
+			fp48_mul(c[i], c[i], t[i]);
+			fp48_frb(t[i], c[i], 8);
+			fp48_mul(c[i], c[i], t[i]);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < n; i++) {
+			fp48_free(t[i]);
+		}
+		RLC_FREE(t);
+	}
+}
+
+/**
+ * Exponentiates multiple cyclotomic 48-extension field elements by a
+ * sparse exponent using compressed squarings, decompressing all the
+ * intermediate powers with a single shared inversion.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the elements to exponentiate.
+ * @param[in] n				- the number of elements.
+ * @param[in] b				- the positions of the non-zero bits.
+ * @param[in] len			- the number of non-zero bits.
+ * @param[in] sign			- the sign of the exponent.
+ */
+static void pp_sps_sim_k48(fp48_t *c, fp48_t *a, int n, const int *b,
+		int len, int sign) {
+	int i, j, k, e, s = (len > 0 && b[0] == 0), w = len - s;
+	fp48_t t, *u = RLC_ALLOCA(fp48_t, n * w);
+
+	if (len == 0) {
+		RLC_FREE(u);
+		for (e = 0; e < n; e++) {
+			fp48_set_dig(c[e], 1);
+		}
+		return;
+	}
+
+	fp48_null(t);
+
+	RLC_TRY {
+		if (u == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n * w; i++) {
+			fp48_null(u[i]);
+			fp48_new(u[i]);
+		}
+		fp48_new(t);
+
+		for (e = 0; e < n; e++) {
+			fp48_copy(t, a[e]);
+			for (j = 0, i = s; i < len; i++) {
+				k = (b[i] < 0 ? -b[i] : b[i]);
+				for (; j < k; j++) {
+					fp48_sqr_pck(t, t);
+				}
+				if (b[i] < 0) {
+					fp48_inv_cyc(u[e * w + i - s], t);
+				} else {
+					fp48_copy(u[e * w + i - s], t);
+				}
+			}
+		}
+
+		fp48_back_cyc_sim(u, u, n * w);
+
+		for (e = 0; e < n; e++) {
+			if (s) {
+				fp48_copy(t, a[e]);
+			} else {
+				fp48_copy(t, u[e * w]);
+			}
+			for (i = 1 - s; i < w; i++) {
+				fp48_mul(t, t, u[e * w + i]);
+			}
+			if (sign == RLC_NEG) {
+				fp48_inv_cyc(c[e], t);
+			} else {
+				fp48_copy(c[e], t);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < n * w; i++) {
+			fp48_free(u[i]);
+		}
+		fp48_free(t);
+		RLC_FREE(u);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -174,3 +300,81 @@ void pp_exp_k48(fp48_t c, fp48_t a) {
 		bn_free(x);
 	}
 }
+
+void pp_exp_k48_many(fp48_t *c, fp48_t *a, int n) {
+	fp48_t *t = RLC_ALLOCA(fp48_t, 4 * RLC_PP_EXP_BLK), *u, *v;
+	fp48_t *t0 = t, *t1 = t + RLC_PP_EXP_BLK, *t2 = t + 2 * RLC_PP_EXP_BLK;
+	fp48_t *t3 = t + 3 * RLC_PP_EXP_BLK;
+	const int *b;
+	bn_t x;
+	int e, i, j, k, l;
+
+	bn_null(x);
+
+	RLC_TRY {
+		if (t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < 4 * RLC_PP_EXP_BLK; i++) {
+			fp48_null(t[i]);
+			fp48_new(t[i]);
+		}
+		bn_new(x);
+
+		fp_prime_get_par(x);
+		b = fp_prime_get_par_sps(&l);
+
+		for (j = 0; j < n; j += RLC_PP_EXP_BLK, c += k, a += k) {
+			k = RLC_MIN(RLC_PP_EXP_BLK, n - j);
+
+			/* First, compute m^(p^24 - 1)(p^8 + 1). */
+			pp_cyc_sim_k48(c, a, k);
+
+			/* t2 = c^k15, c = c^3 * t2^p^15. */
+			pp_sps_sim_k48(t0, c, k, b, l, bn_sign(x));
+			for (i = 0; i < k; i++) {
+				fp48_inv_cyc(t1[i], c[i]);
+				fp48_mul(t0[i], t0[i], t1[i]);
+			}
+			pp_sps_sim_k48(t1, t0, k, b, l, bn_sign(x));
+			for (i = 0; i < k; i++) {
+				fp48_inv_cyc(t2[i], t0[i]);
+				fp48_mul(t2[i], t1[i], t2[i]);
+				fp48_sqr_cyc(t3[i], c[i]);
+				fp48_mul(c[i], c[i], t3[i]);
+				fp48_frb(t3[i], t2[i], 15);
+				fp48_mul(c[i], c[i], t3[i]);
+			}
+
+			/* Compute k14, ..., k0 and accumulate c = c * k_e^p^e. */
+			for (u = t2, v = t0, e = 14; e >= 0; e--) {
+				pp_sps_sim_k48(v, u, k, b, l, bn_sign(x));
+				for (i = 0; i < k; i++) {
+					if (e == 7) {
+						/* k7 = xk8 - k15. */
+						fp48_inv_cyc(t3[i], t2[i]);
+						fp48_mul(v[i], v[i], t3[i]);
+					}
+					if (e > 0) {
+						fp48_frb(t3[i], v[i], e);
+						fp48_mul(c[i], c[i], t3[i]);
+					} else {
+						fp48_mul(c[i], c[i], v[i]);
+					}
+				}
+				u = v;
+				v = (u == t0 ? t1 : t0);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < 4 * RLC_PP_EXP_BLK; i++) {
+			fp48_free(t[i]);
+		}
+		RLC_FREE(t);
+		bn_free(x);
+	}
+}
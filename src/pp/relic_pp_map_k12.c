@@ -230,6 +230,593 @@ static void pp_fin_k12_oatep(fp12_t r, ep2_t t, ep2_t q, ep_t p) {
 	}
 }
 
+#if PP_MAP == OATEP || !defined(STRIP)
+
+/**
+ * Multiplies two sparse lines A + B * x_P + C with A in the prime field, as
+ * produced by the affine Miller steps. The output cannot alias the inputs.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first line.
+ * @param[in] b				- the second line.
+ */
+static void pp_mul_lxl_k12(fp12_t c, fp12_t a, fp12_t b) {
+	fp2_t t0, t1, t2, t3;
+	int i, one = 1, zero = 0;
+
+	fp2_null(t0);
+	fp2_null(t1);
+	fp2_null(t2);
+	fp2_null(t3);
+
+	RLC_TRY {
+		fp2_new(t0);
+		fp2_new(t1);
+		fp2_new(t2);
+		fp2_new(t3);
+
+		if (ep2_curve_is_twist() == RLC_EP_MTYPE) {
+			one ^= 1;
+			zero ^= 1;
+		}
+
+		/* t0 = B * B', t1 = C * C', t2 = B * C' + C * B'. */
+		fp2_mul(t0, a[one][zero], b[one][zero]);
+		fp2_mul(t1, a[one][one], b[one][one]);
+		fp2_add(t2, a[one][zero], a[one][one]);
+		fp2_add(t3, b[one][zero], b[one][one]);
+		fp2_mul(t2, t2, t3);
+		fp2_sub(t2, t2, t0);
+		fp2_sub(t2, t2, t1);
+		/* t3 = A * A'. */
+		fp_mul(t3[0], a[zero][zero][0], b[zero][zero][0]);
+		fp_zero(t3[1]);
+
+		if (ep2_curve_is_twist() == RLC_EP_MTYPE) {
+			/* c_0 = C * C' + A * A' * v + (B * C' + C * B') * w + B * B' * w^2. */
+			fp2_mul_nor(t3, t3);
+			fp2_add(c[0][0], t1, t3);
+			fp2_copy(c[0][1], t2);
+			fp2_copy(c[0][2], t0);
+			fp2_zero(c[1][0]);
+		} else {
+			/* c_0 = A * A' + C * C' * v + B * B' * w + (B * C' + C * B') * w^2. */
+			fp2_mul_nor(t1, t1);
+			fp2_add(c[0][0], t3, t1);
+			fp2_copy(c[0][1], t0);
+			fp2_copy(c[0][2], t2);
+			fp2_zero(c[1][2]);
+		}
+		/* c_1 gets the cross terms (B * A' + A * B') and (C * A' + A * C'). */
+		for (i = 0; i < 2; i++) {
+			fp_mul(t0[i], a[one][zero][i], b[zero][zero][0]);
+			fp_mul(t1[i], b[one][zero][i], a[zero][zero][0]);
+			fp_mul(t2[i], a[one][one][i], b[zero][zero][0]);
+			fp_mul(t3[i], b[one][one][i], a[zero][zero][0]);
+		}
+		fp2_add(t0, t0, t1);
+		fp2_add(t2, t2, t3);
+		if (ep2_curve_is_twist() == RLC_EP_MTYPE) {
+			fp2_copy(c[1][1], t2);
+			fp2_copy(c[1][2], t0);
+		} else {
+			fp2_copy(c[1][0], t0);
+			fp2_copy(c[1][1], t2);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp2_free(t0);
+		fp2_free(t1);
+		fp2_free(t2);
+		fp2_free(t3);
+	}
+}
+
+/**
+ * Computes a step of the affine Miller loop for many pairings, sharing the
+ * inversion of the slope denominators. Doubles the points T_j if Q is NULL
+ * and adds Q_j to them otherwise, then accumulates the lines evaluated at the
+ * P_j, two at a time. Raises ERR_NO_VALID if a denominator is zero, which
+ * requires points Q_j outside the subgroup G_2.
+ *
+ * @param[in,out] r			- the accumulator.
+ * @param[in,out] t			- the points T_j in affine coordinates.
+ * @param[in] q				- the points Q_j in affine coordinates, or NULL.
+ * @param[in] p				- the points P_j in affine coordinates.
+ * @param[in] d				- the temporary vector of m denominators.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+static void pp_stp_aff_k12(fp12_t r, ep2_t *t, ep2_t *q, ep_t *p, fp2_t *d,
+		int m) {
+	fp12_t l[3];
+	fp2_t s, u;
+	int j, one = 1, zero = 0;
+
+	fp2_null(s);
+	fp2_null(u);
+	for (j = 0; j < 3; j++) {
+		fp12_null(l[j]);
+	}
+
+	RLC_TRY {
+		fp2_new(s);
+		fp2_new(u);
+		for (j = 0; j < 3; j++) {
+			fp12_new(l[j]);
+		}
+		fp12_zero(l[0]);
+		fp12_zero(l[1]);
+
+		if (ep2_curve_is_twist() == RLC_EP_MTYPE) {
+			one ^= 1;
+			zero ^= 1;
+		}
+
+		for (j = 0; j < m; j++) {
+			if (q == NULL) {
+				fp2_dbl(d[j], t[j]->y);
+			} else {
+				fp2_sub(d[j], q[j]->x, t[j]->x);
+			}
+			/* Only happens outside G_2, and would spoil all the inverses. */
+			if (fp2_is_zero(d[j])) {
+				RLC_THROW(ERR_NO_VALID);
+			}
+		}
+		fp2_inv_sim(d, d, m);
+
+		for (j = 0; j < m; j++) {
+			if (q == NULL) {
+				/* s = (3 * x1^2 + a)/(2 * y1), u = x3 = s^2 - 2 * x1. */
+				fp2_sqr(s, t[j]->x);
+				fp2_dbl(u, s);
+				fp2_add(s, s, u);
+				if (ep2_curve_opt_a() != RLC_ZERO) {
+					fp2_add(s, s, ep2_curve_get_a());
+				}
+				fp2_mul(s, s, d[j]);
+				fp2_sqr(u, s);
+				fp2_sub(u, u, t[j]->x);
+				fp2_sub(u, u, t[j]->x);
+			} else {
+				/* s = (y2 - y1)/(x2 - x1), u = x3 = s^2 - x1 - x2. */
+				fp2_sub(s, q[j]->y, t[j]->y);
+				fp2_mul(s, s, d[j]);
+				fp2_sqr(u, s);
+				fp2_sub(u, u, t[j]->x);
+				fp2_sub(u, u, q[j]->x);
+			}
+
+			/* l = s * xp + (y1 - s * x1) - yp. */
+			fp_mul(l[j & 1][one][zero][0], s[0], p[j]->x);
+			fp_mul(l[j & 1][one][zero][1], s[1], p[j]->x);
+			fp2_mul(l[j & 1][one][one], s, t[j]->x);
+			fp2_sub(l[j & 1][one][one], t[j]->y, l[j & 1][one][one]);
+			fp_neg(l[j & 1][zero][zero][0], p[j]->y);
+
+			/* y3 = s * (x1 - x3) - y1. */
+			fp2_sub(t[j]->x, t[j]->x, u);
+			fp2_mul(t[j]->x, t[j]->x, s);
+			fp2_sub(t[j]->y, t[j]->x, t[j]->y);
+			fp2_copy(t[j]->x, u);
+
+			if (j & 1) {
+				pp_mul_lxl_k12(l[2], l[0], l[1]);
+				fp12_mul(r, r, l[2]);
+			}
+		}
+		if (m & 1) {
+			fp12_mul_dxs(r, r, l[0]);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp2_free(s);
+		fp2_free(u);
+		for (j = 0; j < 3; j++) {
+			fp12_free(l[j]);
+		}
+	}
+}
+
+/**
+ * Computes the Miller loop of the optimal ate multi-pairing in affine
+ * coordinates, without the final exponentiation.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments in affine coordinates.
+ * @param[in] q				- the second pairing arguments in affine coordinates.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+static void pp_mil_aff_k12(fp12_t r, ep_t *p, ep2_t *q, int m) {
+	ep2_t *t = RLC_ALLOCA(ep2_t, m);
+	ep2_t *_q = RLC_ALLOCA(ep2_t, m);
+	fp2_t *d = RLC_ALLOCA(fp2_t, m);
+	bn_t a;
+	int i, j, len;
+	int8_t s[RLC_FP_BITS + 1];
+
+	bn_null(a);
+
+	RLC_TRY {
+		bn_new(a);
+		if (t == NULL || _q == NULL || d == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (j = 0; j < m; j++) {
+			ep2_null(t[j]);
+			ep2_null(_q[j]);
+			fp2_null(d[j]);
+			ep2_new(t[j]);
+			ep2_new(_q[j]);
+			fp2_new(d[j]);
+			ep2_copy(t[j], q[j]);
+			ep2_neg(_q[j], q[j]);
+		}
+
+		fp_prime_get_par(a);
+		if (ep_curve_is_pairf() == EP_BN) {
+			bn_mul_dig(a, a, 6);
+			bn_add_dig(a, a, 2);
+		}
+		len = bn_bits(a) + 1;
+		bn_rec_naf(s, &len, a, 2);
+
+		fp12_set_dig(r, 1);
+		for (i = len - 2; i >= 0; i--) {
+			if (i < len - 2) {
+				fp12_sqr(r, r);
+			}
+			pp_stp_aff_k12(r, t, NULL, p, d, m);
+			if (s[i] > 0) {
+				pp_stp_aff_k12(r, t, q, p, d, m);
+			}
+			if (s[i] < 0) {
+				pp_stp_aff_k12(r, t, _q, p, d, m);
+			}
+		}
+
+		if (bn_sign(a) == RLC_NEG) {
+			/* f_{-a,Q}(P) = 1/f_{a,Q}(P). */
+			fp12_inv_cyc(r, r);
+		}
+		if (ep_curve_is_pairf() == EP_BN) {
+			for (j = 0; j < m; j++) {
+				if (bn_sign(a) == RLC_NEG) {
+					ep2_neg(t[j], t[j]);
+				}
+				ep2_frb(_q[j], q[j], 1);
+			}
+			pp_stp_aff_k12(r, t, _q, p, d, m);
+			for (j = 0; j < m; j++) {
+				ep2_frb(_q[j], q[j], 2);
+				ep2_neg(_q[j], _q[j]);
+			}
+			pp_stp_aff_k12(r, t, _q, p, d, m);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(a);
+		for (j = 0; j < m; j++) {
+			ep2_free(t[j]);
+			ep2_free(_q[j]);
+			fp2_free(d[j]);
+		}
+		RLC_FREE(t);
+		RLC_FREE(_q);
+		RLC_FREE(d);
+	}
+}
+
+/**
+ * Computes the Miller loop of the optimal ate multi-pairing, without the final
+ * exponentiation.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments in affine coordinates.
+ * @param[in] q				- the second pairing arguments in affine coordinates.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+static void pp_mil_sim_k12(fp12_t r, ep_t *p, ep2_t *q, int m) {
+	ep2_t *t = RLC_ALLOCA(ep2_t, m);
+	bn_t a;
+	int i;
+	bn_null(a);
+
+	RLC_TRY {
+		bn_new(a);
+		if (t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < m; i++) {
+			ep2_null(t[i]);
+			ep2_new(t[i]);
+		}
+
+		fp12_set_dig(r, 1);
+		fp_prime_get_par(a);
+		switch (ep_curve_is_pairf()) {
+			case EP_BN:
+				bn_mul_dig(a, a, 6);
+				bn_add_dig(a, a, 2);
+				/* r = f_{|a|,Q}(P). */
+				pp_mil_k12(r, t, q, p, m, a);
+				if (bn_sign(a) == RLC_NEG) {
+					/* f_{-a,Q}(P) = 1/f_{a,Q}(P). */
+					fp12_inv_cyc(r, r);
+				}
+				for (i = 0; i < m; i++) {
+					if (bn_sign(a) == RLC_NEG) {
+						ep2_neg(t[i], t[i]);
+					}
+					pp_fin_k12_oatep(r, t[i], q[i], p[i]);
+				}
+				break;
+			case EP_B12:
+				/* r = f_{|a|,Q}(P). */
+				pp_mil_k12(r, t, q, p, m, a);
+				if (bn_sign(a) == RLC_NEG) {
+					fp12_inv_cyc(r, r);
+				}
+				break;
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(a);
+		for (i = 0; i < m; i++) {
+			ep2_free(t[i]);
+		}
+		RLC_FREE(t);
+	}
+}
+
+#if defined(MULTI) && CORES > 1
+
+/**
+ * Represents the pairings split among the threads computing Miller loops.
+ */
+typedef struct {
+	/** The partial results. */
+	fp12_t *s;
+	/** The first pairing arguments. */
+	ep_t *p;
+	/** The second pairing arguments. */
+	ep2_t *q;
+	/** The number of pairings. */
+	int m;
+	/** The number of threads. */
+	int n;
+} pp_job_k12_t;
+
+/**
+ * Computes the Miller loops of the pairings assigned to a thread.
+ *
+ * @param[in,out] ptr		- the pairings split among the threads.
+ * @param[in] i				- the thread identifier.
+ */
+static void pp_job_k12(void *ptr, int i) {
+	pp_job_k12_t *job = (pp_job_k12_t *)ptr;
+	int m = job->m, n = job->n, c = (i + 1) * m / n - i * m / n;
+
+	/* Each thread shares its own inversions once it has enough pairs. */
+	if (c >= RLC_PP_AFF_MIN) {
+		pp_mil_aff_k12(job->s[i], job->p + i * m / n, job->q + i * m / n, c);
+	} else {
+		pp_mil_sim_k12(job->s[i], job->p + i * m / n, job->q + i * m / n, c);
+	}
+}
+
+#endif
+
+/**
+ * Computes the Miller loop of the optimal ate multi-pairing, splitting the
+ * pairings among CORES threads if multithreading is enabled.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments in affine coordinates.
+ * @param[in] q				- the second pairing arguments in affine coordinates.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+static void pp_mil_par_k12(fp12_t r, ep_t *p, ep2_t *q, int m) {
+#if defined(MULTI) && CORES > 1
+	int i, n = RLC_MIN(CORES, m);
+	fp12_t *s = RLC_ALLOCA(fp12_t, n);
+	pp_job_k12_t job;
+
+	if (n < 2) {
+		RLC_FREE(s);
+		pp_mil_sim_k12(r, p, q, m);
+		return;
+	}
+
+	RLC_TRY {
+		if (s == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n; i++) {
+			fp12_null(s[i]);
+			fp12_new(s[i]);
+		}
+
+		job.s = s;
+		job.p = p;
+		job.q = q;
+		job.m = m;
+		job.n = n;
+		if (core_run(pp_job_k12, &job, n) != RLC_OK) {
+			RLC_THROW(ERR_CAUGHT);
+		}
+		/* Combine partial results before the single final exponentiation. */
+		fp12_copy(r, s[0]);
+		for (i = 1; i < n; i++) {
+			fp12_mul(r, r, s[i]);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < n; i++) {
+			fp12_free(s[i]);
+		}
+		RLC_FREE(s);
+	}
+#else
+	if (m >= RLC_PP_AFF_MIN) {
+		/* With enough pairs, shared inversions make affine steps cheaper. */
+		pp_mil_aff_k12(r, p, q, m);
+	} else {
+		pp_mil_sim_k12(r, p, q, m);
+	}
+#endif
+}
+
+/**
+ * Stores the coefficients of a line computed at a fixed point, such that the
+ * line evaluated at P is t[0] + t[1] * x_P + t[2] * y_P.
+ *
+ * @param[out] t			- the three line coefficients.
+ * @param[in] l				- the line computed at the fixed point.
+ */
+static void pp_lin_pre_k12(fp2_t *t, fp12_t l) {
+	int one = 1, zero = 0;
+
+	if (ep2_curve_is_twist() == RLC_EP_MTYPE) {
+		one ^= 1;
+		zero ^= 1;
+	}
+
+	fp2_copy(t[0], l[one][one]);
+	fp2_copy(t[1], l[one][zero]);
+	fp2_copy(t[2], l[zero][zero]);
+}
+
+/**
+ * Evaluates a precomputed line at a point in G_1.
+ *
+ * @param[out] l			- the sparse line.
+ * @param[in] t				- the three line coefficients.
+ * @param[in] p				- the point in affine coordinates.
+ */
+static void pp_lin_k12(fp12_t l, fp2_t *t, ep_t p) {
+	int one = 1, zero = 0;
+
+	if (ep2_curve_is_twist() == RLC_EP_MTYPE) {
+		one ^= 1;
+		zero ^= 1;
+	}
+
+	fp2_copy(l[one][one], t[0]);
+	fp_mul(l[one][zero][0], t[1][0], p->x);
+	fp_mul(l[one][zero][1], t[1][1], p->x);
+	fp_mul(l[zero][zero][0], t[2][0], p->y);
+	fp_mul(l[zero][zero][1], t[2][1], p->y);
+}
+
+/**
+ * Computes the Miller loop of the optimal ate multi-pairing with precomputed
+ * lines, without the final exponentiation.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments in affine coordinates.
+ * @param[in] t				- the precomputed lines of the second arguments.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+static void pp_mil_pre_k12(fp12_t r, ep_t *p, fp2_t **t, int m) {
+	fp12_t l;
+	bn_t a;
+	int i, j, k, len;
+	int8_t s[RLC_FP_BITS + 1];
+
+	fp12_null(l);
+	bn_null(a);
+
+	RLC_TRY {
+		fp12_new(l);
+		bn_new(a);
+
+		fp_prime_get_par(a);
+		if (ep_curve_is_pairf() == EP_BN) {
+			bn_mul_dig(a, a, 6);
+			bn_add_dig(a, a, 2);
+		}
+		len = bn_bits(a) + 1;
+		bn_rec_naf(s, &len, a, 2);
+
+		fp12_zero(l);
+		fp12_zero(r);
+		pp_lin_k12(r, t[0], p[0]);
+		for (j = 1; j < m; j++) {
+			pp_lin_k12(l, t[j], p[j]);
+			fp12_mul_dxs(r, r, l);
+		}
+		k = 3;
+		if (s[len - 2] != 0) {
+			for (j = 0; j < m; j++) {
+				pp_lin_k12(l, t[j] + k, p[j]);
+				fp12_mul_dxs(r, r, l);
+			}
+			k += 3;
+		}
+
+		for (i = len - 3; i >= 0; i--) {
+			fp12_sqr(r, r);
+			for (j = 0; j < m; j++) {
+				pp_lin_k12(l, t[j] + k, p[j]);
+				fp12_mul_dxs(r, r, l);
+				if (s[i] != 0) {
+					pp_lin_k12(l, t[j] + k + 3, p[j]);
+					fp12_mul_dxs(r, r, l);
+				}
+			}
+			k += (s[i] != 0 ? 6 : 3);
+		}
+
+		if (bn_sign(a) == RLC_NEG) {
+			/* f_{-a,Q}(P) = 1/f_{a,Q}(P). */
+			fp12_inv_cyc(r, r);
+		}
+		if (ep_curve_is_pairf() == EP_BN) {
+			for (j = 0; j < m; j++) {
+				pp_lin_k12(l, t[j] + k, p[j]);
+				fp12_mul_dxs(r, r, l);
+				pp_lin_k12(l, t[j] + k + 3, p[j]);
+				fp12_mul_dxs(r, r, l);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp12_free(l);
+		bn_free(a);
+	}
+}
+
+/**
+ * Tests if a table of precomputed lines corresponds to the point at infinity.
+ *
+ * @param[in] t				- the precomputed lines.
+ * @return 1 if the table represents the point at infinity, 0 otherwise.
+ */
+static int pp_pre_is_infty_k12(fp2_t *t) {
+	return fp2_is_zero(t[0]) && fp2_is_zero(t[1]) && fp2_is_zero(t[2]);
+}
+
+#endif
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -522,23 +1109,18 @@ void pp_map_oatep_k12(fp12_t r, ep_t p, ep2_t q) {
 
 void pp_map_sim_oatep_k12(fp12_t r, ep_t *p, ep2_t *q, int m) {
 	ep_t *_p = RLC_ALLOCA(ep_t, m);
-	ep2_t *t = RLC_ALLOCA(ep2_t, m), *_q = RLC_ALLOCA(ep2_t, m);
-	bn_t a;
+	ep2_t *_q = RLC_ALLOCA(ep2_t, m);
 	int i, j;
 
 	RLC_TRY {
-		bn_null(a);
-		bn_new(a);
-		if (_p == NULL || _q == NULL || t == NULL) {
+		if (_p == NULL || _q == NULL) {
 			RLC_THROW(ERR_NO_MEMORY);
 		}
 		for (i = 0; i < m; i++) {
 			ep_null(_p[i]);
 			ep2_null(_q[i]);
-			ep2_null(t[i]);
 			ep_new(_p[i]);
 			ep2_new(_q[i]);
-			ep2_new(t[i]);
 		}
 
 		j = 0;
@@ -549,52 +1131,246 @@ void pp_map_sim_oatep_k12(fp12_t r, ep_t *p, ep2_t *q, int m) {
 			}
 		}
 
-		fp_prime_get_par(a);
 		fp12_set_dig(r, 1);
-
 		if (j > 0) {
-			switch (ep_curve_is_pairf()) {
-				case EP_BN:
-					bn_mul_dig(a, a, 6);
-					bn_add_dig(a, a, 2);
-					/* r = f_{|a|,Q}(P). */
-					pp_mil_k12(r, t, _q, _p, j, a);
-					if (bn_sign(a) == RLC_NEG) {
-						/* f_{-a,Q}(P) = 1/f_{a,Q}(P). */
-						fp12_inv_cyc(r, r);
-					}
-					for (i = 0; i < j; i++) {
-						if (bn_sign(a) == RLC_NEG) {
-							ep2_neg(t[i], t[i]);
-						}
-						pp_fin_k12_oatep(r, t[i], _q[i], _p[i]);
-					}
-					pp_exp_k12(r, r);
-					break;
-				case EP_B12:
-					/* r = f_{|a|,Q}(P). */
-					pp_mil_k12(r, t, _q, _p, j, a);
-					if (bn_sign(a) == RLC_NEG) {
-						fp12_inv_cyc(r, r);
-					}
-					pp_exp_k12(r, r);
-					break;
+			pp_mil_par_k12(r, _p, _q, j);
+			pp_exp_k12(r, r);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < m; i++) {
+			ep_free(_p[i]);
+			ep2_free(_q[i]);
+		}
+		RLC_FREE(_p);
+		RLC_FREE(_q);
+	}
+}
+
+void pp_map_sim_oatep_k12_aff(fp12_t r, ep_t *p, ep2_t *q, int m) {
+	ep_t *_p = RLC_ALLOCA(ep_t, m);
+	ep2_t *_q = RLC_ALLOCA(ep2_t, m);
+	int i, j;
+
+	RLC_TRY {
+		if (_p == NULL || _q == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < m; i++) {
+			ep_null(_p[i]);
+			ep2_null(_q[i]);
+			ep_new(_p[i]);
+			ep2_new(_q[i]);
+		}
+
+		j = 0;
+		for (i = 0; i < m; i++) {
+			if (!ep_is_infty(p[i]) && !ep2_is_infty(q[i])) {
+				ep_norm(_p[j], p[i]);
+				ep2_norm(_q[j++], q[i]);
 			}
 		}
+
+		fp12_set_dig(r, 1);
+		if (j > 0) {
+			pp_mil_aff_k12(r, _p, _q, j);
+			pp_exp_k12(r, r);
+		}
 	}
 	RLC_CATCH_ANY {
 		RLC_THROW(ERR_CAUGHT);
 	}
 	RLC_FINALLY {
-		bn_free(a);
 		for (i = 0; i < m; i++) {
 			ep_free(_p[i]);
 			ep2_free(_q[i]);
-			ep2_free(t[i]);
 		}
 		RLC_FREE(_p);
 		RLC_FREE(_q);
-		RLC_FREE(t);
+	}
+}
+
+void pp_map_pre_k12(fp2_t *t, ep2_t q) {
+	fp12_t l;
+	ep_t u, v;
+	ep2_t _q, r, n, q1, q2;
+	bn_t a;
+	int i, k, len;
+	int8_t s[RLC_FP_BITS + 1];
+
+	fp12_null(l);
+	ep_null(u);
+	ep_null(v);
+	ep2_null(_q);
+	ep2_null(r);
+	ep2_null(n);
+	ep2_null(q1);
+	ep2_null(q2);
+	bn_null(a);
+
+	RLC_TRY {
+		fp12_new(l);
+		ep_new(u);
+		ep_new(v);
+		ep2_new(_q);
+		ep2_new(r);
+		ep2_new(n);
+		ep2_new(q1);
+		ep2_new(q2);
+		bn_new(a);
+
+		ep2_norm(_q, q);
+		if (ep2_is_infty(_q)) {
+			/* Mark the point at infinity with a null first line. */
+			for (i = 0; i < 3; i++) {
+				fp2_zero(t[i]);
+			}
+		} else {
+			fp_prime_get_par(a);
+			if (ep_curve_is_pairf() == EP_BN) {
+				bn_mul_dig(a, a, 6);
+				bn_add_dig(a, a, 2);
+			}
+			len = bn_bits(a) + 1;
+			if (len > RLC_PP_LOOP(12)) {
+				RLC_THROW(ERR_NO_BUFFER);
+			}
+			bn_rec_naf(s, &len, a, 2);
+
+			/* Evaluate lines at points with coordinates (x, y) such that the
+			 * lines become linear functions of the coordinates of P. */
+#if EP_ADD == BASIC
+			fp_set_dig(u->x, 1);
+#else
+			fp_set_dig(u->x, 3);
+#endif
+			fp_set_dig(u->y, 1);
+			fp_neg(u->y, u->y);
+			fp_set_dig(u->z, 1);
+			u->coord = BASIC;
+			fp_set_dig(v->x, 1);
+			fp_set_dig(v->y, 1);
+			fp_set_dig(v->z, 1);
+			v->coord = BASIC;
+
+			fp12_zero(l);
+			ep2_copy(r, _q);
+			ep2_neg(n, _q);
+			pp_dbl_k12(l, r, r, u);
+			pp_lin_pre_k12(t, l);
+			k = 3;
+			if (s[len - 2] != 0) {
+				pp_add_k12(l, r, (s[len - 2] > 0 ? _q : n), v);
+				pp_lin_pre_k12(t + k, l);
+				k += 3;
+			}
+			for (i = len - 3; i >= 0; i--) {
+				pp_dbl_k12(l, r, r, u);
+				pp_lin_pre_k12(t + k, l);
+				k += 3;
+				if (s[i] != 0) {
+					pp_add_k12(l, r, (s[i] > 0 ? _q : n), v);
+					pp_lin_pre_k12(t + k, l);
+					k += 3;
+				}
+			}
+
+			if (ep_curve_is_pairf() == EP_BN) {
+				if (bn_sign(a) == RLC_NEG) {
+					ep2_neg(r, r);
+				}
+				fp2_set_dig(q1->z, 1);
+				fp2_set_dig(q2->z, 1);
+				ep2_frb(q1, _q, 1);
+				ep2_frb(q2, _q, 2);
+				ep2_neg(q2, q2);
+				pp_add_k12(l, r, q1, v);
+				pp_lin_pre_k12(t + k, l);
+				pp_add_k12(l, r, q2, v);
+				pp_lin_pre_k12(t + k + 3, l);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp12_free(l);
+		ep_free(u);
+		ep_free(v);
+		ep2_free(_q);
+		ep2_free(r);
+		ep2_free(n);
+		ep2_free(q1);
+		ep2_free(q2);
+		bn_free(a);
+	}
+}
+
+void pp_map_oatep_k12_pre(fp12_t r, ep_t p, fp2_t *t) {
+	ep_t _p[1];
+
+	ep_null(_p[0]);
+
+	RLC_TRY {
+		ep_new(_p[0]);
+
+		ep_norm(_p[0], p);
+
+		fp12_set_dig(r, 1);
+		if (!ep_is_infty(_p[0]) && !pp_pre_is_infty_k12(t)) {
+			pp_mil_pre_k12(r, _p, &t, 1);
+			pp_exp_k12(r, r);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ep_free(_p[0]);
+	}
+}
+
+void pp_map_sim_oatep_k12_pre(fp12_t r, ep_t *p, fp2_t **t, int m) {
+	ep_t *_p = RLC_ALLOCA(ep_t, m);
+	fp2_t **_t = RLC_ALLOCA(fp2_t *, m);
+	int i, j;
+
+	RLC_TRY {
+		if (_p == NULL || _t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < m; i++) {
+			ep_null(_p[i]);
+			ep_new(_p[i]);
+		}
+
+		j = 0;
+		for (i = 0; i < m; i++) {
+			if (!ep_is_infty(p[i]) && !pp_pre_is_infty_k12(t[i])) {
+				ep_norm(_p[j], p[i]);
+				_t[j++] = t[i];
+			}
+		}
+
+		fp12_set_dig(r, 1);
+		if (j > 0) {
+			pp_mil_pre_k12(r, _p, _t, j);
+			pp_exp_k12(r, r);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < m; i++) {
+			ep_free(_p[i]);
+		}
+		RLC_FREE(_p);
+		RLC_FREE(_t);
 	}
 }
 
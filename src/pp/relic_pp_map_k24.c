@@ -132,6 +132,273 @@ static void pp_mil_k24(fp24_t r, ep4_t *t, ep4_t *q, ep_t *p, int m, bn_t a) {
 	}
 }
 
+#if PP_MAP == OATEP || !defined(STRIP)
+
+/**
+ * Computes the Miller loop of the optimal ate multi-pairing, without the final
+ * exponentiation.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments in affine coordinates.
+ * @param[in] q				- the second pairing arguments in affine coordinates.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+static void pp_mil_sim_k24(fp24_t r, ep_t *p, ep4_t *q, int m) {
+	ep4_t *t = RLC_ALLOCA(ep4_t, m);
+	bn_t a;
+	int i;
+	bn_null(a);
+
+	RLC_TRY {
+		bn_new(a);
+		if (t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < m; i++) {
+			ep4_null(t[i]);
+			ep4_new(t[i]);
+		}
+
+		fp24_set_dig(r, 1);
+		fp_prime_get_par(a);
+		switch (ep_curve_is_pairf()) {
+			case EP_B24:
+				/* r = f_{|a|,Q}(P). */
+				pp_mil_k24(r, t, q, p, m, a);
+				if (bn_sign(a) == RLC_NEG) {
+					fp24_inv_cyc(r, r);
+				}
+				break;
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(a);
+		for (i = 0; i < m; i++) {
+			ep4_free(t[i]);
+		}
+		RLC_FREE(t);
+	}
+}
+
+#if defined(MULTI) && CORES > 1
+
+/**
+ * Represents the pairings split among the threads computing Miller loops.
+ */
+typedef struct {
+	/** The partial results. */
+	fp24_t *s;
+	/** The first pairing arguments. */
+	ep_t *p;
+	/** The second pairing arguments. */
+	ep4_t *q;
+	/** The number of pairings. */
+	int m;
+	/** The number of threads. */
+	int n;
+} pp_job_k24_t;
+
+/**
+ * Computes the Miller loops of the pairings assigned to a thread.
+ *
+ * @param[in,out] ptr		- the pairings split among the threads.
+ * @param[in] i				- the thread identifier.
+ */
+static void pp_job_k24(void *ptr, int i) {
+	pp_job_k24_t *job = (pp_job_k24_t *)ptr;
+	int m = job->m, n = job->n;
+
+	pp_mil_sim_k24(job->s[i], job->p + i * m / n, job->q + i * m / n,
+			(i + 1) * m / n - i * m / n);
+}
+
+#endif
+
+/**
+ * Computes the Miller loop of the optimal ate multi-pairing, splitting the
+ * pairings among CORES threads if multithreading is enabled.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments in affine coordinates.
+ * @param[in] q				- the second pairing arguments in affine coordinates.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+static void pp_mil_par_k24(fp24_t r, ep_t *p, ep4_t *q, int m) {
+#if defined(MULTI) && CORES > 1
+	int i, n = RLC_MIN(CORES, m);
+	fp24_t *s = RLC_ALLOCA(fp24_t, n);
+	pp_job_k24_t job;
+
+	if (n < 2) {
+		RLC_FREE(s);
+		pp_mil_sim_k24(r, p, q, m);
+		return;
+	}
+
+	RLC_TRY {
+		if (s == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n; i++) {
+			fp24_null(s[i]);
+			fp24_new(s[i]);
+		}
+
+		job.s = s;
+		job.p = p;
+		job.q = q;
+		job.m = m;
+		job.n = n;
+		if (core_run(pp_job_k24, &job, n) != RLC_OK) {
+			RLC_THROW(ERR_CAUGHT);
+		}
+		/* Combine partial results before the single final exponentiation. */
+		fp24_copy(r, s[0]);
+		for (i = 1; i < n; i++) {
+			fp24_mul(r, r, s[i]);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < n; i++) {
+			fp24_free(s[i]);
+		}
+		RLC_FREE(s);
+	}
+#else
+	pp_mil_sim_k24(r, p, q, m);
+#endif
+}
+
+/**
+ * Stores the coefficients of a line computed at a fixed point, such that the
+ * line evaluated at P is t[0] + t[1] * x_P + t[2] * y_P.
+ *
+ * @param[out] t			- the three line coefficients.
+ * @param[in] l				- the line computed at the fixed point.
+ */
+static void pp_lin_pre_k24(fp4_t *t, fp24_t l) {
+	int two = 1, one = 1;
+
+	if (ep4_curve_is_twist() == RLC_EP_MTYPE) {
+		two += 1;
+		one ^= 1;
+	}
+
+	fp4_copy(t[0], l[0][0]);
+	fp4_copy(t[1], l[two][one]);
+	fp4_copy(t[2], l[0][1]);
+}
+
+/**
+ * Evaluates a precomputed line at a point in G_1.
+ *
+ * @param[out] l			- the sparse line.
+ * @param[in] t				- the three line coefficients.
+ * @param[in] p				- the point in affine coordinates.
+ */
+static void pp_lin_k24(fp24_t l, fp4_t *t, ep_t p) {
+	int i, j, two = 1, one = 1;
+
+	if (ep4_curve_is_twist() == RLC_EP_MTYPE) {
+		two += 1;
+		one ^= 1;
+	}
+
+	fp4_copy(l[0][0], t[0]);
+	for (i = 0; i < 2; i++) {
+		for (j = 0; j < 2; j++) {
+			fp_mul(l[two][one][i][j], t[1][i][j], p->x);
+			fp_mul(l[0][1][i][j], t[2][i][j], p->y);
+		}
+	}
+}
+
+/**
+ * Computes the Miller loop of the optimal ate multi-pairing with precomputed
+ * lines, without the final exponentiation.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments in affine coordinates.
+ * @param[in] t				- the precomputed lines of the second arguments.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+static void pp_mil_pre_k24(fp24_t r, ep_t *p, fp4_t **t, int m) {
+	fp24_t l;
+	bn_t a;
+	int i, j, k, len;
+	int8_t s[RLC_FP_BITS + 1];
+
+	fp24_null(l);
+	bn_null(a);
+
+	RLC_TRY {
+		fp24_new(l);
+		bn_new(a);
+
+		fp_prime_get_par(a);
+		len = bn_bits(a) + 1;
+		bn_rec_naf(s, &len, a, 2);
+
+		fp24_zero(l);
+		fp24_zero(r);
+		pp_lin_k24(r, t[0], p[0]);
+		for (j = 1; j < m; j++) {
+			pp_lin_k24(l, t[j], p[j]);
+			fp24_mul_dxs(r, r, l);
+		}
+		k = 3;
+		if (s[len - 2] != 0) {
+			for (j = 0; j < m; j++) {
+				pp_lin_k24(l, t[j] + k, p[j]);
+				fp24_mul_dxs(r, r, l);
+			}
+			k += 3;
+		}
+
+		for (i = len - 3; i >= 0; i--) {
+			fp24_sqr(r, r);
+			for (j = 0; j < m; j++) {
+				pp_lin_k24(l, t[j] + k, p[j]);
+				fp24_mul_dxs(r, r, l);
+				if (s[i] != 0) {
+					pp_lin_k24(l, t[j] + k + 3, p[j]);
+					fp24_mul_dxs(r, r, l);
+				}
+			}
+			k += (s[i] != 0 ? 6 : 3);
+		}
+
+		if (bn_sign(a) == RLC_NEG) {
+			fp24_inv_cyc(r, r);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp24_free(l);
+		bn_free(a);
+	}
+}
+
+/**
+ * Tests if a table of precomputed lines corresponds to the point at infinity.
+ *
+ * @param[in] t				- the precomputed lines.
+ * @return 1 if the table represents the point at infinity, 0 otherwise.
+ */
+static int pp_pre_is_infty_k24(fp4_t *t) {
+	return fp4_is_zero(t[0]) && fp4_is_zero(t[1]) && fp4_is_zero(t[2]);
+}
+
+#endif
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -187,23 +454,18 @@ void pp_map_k24(fp24_t r, ep_t p, ep4_t q) {
 
 void pp_map_sim_k24(fp24_t r, ep_t *p, ep4_t *q, int m) {
 	ep_t *_p = RLC_ALLOCA(ep_t, m);
-	ep4_t *t = RLC_ALLOCA(ep4_t, m), *_q = RLC_ALLOCA(ep4_t, m);
-	bn_t a;
+	ep4_t *_q = RLC_ALLOCA(ep4_t, m);
 	int i, j;
 
 	RLC_TRY {
-		bn_null(a);
-		bn_new(a);
-		if (_p == NULL || _q == NULL || t == NULL) {
+		if (_p == NULL || _q == NULL) {
 			RLC_THROW(ERR_NO_MEMORY);
 		}
 		for (i = 0; i < m; i++) {
 			ep_null(_p[i]);
 			ep4_null(_q[i]);
-			ep4_null(t[i]);
 			ep_new(_p[i]);
 			ep4_new(_q[i]);
-			ep4_new(t[i]);
 		}
 
 		j = 0;
@@ -214,35 +476,178 @@ void pp_map_sim_k24(fp24_t r, ep_t *p, ep4_t *q, int m) {
 			}
 		}
 
-		fp_prime_get_par(a);
 		fp24_set_dig(r, 1);
-
 		if (j > 0) {
-			switch (ep_curve_is_pairf()) {
-				case EP_B24:
-					/* r = f_{|a|,Q}(P). */
-					pp_mil_k24(r, t, _q, _p, j, a);
-					if (bn_sign(a) == RLC_NEG) {
-						fp24_inv_cyc(r, r);
-					}
-					pp_exp_k24(r, r);
-					break;
-			}
+			pp_mil_par_k24(r, _p, _q, j);
+			pp_exp_k24(r, r);
 		}
 	}
 	RLC_CATCH_ANY {
 		RLC_THROW(ERR_CAUGHT);
 	}
 	RLC_FINALLY {
-		bn_free(a);
 		for (i = 0; i < m; i++) {
 			ep_free(_p[i]);
 			ep4_free(_q[i]);
-			ep4_free(t[i]);
 		}
 		RLC_FREE(_p);
 		RLC_FREE(_q);
-		RLC_FREE(t);
+	}
+}
+
+void pp_map_pre_k24(fp4_t *t, ep4_t q) {
+	fp24_t l;
+	ep_t u, v;
+	ep4_t _q, r, n;
+	bn_t a;
+	int i, k, len;
+	int8_t s[RLC_FP_BITS + 1];
+
+	fp24_null(l);
+	ep_null(u);
+	ep_null(v);
+	ep4_null(_q);
+	ep4_null(r);
+	ep4_null(n);
+	bn_null(a);
+
+	RLC_TRY {
+		fp24_new(l);
+		ep_new(u);
+		ep_new(v);
+		ep4_new(_q);
+		ep4_new(r);
+		ep4_new(n);
+		bn_new(a);
+
+		ep4_norm(_q, q);
+		if (ep4_is_infty(_q)) {
+			/* Mark the point at infinity with a null first line. */
+			for (i = 0; i < 3; i++) {
+				fp4_zero(t[i]);
+			}
+		} else {
+			fp_prime_get_par(a);
+			len = bn_bits(a) + 1;
+			if (len > RLC_PP_LOOP(24)) {
+				RLC_THROW(ERR_NO_BUFFER);
+			}
+			bn_rec_naf(s, &len, a, 2);
+
+			/* Evaluate lines at points with coordinates (x, y) such that the
+			 * lines become linear functions of the coordinates of P. */
+#if EP_ADD == BASIC
+			fp_set_dig(u->x, 1);
+#else
+			fp_set_dig(u->x, 3);
+#endif
+			fp_set_dig(u->y, 1);
+			fp_neg(u->y, u->y);
+			fp_set_dig(u->z, 1);
+			u->coord = BASIC;
+			fp_set_dig(v->x, 1);
+			fp_set_dig(v->y, 1);
+			fp_set_dig(v->z, 1);
+			v->coord = BASIC;
+
+			fp24_zero(l);
+			ep4_copy(r, _q);
+			ep4_neg(n, _q);
+			pp_dbl_k24(l, r, r, u);
+			pp_lin_pre_k24(t, l);
+			k = 3;
+			if (s[len - 2] != 0) {
+				pp_add_k24(l, r, (s[len - 2] > 0 ? _q : n), v);
+				pp_lin_pre_k24(t + k, l);
+				k += 3;
+			}
+			for (i = len - 3; i >= 0; i--) {
+				pp_dbl_k24(l, r, r, u);
+				pp_lin_pre_k24(t + k, l);
+				k += 3;
+				if (s[i] != 0) {
+					pp_add_k24(l, r, (s[i] > 0 ? _q : n), v);
+					pp_lin_pre_k24(t + k, l);
+					k += 3;
+				}
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp24_free(l);
+		ep_free(u);
+		ep_free(v);
+		ep4_free(_q);
+		ep4_free(r);
+		ep4_free(n);
+		bn_free(a);
+	}
+}
+
+void pp_map_k24_pre(fp24_t r, ep_t p, fp4_t *t) {
+	ep_t _p[1];
+
+	ep_null(_p[0]);
+
+	RLC_TRY {
+		ep_new(_p[0]);
+
+		ep_norm(_p[0], p);
+
+		fp24_set_dig(r, 1);
+		if (!ep_is_infty(_p[0]) && !pp_pre_is_infty_k24(t)) {
+			pp_mil_pre_k24(r, _p, &t, 1);
+			pp_exp_k24(r, r);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ep_free(_p[0]);
+	}
+}
+
+void pp_map_sim_k24_pre(fp24_t r, ep_t *p, fp4_t **t, int m) {
+	ep_t *_p = RLC_ALLOCA(ep_t, m);
+	fp4_t **_t = RLC_ALLOCA(fp4_t *, m);
+	int i, j;
+
+	RLC_TRY {
+		if (_p == NULL || _t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < m; i++) {
+			ep_null(_p[i]);
+			ep_new(_p[i]);
+		}
+
+		j = 0;
+		for (i = 0; i < m; i++) {
+			if (!ep_is_infty(p[i]) && !pp_pre_is_infty_k24(t[i])) {
+				ep_norm(_p[j], p[i]);
+				_t[j++] = t[i];
+			}
+		}
+
+		fp24_set_dig(r, 1);
+		if (j > 0) {
+			pp_mil_pre_k24(r, _p, _t, j);
+			pp_exp_k24(r, r);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < m; i++) {
+			ep_free(_p[i]);
+		}
+		RLC_FREE(_p);
+		RLC_FREE(_t);
 	}
 }
 
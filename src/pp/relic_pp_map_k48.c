@@ -98,6 +98,82 @@ static void pp_mil_k48(fp48_t r, fp8_t qx, fp8_t qy, ep_t p, bn_t a) {
 	}
 }
 
+/**
+ * Evaluates a precomputed line at a point in G_1, such that the line is
+ * t[0] + t[1] * x_P + t[2] * y_P.
+ *
+ * @param[out] l			- the sparse line.
+ * @param[in] t				- the three line coefficients.
+ * @param[in] p				- the point in affine coordinates.
+ */
+static void pp_lin_k48(fp48_t l, fp8_t *t, ep_t p) {
+	int i, j, k;
+
+	fp8_copy(l[0][0], t[0]);
+	for (i = 0; i < 2; i++) {
+		for (j = 0; j < 2; j++) {
+			for (k = 0; k < 2; k++) {
+				fp_mul(l[0][1][i][j][k], t[1][i][j][k], p->x);
+				fp_mul(l[1][1][i][j][k], t[2][i][j][k], p->y);
+			}
+		}
+	}
+}
+
+/**
+ * Computes the Miller loop of the optimal ate multi-pairing with precomputed
+ * lines, without the final exponentiation.
+ *
+ * @param[in,out] r			- the result.
+ * @param[in] p				- the first pairing arguments in affine coordinates.
+ * @param[in] t				- the precomputed lines of the second arguments.
+ * @param[in] m 			- the number of pairings to evaluate.
+ * @param[in] a				- the loop parameter.
+ */
+static void pp_mil_pre_k48(fp48_t r, ep_t *p, fp8_t **t, int m, bn_t a) {
+	fp48_t l;
+	int i, j, k, len = bn_bits(a) + 1;
+	int8_t s[RLC_FP_BITS + 1];
+
+	fp48_null(l);
+
+	RLC_TRY {
+		fp48_new(l);
+
+		fp48_zero(l);
+		bn_rec_naf(s, &len, a, 2);
+		k = 0;
+		for (i = len - 2; i >= 0; i--) {
+			fp48_sqr(r, r);
+			for (j = 0; j < m; j++) {
+				pp_lin_k48(l, t[j] + k, p[j]);
+				fp48_mul_dxs(r, r, l);
+				if (s[i] != 0) {
+					pp_lin_k48(l, t[j] + k + 3, p[j]);
+					fp48_mul_dxs(r, r, l);
+				}
+			}
+			k += (s[i] != 0 ? 6 : 3);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp48_free(l);
+	}
+}
+
+/**
+ * Tests if a table of precomputed lines corresponds to the point at infinity.
+ *
+ * @param[in] t				- the precomputed lines.
+ * @return 1 if the table represents the point at infinity, 0 otherwise.
+ */
+static int pp_pre_is_infty_k48(fp8_t *t) {
+	return fp8_is_zero(t[0]) && fp8_is_zero(t[1]) && fp8_is_zero(t[2]);
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -133,3 +209,187 @@ void pp_map_k48(fp48_t r, ep_t p, fp8_t qx, fp8_t qy) {
 		bn_free(a);
 	}
 }
+
+void pp_map_pre_k48(fp8_t *t, fp8_t qx, fp8_t qy) {
+	fp48_t l;
+	ep_t u, v;
+	fp8_t rx, ry, rz, ny;
+	bn_t a;
+	int i, k, len;
+	int8_t s[RLC_FP_BITS + 1];
+
+	fp48_null(l);
+	ep_null(u);
+	ep_null(v);
+	fp8_null(rx);
+	fp8_null(ry);
+	fp8_null(rz);
+	fp8_null(ny);
+	bn_null(a);
+
+	RLC_TRY {
+		fp48_new(l);
+		ep_new(u);
+		ep_new(v);
+		fp8_new(rx);
+		fp8_new(ry);
+		fp8_new(rz);
+		fp8_new(ny);
+		bn_new(a);
+
+		if (fp8_is_zero(qx) && fp8_is_zero(qy)) {
+			/* Mark the point at infinity with a null first line. */
+			for (i = 0; i < 3; i++) {
+				fp8_zero(t[i]);
+			}
+		} else {
+			fp_prime_get_par(a);
+			len = bn_bits(a) + 1;
+			if (len > RLC_PP_LOOP(48)) {
+				RLC_THROW(ERR_NO_BUFFER);
+			}
+			bn_rec_naf(s, &len, a, 2);
+
+			/* Evaluate lines at points with coordinates (x, y) such that the
+			 * lines become linear functions of the coordinates of P. */
+#if EP_ADD == BASIC
+			fp_set_dig(u->x, 1);
+#else
+			fp_set_dig(u->x, 3);
+#endif
+			fp_set_dig(u->y, 1);
+			fp_neg(u->y, u->y);
+			fp_set_dig(u->z, 1);
+			u->coord = BASIC;
+			fp_set_dig(v->x, 1);
+			fp_set_dig(v->y, 1);
+			fp_set_dig(v->z, 1);
+			v->coord = BASIC;
+
+			fp48_zero(l);
+			fp8_copy(rx, qx);
+			fp8_copy(ry, qy);
+			fp8_set_dig(rz, 1);
+			fp8_neg(ny, qy);
+			k = 0;
+			for (i = len - 2; i >= 0; i--) {
+				pp_dbl_k48(l, rx, ry, rz, u);
+				fp8_copy(t[k], l[0][0]);
+				fp8_copy(t[k + 1], l[0][1]);
+				fp8_copy(t[k + 2], l[1][1]);
+				k += 3;
+				if (s[i] != 0) {
+					pp_add_k48(l, rx, ry, rz, qx, (s[i] > 0 ? qy : ny), v);
+					fp8_copy(t[k], l[0][0]);
+					fp8_copy(t[k + 1], l[0][1]);
+					fp8_copy(t[k + 2], l[1][1]);
+					k += 3;
+				}
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp48_free(l);
+		ep_free(u);
+		ep_free(v);
+		fp8_free(rx);
+		fp8_free(ry);
+		fp8_free(rz);
+		fp8_free(ny);
+		bn_free(a);
+	}
+}
+
+void pp_map_k48_pre(fp48_t r, ep_t p, fp8_t *t) {
+	ep_t _p[1];
+	bn_t a;
+
+	ep_null(_p[0]);
+	bn_null(a);
+
+	RLC_TRY {
+		ep_new(_p[0]);
+		bn_new(a);
+
+		fp_prime_get_par(a);
+		ep_norm(_p[0], p);
+		fp48_set_dig(r, 1);
+
+		if (!ep_is_infty(_p[0]) && !pp_pre_is_infty_k48(t)) {
+			switch (ep_curve_is_pairf()) {
+				case EP_B48:
+					/* r = f_{|a|,Q}(P). */
+					pp_mil_pre_k48(r, _p, &t, 1, a);
+					if (bn_sign(a) == RLC_NEG) {
+						fp48_inv_cyc(r, r);
+					}
+					pp_exp_k48(r, r);
+					break;
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ep_free(_p[0]);
+		bn_free(a);
+	}
+}
+
+void pp_map_sim_k48_pre(fp48_t r, ep_t *p, fp8_t **t, int m) {
+	ep_t *_p = RLC_ALLOCA(ep_t, m);
+	fp8_t **_t = RLC_ALLOCA(fp8_t *, m);
+	bn_t a;
+	int i, j;
+
+	bn_null(a);
+
+	RLC_TRY {
+		bn_new(a);
+		if (_p == NULL || _t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < m; i++) {
+			ep_null(_p[i]);
+			ep_new(_p[i]);
+		}
+
+		j = 0;
+		for (i = 0; i < m; i++) {
+			if (!ep_is_infty(p[i]) && !pp_pre_is_infty_k48(t[i])) {
+				ep_norm(_p[j], p[i]);
+				_t[j++] = t[i];
+			}
+		}
+
+		fp_prime_get_par(a);
+		fp48_set_dig(r, 1);
+		if (j > 0) {
+			switch (ep_curve_is_pairf()) {
+				case EP_B48:
+					/* r = \Prod_i f_{|a|,Q_i}(P_i). */
+					pp_mil_pre_k48(r, _p, _t, j, a);
+					if (bn_sign(a) == RLC_NEG) {
+						fp48_inv_cyc(r, r);
+					}
+					pp_exp_k48(r, r);
+					break;
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; _p != NULL && i < m; i++) {
+			ep_free(_p[i]);
+		}
+		bn_free(a);
+		RLC_FREE(_p);
+		RLC_FREE(_t);
+	}
+}
@@ -74,7 +74,7 @@ static void rand_stub(uint8_t *buf, int size, void *args) {
 #if RAND == CALL
 
 void rand_bytes(uint8_t *buf, int size) {
-	ctx_t *ctx = core_get();
+	ctx_t *ctx = core_state();
 
 	ctx->rand_call(buf, size, ctx->rand_args);
 	if (rand_check(buf, size) == RLC_ERR) {
@@ -83,7 +83,7 @@ void rand_bytes(uint8_t *buf, int size) {
 }
 
 void rand_seed(void (*callback)(uint8_t *, int, void *), void *args) {
-	ctx_t *ctx = core_get();
+	ctx_t *ctx = core_state();
 
 	if (callback == NULL) {
 		ctx->rand_call = rand_stub;
@@ -92,7 +92,7 @@ void rand_seed(void (*callback)(uint8_t *, int, void *), void *args) {
 		ctx->rand_call = callback;
 		ctx->rand_args = args;
 	}
-	core_get()->seeded = 1;
+	core_state()->seeded = 1;
 }
 
 #endif
@@ -86,7 +86,7 @@ void rand_init(void) {
 	uint8_t buf[RLC_RAND_SEED];
 
 #if RAND == UDEV
-	int *fd = (int *)&(core_get()->rand);
+	int *fd = (int *)&(core_state()->rand);
 
 	*fd = open(RLC_RAND_PATH, O_RDONLY);
 	if (*fd == -1) {
@@ -176,7 +176,7 @@ void rand_init(void) {
 #endif /* RAND == UDEV */
 
 #if RAND != CALL
-	core_get()->seeded = 0;
+	core_state()->seeded = 0;
 	rand_seed(buf, RLC_RAND_SEED);
 #else
 	rand_seed(NULL, NULL);
@@ -201,7 +201,7 @@ int rand_check(uint8_t *buf, int size) {
 }
 
 void rand_clean(void) {
-	ctx_t *ctx = core_get();
+	ctx_t *ctx = core_state();
 	if (ctx != NULL) {
 #if RAND == UDEV
 		int *fd = (int *)&(ctx->rand);
@@ -126,7 +126,7 @@ static int rand_add(uint8_t *state, uint8_t *hash, int size) {
 static void rand_gen(uint8_t *out, int out_len) {
 	int m = RLC_CEIL(out_len, RLC_MD_LEN);
 	uint8_t hash[RLC_MD_LEN], data[(RLC_RAND_SIZE - 1)/2];
-	ctx_t *ctx = core_get();
+	ctx_t *ctx = core_state();
 
 	/* data = V */
 	memcpy(data, ctx->rand + 1, (RLC_RAND_SIZE - 1)/2);
@@ -153,7 +153,7 @@ static void rand_gen(uint8_t *out, int out_len) {
 void rand_bytes(uint8_t *buf, int size) {
 	uint8_t hash[RLC_MD_LEN];
 	int carry, len  = (RLC_RAND_SIZE - 1)/2;
-	ctx_t *ctx = core_get();
+	ctx_t *ctx = core_state();
 
 	if (sizeof(int) > 2 && size > (1 << 16)) {
 		RLC_THROW(ERR_NO_VALID);
@@ -174,7 +174,7 @@ void rand_bytes(uint8_t *buf, int size) {
 }
 
 void rand_seed(uint8_t *buf, int size) {
-	ctx_t *ctx = core_get();
+	ctx_t *ctx = core_state();
 	int len = (RLC_RAND_SIZE - 1) / 2;
 
 	if (size <= 0) {
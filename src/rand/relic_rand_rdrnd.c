@@ -60,7 +60,7 @@ void rand_bytes(uint8_t *buf, int size) {
 
 void rand_seed(uint8_t *buf, int size) {
 	/* Do nothing, mark as seeded. */
-	core_get()->seeded = 1;
+	core_state()->seeded = 1;
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,580 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2023 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the memory pools used for dynamic allocation.
+ *
+ * @ingroup relic
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "relic_core.h"
+#include "relic_multi.h"
+#include "relic_alloc.h"
+
+#if MULTI
+#include <stdatomic.h>
+#endif
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Size in bytes of the chunks obtained from the system allocator.
+ */
+#define CHUNK		(64 * 1024)
+
+/**
+ * Size in bytes of the header preceding each block, preserving alignment.
+ */
+#define HEAD		16
+
+/**
+ * Maximum number of nested allocation scopes.
+ */
+#define DEPTH		16
+
+/**
+ * Number of size classes served by the memory pool.
+ */
+#define CLASSES		16
+
+/**
+ * Size class of the blocks served directly by the system allocator.
+ */
+#define LARGE		CLASSES
+
+/**
+ * Block sizes of each size class, in bytes.
+ */
+static const size_t sizes[CLASSES] = {
+	16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048, 3072,
+	4096
+};
+
+/**
+ * Represents a memory pool.
+ */
+struct _arena_st;
+
+/**
+ * Represents the header of a block.
+ */
+typedef union {
+	struct {
+		/** The pool owning the memory, or NULL if it came from the system. */
+		struct _arena_st *own;
+		/** The size class. */
+		uint32_t cls;
+		/** The tag of the scope where the block was carved, or zero. */
+		uint32_t tag;
+	} h;
+	/** Padding to preserve the alignment of the block. */
+	uint8_t pad[HEAD];
+} head_t;
+
+/**
+ * Represents a chunk of memory obtained from the system allocator.
+ */
+typedef struct _chunk_st {
+	/** The next chunk in the arena. */
+	struct _chunk_st *next;
+	/** The first usable byte, aligned to 16 bytes. */
+	uint8_t *data;
+	/** The number of usable bytes. */
+	size_t size;
+} chunk_t;
+
+/**
+ * Represents the memory pool of a thread.
+ */
+typedef struct _arena_st {
+	/** The free lists of blocks outside scopes, one for each size class. */
+	void *list[CLASSES];
+	/** The free lists of blocks carved in open scopes. */
+	void *scope[CLASSES];
+	/** The first chunk of the arena. */
+	chunk_t *first;
+	/** The chunk where blocks are being carved. */
+	chunk_t *cur;
+	/** The number of bytes already carved from the current chunk. */
+	size_t used;
+	/** The positions in the arena saved by each open scope. */
+	chunk_t *mcur[DEPTH];
+	/** The offsets in the arena saved by each open scope. */
+	size_t mused[DEPTH];
+	/** The tags of the open scopes, in increasing order. */
+	uint32_t mtag[DEPTH];
+	/** The last tag given to a scope. */
+	uint32_t tags;
+	/** The number of open scopes. */
+	uint32_t depth;
+	/** The number of times the pool was initialized in this thread. */
+	int refs;
+#if MULTI
+	/** The blocks freed by other threads, waiting to be recycled. */
+	_Atomic(void *) remote;
+	/** The number of blocks outside the scopes in use, plus one while the
+	 * owner thread is alive. */
+	atomic_size_t live;
+#else
+	/** The blocks freed after the pool was finalized. */
+	void *remote;
+	/** The number of blocks outside the scopes in use, plus one while the
+	 * pool is initialized. */
+	size_t live;
+#endif
+	/** The number of allocation requests. */
+	size_t calls;
+	/** The number of bytes requested. */
+	size_t bytes;
+	/** The number of requests to the system allocator. */
+	size_t sys;
+} arena_t;
+
+/**
+ * System allocator backing the memory pools.
+ */
+static alloc_t alloc_sys = { malloc, realloc, free };
+
+/**
+ * Memory pool of the current thread, or NULL if the library was not
+ * initialized in this thread.
+ */
+#if MULTI
+static rlc_thread arena_t *core_arena = NULL;
+#if MULTI == OPENMP && !defined(_MSC_VER)
+#pragma omp threadprivate(core_arena)
+#endif
+#else
+static arena_t *core_arena = NULL;
+#endif
+
+/**
+ * Returns the size class fitting a number of bytes.
+ *
+ * @param[in] size			- the number of bytes.
+ * @return the size class, or LARGE if the block is too big for the pool.
+ */
+static uint32_t alloc_class(size_t size) {
+	uint32_t c;
+
+	for (c = 0; c < CLASSES; c++) {
+		if (size <= sizes[c]) {
+			return c;
+		}
+	}
+	return LARGE;
+}
+
+/**
+ * Changes the number of blocks in use of a memory pool. The counter may be
+ * updated by any thread.
+ *
+ * @param[in,out] a			- the memory pool.
+ * @param[in] add			- the flag to increment instead of decrement.
+ * @return the new number of blocks.
+ */
+static size_t alloc_live(arena_t *a, int add) {
+#if MULTI
+	if (add) {
+		return atomic_fetch_add_explicit(&a->live, 1, memory_order_relaxed) + 1;
+	}
+	return atomic_fetch_sub_explicit(&a->live, 1, memory_order_acq_rel) - 1;
+#else
+	return (add ? ++a->live : --a->live);
+#endif
+}
+
+/**
+ * Returns a block to the memory pool owning it, from any thread.
+ *
+ * @param[in,out] a			- the memory pool owning the block.
+ * @param[in] ptr			- the block.
+ */
+static void alloc_give(arena_t *a, void *ptr) {
+#if MULTI
+	void *top = atomic_load_explicit(&a->remote, memory_order_relaxed);
+
+	do {
+		*(void **)ptr = top;
+	} while (!atomic_compare_exchange_weak_explicit(&a->remote, &top, ptr,
+			memory_order_release, memory_order_relaxed));
+#else
+	*(void **)ptr = a->remote;
+	a->remote = ptr;
+#endif
+}
+
+/**
+ * Moves the blocks returned by other threads to the free lists of a memory
+ * pool. Must be called by the owner thread.
+ *
+ * @param[in,out] a			- the memory pool.
+ */
+static void alloc_take(arena_t *a) {
+	void *ptr, *next;
+	head_t *h;
+
+#if MULTI
+	ptr = atomic_exchange_explicit(&a->remote, NULL, memory_order_acquire);
+#else
+	ptr = a->remote;
+	a->remote = NULL;
+#endif
+	for (; ptr != NULL; ptr = next) {
+		next = *(void **)ptr;
+		h = (head_t *)ptr - 1;
+		*(void **)ptr = a->list[h->h.cls];
+		a->list[h->h.cls] = ptr;
+	}
+}
+
+/**
+ * Returns all the memory of a pool to the system allocator.
+ *
+ * @param[in] a				- the memory pool.
+ */
+static void alloc_drop(arena_t *a) {
+	chunk_t *k;
+
+	while (a->first != NULL) {
+		k = a->first;
+		a->first = k->next;
+		alloc_sys.put(k);
+	}
+	alloc_sys.put(a);
+}
+
+/**
+ * Checks if the scope where a block was carved is still open.
+ *
+ * @param[in] a				- the memory pool.
+ * @param[in] tag			- the tag of the block.
+ * @return 1 if the scope is open, 0 otherwise.
+ */
+static int alloc_open(const arena_t *a, uint32_t tag) {
+	for (uint32_t i = 0; i < a->depth; i++) {
+		if (a->mtag[i] == tag) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/**
+ * Carves a new block from the arena of a memory pool, moving to the next chunk
+ * when the current one is exhausted.
+ *
+ * @param[in,out] a			- the memory pool.
+ * @param[in] c				- the size class.
+ * @return the header of the block, or NULL if no memory is available.
+ */
+static head_t *alloc_carve(arena_t *a, uint32_t c) {
+	size_t need = HEAD + sizes[c];
+	chunk_t *k;
+	head_t *h;
+
+	while (a->cur == NULL || a->used + need > a->cur->size) {
+		/* Chunks after the current one only hold released blocks. */
+		k = (a->cur == NULL ? a->first : a->cur->next);
+		if (k == NULL) {
+			k = (chunk_t *)alloc_sys.get(CHUNK);
+			if (k == NULL) {
+				return NULL;
+			}
+			a->sys++;
+			k->next = NULL;
+			k->data = (uint8_t *)k + sizeof(chunk_t);
+			k->data += (HEAD - ((uintptr_t)k->data & (HEAD - 1))) & (HEAD - 1);
+			k->size = (CHUNK - (k->data - (uint8_t *)k)) & ~(size_t)(HEAD - 1);
+			if (a->cur == NULL) {
+				a->first = k;
+			} else {
+				a->cur->next = k;
+			}
+		}
+		a->cur = k;
+		a->used = 0;
+	}
+
+	h = (head_t *)(a->cur->data + a->used);
+	a->used += need;
+	h->h.own = a;
+	h->h.cls = c;
+	h->h.tag = (a->depth == 0 ? 0 : a->mtag[a->depth - 1]);
+	return h;
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void alloc_set(const alloc_t *sys) {
+	if (sys == NULL) {
+		alloc_sys.get = malloc;
+		alloc_sys.resize = realloc;
+		alloc_sys.put = free;
+	} else {
+		alloc_sys = *sys;
+	}
+}
+
+void alloc_init(void) {
+	arena_t *a;
+
+	if (core_arena != NULL) {
+		core_arena->refs++;
+		return;
+	}
+	/* Without a pool, requests go straight to the system allocator. */
+	a = (arena_t *)alloc_sys.get(sizeof(arena_t));
+	if (a != NULL) {
+		memset(a, 0, sizeof(arena_t));
+		a->refs = 1;
+#if MULTI
+		atomic_init(&a->remote, NULL);
+		atomic_init(&a->live, 1);
+#else
+		a->live = 1;
+#endif
+		core_arena = a;
+	}
+}
+
+void alloc_clean(void) {
+	arena_t *a = core_arena;
+
+	if (a == NULL || --a->refs > 0) {
+		return;
+	}
+	core_arena = NULL;
+
+	/* Blocks still in use keep the chunks alive until the last is freed. */
+	/* Scopes left open are unwound, their blocks die with the pool. */
+	a->depth = 0;
+	if (alloc_live(a, 0) == 0) {
+		alloc_drop(a);
+	}
+}
+
+void *alloc_malloc(size_t size) {
+	arena_t *a = core_arena;
+	uint32_t c = alloc_class(size);
+	void **p;
+	head_t *h;
+
+	if (a != NULL) {
+		a->calls++;
+		a->bytes += size;
+	}
+
+	if (a == NULL || c == LARGE) {
+		if (size > SIZE_MAX - HEAD) {
+			return NULL;
+		}
+		h = (head_t *)alloc_sys.get(HEAD + size);
+		if (h == NULL) {
+			return NULL;
+		}
+		if (a != NULL) {
+			a->sys++;
+		}
+		h->h.own = NULL;
+		h->h.cls = LARGE;
+		h->h.tag = 0;
+		return h + 1;
+	}
+
+	/* Inside a scope, only recycle blocks that a release will reclaim. */
+	p = (a->depth == 0 ? &a->list[c] : &a->scope[c]);
+	if (*p == NULL && a->depth == 0) {
+		alloc_take(a);
+	}
+	if (*p != NULL) {
+		h = (head_t *)(*p) - 1;
+		*p = *(void **)(*p);
+	} else {
+		h = alloc_carve(a, c);
+		if (h == NULL) {
+			return NULL;
+		}
+	}
+	if (h->h.tag == 0) {
+		alloc_live(a, 1);
+	}
+	return h + 1;
+}
+
+void *alloc_calloc(size_t n, size_t size) {
+	void *ptr;
+
+	if (size != 0 && n > SIZE_MAX / size) {
+		return NULL;
+	}
+	ptr = alloc_malloc(n * size);
+	if (ptr != NULL) {
+		memset(ptr, 0, n * size);
+	}
+	return ptr;
+}
+
+void *alloc_realloc(void *ptr, size_t size) {
+	arena_t *a = core_arena;
+	head_t *h;
+	void *t;
+
+	if (ptr == NULL) {
+		return alloc_malloc(size);
+	}
+
+	h = (head_t *)ptr - 1;
+	if (h->h.cls == LARGE) {
+		if (size > SIZE_MAX - HEAD) {
+			return NULL;
+		}
+		h = (head_t *)alloc_sys.resize(h, HEAD + size);
+		if (h == NULL) {
+			return NULL;
+		}
+		if (a != NULL) {
+			a->calls++;
+			a->bytes += size;
+			a->sys++;
+		}
+		return h + 1;
+	}
+
+	if (size <= sizes[h->h.cls]) {
+		return ptr;
+	}
+	t = alloc_malloc(size);
+	if (t != NULL) {
+		memcpy(t, ptr, sizes[h->h.cls]);
+		alloc_free(ptr);
+	}
+	return t;
+}
+
+void alloc_free(void *ptr) {
+	arena_t *a = core_arena;
+	head_t *h;
+
+	if (ptr == NULL) {
+		return;
+	}
+
+	h = (head_t *)ptr - 1;
+	if (h->h.cls == LARGE) {
+		alloc_sys.put(h);
+		return;
+	}
+
+	if (h->h.tag != 0) {
+		/* Scoped blocks of other threads are reclaimed by their owner. */
+		if (h->h.own != a) {
+			return;
+		}
+		if (!alloc_open(a, h->h.tag)) {
+			/* The block lies in a region already rewound by a release. */
+#ifdef CHECK
+			RLC_THROW(ERR_NO_VALID);
+#endif
+			return;
+		}
+		*(void **)ptr = a->scope[h->h.cls];
+		a->scope[h->h.cls] = ptr;
+	} else if (h->h.own != a) {
+		/* Return the block to its owner, which may be already finalized. */
+		a = h->h.own;
+		alloc_give(a, ptr);
+		if (alloc_live(a, 0) == 0) {
+			alloc_drop(a);
+		}
+	} else {
+		alloc_live(a, 0);
+		*(void **)ptr = a->list[h->h.cls];
+		a->list[h->h.cls] = ptr;
+	}
+}
+
+int alloc_mark(void) {
+	arena_t *a = core_arena;
+
+	if (a == NULL) {
+		return 0;
+	}
+	if (a->depth == DEPTH) {
+		RLC_THROW(ERR_NO_BUFFER);
+		return 0;
+	}
+	/* Restart the tags while no scope is open, before they wrap around. */
+	if (a->depth == 0 && a->tags > UINT32_MAX - DEPTH) {
+		a->tags = 0;
+	}
+	a->mcur[a->depth] = a->cur;
+	a->mused[a->depth] = a->used;
+	a->mtag[a->depth] = ++a->tags;
+	return ++a->depth;
+}
+
+void alloc_release(int mark) {
+	arena_t *a = core_arena;
+	void **p;
+	head_t *h;
+
+	if (a == NULL || mark < 1 || (uint32_t)mark > a->depth) {
+		return;
+	}
+
+	a->cur = a->mcur[mark - 1];
+	a->used = a->mused[mark - 1];
+	a->depth = mark - 1;
+
+	/* Drop the free blocks lying in the released part of the arena. */
+	for (int c = 0; c < CLASSES; c++) {
+		p = &a->scope[c];
+		while (*p != NULL) {
+			h = (head_t *)(*p) - 1;
+			if (h->h.tag >= a->mtag[mark - 1]) {
+				*p = *(void **)(*p);
+			} else {
+				p = (void **)(*p);
+			}
+		}
+	}
+}
+
+void alloc_stats(size_t *calls, size_t *bytes, size_t *sys) {
+	arena_t *a = core_arena;
+
+	*calls = (a == NULL ? 0 : a->calls);
+	*bytes = (a == NULL ? 0 : a->bytes);
+	*sys = (a == NULL ? 0 : a->sys);
+}
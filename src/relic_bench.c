@@ -81,7 +81,7 @@ static void empty(int *a) {
 #if defined(OVERH) && defined(TIMER) && BENCH > 1
 
 void bench_overhead(void) {
-	ctx_t *ctx = core_get();
+	ctx_t *ctx = core_state();
 	int a[BENCH + 1];
 	int *tmpa;
 
@@ -129,7 +129,7 @@ void bench_overhead(void) {
 #endif /* OVER && TIMER && BENCH > 1 */
 
 void bench_init(void) {
-	ctx_t *ctx = core_get();
+	ctx_t *ctx = core_state();
 	if (ctx != NULL) {
 #ifdef OVERH
 		ctx->over = 0;
@@ -154,30 +154,30 @@ void bench_init(void) {
 
 void bench_reset(void) {
 #ifdef TIMER
-	core_get()->total = 0;
+	core_state()->total = 0;
 #endif
 }
 
 void bench_before(void) {
 #if OPSYS == DUINO && TIMER == HREAL
-	core_get()->before = micros();
+	core_state()->before = micros();
 #elif TIMER == HREAL || TIMER == HPROC || TIMER == HTHRD
-	clock_gettime(CLOCK, &(core_get()->before));
+	clock_gettime(CLOCK, &(core_state()->before));
 #elif TIMER == ANSI
-	core_get()->before = clock();
+	core_state()->before = clock();
 #elif TIMER == POSIX
-	gettimeofday(&(core_get()->before), NULL);
+	gettimeofday(&(core_state()->before), NULL);
 #elif TIMER == CYCLE || TIMER == PERF
-	core_get()->before = arch_cycles();
+	core_state()->before = arch_cycles();
 #endif
 }
 
 void bench_after(void) {
-	ctx_t *ctx = core_get();
+	ctx_t *ctx = core_state();
 	long long result;
 
 #if OPSYS == DUINO && TIMER == HREAL
-	core_get()->after = micros();
+	core_state()->after = micros();
 	result = (ctx->after - ctx->before);
 #elif TIMER == HREAL || TIMER == HPROC || TIMER == HTHRD
 	clock_gettime(CLOCK, &(ctx->after));
@@ -204,7 +204,7 @@ void bench_after(void) {
 }
 
 void bench_compute(int benches) {
-	ctx_t *ctx = core_get();
+	ctx_t *ctx = core_state();
 #ifdef TIMER
 	ctx->total = ctx->total / benches;
 #ifdef OVERH
@@ -217,7 +217,7 @@ void bench_compute(int benches) {
 }
 
 void bench_print(void) {
-	ctx_t *ctx = core_get();
+	ctx_t *ctx = core_state();
 
 #if TIMER == POSIX || TIMER == ANSI || (OPSYS == DUINO && TIMER == HREAL)
 	util_print("%lld microsec", ctx->total);
@@ -234,12 +234,12 @@ void bench_print(void) {
 }
 
 ull_t bench_total(void) {
-	return core_get()->total;
+	return core_state()->total;
 }
 
 void bench_clean(void) {
 #if TIMER == PERF
-	ctx_t *ctx = core_get();
+	ctx_t *ctx = core_state();
 	if (ctx != NULL) {
 		close(ctx->perf_fd);
 		munmap(ctx->perf_buf, sysconf(_SC_PAGESIZE)),
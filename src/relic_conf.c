@@ -74,6 +74,8 @@ void conf_print(void) {
 	util_print("** Arithmetic backend: gmp\n\n");
 #elif ARITH == GMP_SEC
 	util_print("** Arithmetic backend: gmp-sec\n\n");
+#elif ARITH == X64_IFMA
+	util_print("** Arithmetic backend: x64-ifma\n\n");
 #else
 	util_print("** Arithmetic backend: " QUOTE(ARITH) "\n\n");
 #endif
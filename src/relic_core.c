@@ -31,6 +31,7 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <stdint.h>
 #include <string.h>
 
 #include "relic_core.h"
@@ -72,6 +73,74 @@
 /** Error message respective to ERR_NO_CURVE. */
 #define MSG_NO_RAND			"faulty pseudo-random number generator"
 
+#if MULTI == PTHREAD && CORES > 1
+
+/**
+ * Represents the pool of worker threads used by core_run().
+ */
+static struct {
+	/** The lock held by the caller using the pool. */
+	pthread_mutex_t busy;
+	/** The lock protecting the remaining fields. */
+	pthread_mutex_t lock;
+	/** The condition signaled when tasks are posted. */
+	pthread_cond_t post;
+	/** The condition signaled when the last task is done. */
+	pthread_cond_t done;
+	/** The number of workers started, with identifiers from 1. */
+	int size;
+	/** The flags of the workers with a pending task. */
+	int todo[CORES];
+	/** The number of pending tasks. */
+	int left;
+	/** The function to run. */
+	void (*fun)(void *, int);
+	/** The argument of the function. */
+	void *arg;
+	/** The parameters of the caller. */
+	ctx_t *par;
+	/** The error code of the tasks. */
+	int code;
+} core_pool = {
+	PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER,
+	PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER
+};
+
+/**
+ * Runs the tasks posted to a worker thread. Workers are initialized once and
+ * live as long as the process.
+ *
+ * @param[in] ptr			- the identifier of the worker.
+ * @return NULL.
+ */
+static void *core_work(void *ptr) {
+	int id = (int)(intptr_t)ptr, code = core_init();
+
+	pthread_mutex_lock(&core_pool.lock);
+	while (1) {
+		while (!core_pool.todo[id]) {
+			pthread_cond_wait(&core_pool.post, &core_pool.lock);
+		}
+		pthread_mutex_unlock(&core_pool.lock);
+		if (code == RLC_OK) {
+			core_par_set(core_pool.par);
+			core_pool.fun(core_pool.arg, id);
+			core_par_set(NULL);
+		}
+		pthread_mutex_lock(&core_pool.lock);
+		if (code != RLC_OK || err_get_code() != RLC_OK) {
+			core_pool.code = RLC_ERR;
+		}
+		core_pool.todo[id] = 0;
+		if (--core_pool.left == 0) {
+			pthread_cond_signal(&core_pool.done);
+		}
+	}
+	return NULL;
+}
+
+#endif
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -99,10 +168,24 @@ rlc_thread ctx_t *core_ctx = NULL;
 static ctx_t *core_ctx = NULL;
 #endif
 
+/**
+ * Parameter set active in the current thread, or NULL for its own context.
+ */
+#if MULTI
+rlc_thread ctx_t *core_par = NULL;
+#else
+static ctx_t *core_par = NULL;
+#endif
+
 int core_init(void) {
+#if ALLOC == DYNAMIC
+	alloc_init();
+#endif
+
 	if (core_ctx == NULL) {
 		core_ctx = &(first_ctx);
 	}
+	core_par = NULL;
 
 #ifdef CHECK
 	core_ctx->reason[ERR_NO_MEMORY] = MSG_NO_MEMORY;
@@ -157,6 +240,8 @@ int core_init(void) {
 }
 
 int core_clean(void) {
+	core_par = NULL;
+
 #ifdef WITH_FP
 	fp_prime_clean();
 #endif
@@ -186,6 +271,10 @@ int core_clean(void) {
 	arch_clean();
 	rand_clean();
 
+#if ALLOC == DYNAMIC
+	alloc_clean();
+#endif
+
 	if (core_ctx != NULL) {
 		int result = core_ctx->code;
 		core_ctx = NULL;
@@ -195,6 +284,13 @@ int core_clean(void) {
 }
 
 ctx_t *core_get(void) {
+	if (core_par != NULL) {
+		return core_par;
+	}
+	return core_state();
+}
+
+ctx_t *core_state(void) {
 #if defined(MULTI)
     if (core_ctx == NULL && core_thread_initializer != NULL) {
         core_thread_initializer(core_init_ptr);
@@ -207,6 +303,165 @@ void core_set(ctx_t *ctx) {
 	core_ctx = ctx;
 }
 
+ctx_t *core_par_new(void) {
+	ctx_t *old = core_par, *par = (ctx_t *)calloc(1, sizeof(ctx_t));
+
+	if (par == NULL) {
+		RLC_THROW(ERR_NO_MEMORY);
+		return NULL;
+	}
+
+	/* Initialization functions write into the active parameters. */
+	core_par = par;
+	RLC_TRY {
+#ifdef WITH_FP
+		fp_prime_init();
+#endif
+#ifdef WITH_FB
+		fb_poly_init();
+#endif
+#ifdef WITH_EP
+		ep_curve_init();
+#endif
+#ifdef WITH_EB
+		eb_curve_init();
+#endif
+#ifdef WITH_ED
+		ed_curve_init();
+#endif
+#ifdef WITH_PP
+		pp_map_init();
+#endif
+#ifdef WITH_PC
+		pc_core_init();
+#endif
+	} RLC_CATCH_ANY {
+		core_par = old;
+		free(par);
+		return NULL;
+	}
+	core_par = old;
+
+	return par;
+}
+
+void core_par_free(ctx_t *par) {
+	ctx_t *old = core_par;
+
+	if (par != NULL) {
+		core_par = par;
+#ifdef WITH_FP
+		fp_prime_clean();
+#endif
+#ifdef WITH_FB
+		fb_poly_clean();
+#endif
+#ifdef WITH_EP
+		ep_curve_clean();
+#endif
+#ifdef WITH_EB
+		eb_curve_clean();
+#endif
+#ifdef WITH_ED
+		ed_curve_clean();
+#endif
+#ifdef WITH_PP
+		pp_map_clean();
+#endif
+#ifdef WITH_PC
+		pc_core_clean();
+#endif
+		core_par = (old == par ? NULL : old);
+		free(par);
+	}
+}
+
+ctx_t *core_par_get(void) {
+	return core_par;
+}
+
+void core_par_set(ctx_t *par) {
+	core_par = par;
+}
+
+int core_run(void (*fun)(void *arg, int id), void *arg, int n) {
+	int i, code = RLC_OK;
+#if MULTI == OPENMP && CORES > 1
+	ctx_t *par = core_get(), *old;
+	int err = 0;
+
+	#pragma omp parallel for num_threads(n) schedule(static, 1) \
+			private(old) reduction(|:err)
+	for (i = 0; i < n; i++) {
+		/* Threads are kept by the runtime, so they are initialized once. */
+		if (core_state() == NULL && core_init() != RLC_OK) {
+			err = 1;
+			continue;
+		}
+		old = core_par_get();
+		core_par_set(par);
+		fun(arg, i);
+		core_par_set(old);
+		if (err_get_code() != RLC_OK) {
+			err = 1;
+		}
+	}
+	code = (err ? RLC_ERR : RLC_OK);
+#elif MULTI == PTHREAD && CORES > 1
+	pthread_t thread;
+	int m;
+
+	if (n < 2 || pthread_mutex_trylock(&core_pool.busy) != 0) {
+		/* Nested or concurrent calls run in the calling thread. */
+		for (i = 0; i < n; i++) {
+			fun(arg, i);
+		}
+		return RLC_OK;
+	}
+
+	while (core_pool.size < RLC_MIN(n, CORES) - 1) {
+		if (pthread_create(&thread, NULL, core_work,
+				(void *)(intptr_t)(core_pool.size + 1)) != 0) {
+			break;
+		}
+		pthread_detach(thread);
+		core_pool.size++;
+	}
+
+	m = RLC_MIN(n - 1, core_pool.size);
+	pthread_mutex_lock(&core_pool.lock);
+	core_pool.fun = fun;
+	core_pool.arg = arg;
+	core_pool.par = core_get();
+	core_pool.code = RLC_OK;
+	core_pool.left = m;
+	for (i = 1; i <= m; i++) {
+		core_pool.todo[i] = 1;
+	}
+	pthread_cond_broadcast(&core_pool.post);
+	pthread_mutex_unlock(&core_pool.lock);
+
+	fun(arg, 0);
+	/* Run the indices left without a worker. */
+	for (i = m + 1; i < n; i++) {
+		fun(arg, i);
+	}
+
+	pthread_mutex_lock(&core_pool.lock);
+	while (core_pool.left > 0) {
+		pthread_cond_wait(&core_pool.done, &core_pool.lock);
+	}
+	code = core_pool.code;
+	pthread_mutex_unlock(&core_pool.lock);
+	pthread_mutex_unlock(&core_pool.busy);
+#else
+	for (i = 0; i < n; i++) {
+		fun(arg, i);
+	}
+#endif
+	return code;
+}
+
 #if defined(MULTI)
 void core_set_thread_initializer(void(*init)(void *init_ptr), void* init_ptr) {
     core_thread_initializer = init;
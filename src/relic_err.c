@@ -50,7 +50,7 @@
 
 void err_simple_msg(int error) {
 	if (error != ERR_CAUGHT) {
-		fprintf(stderr, "\nERROR: %s.\n", core_get()->reason[error]);
+		fprintf(stderr, "\nERROR: %s.\n", core_state()->reason[error]);
 	}
 }
 
@@ -58,7 +58,7 @@ void err_simple_msg(int error) {
 
 void err_full_msg(const char *function, const char *file, int line,
 		int error) {
-	ctx_t *ctx = core_get();
+	ctx_t *ctx = core_state();
 
 	if (error == ERR_CAUGHT) {
 		fprintf(stderr, "\tCAUGHT in %s() at %s,%d.\n", function, file, line);
@@ -90,7 +90,7 @@ void err_full_msg(const char *function, const char *file, int line,
 #endif /* VERBS */
 
 void err_get_msg(err_t *e, char **msg) {
-	ctx_t *ctx = core_get();
+	ctx_t *ctx = core_state();
 	*e = *(ctx->last->error);
 	*msg = ctx->reason[*e];
 	ctx->last = NULL;
@@ -99,7 +99,7 @@ void err_get_msg(err_t *e, char **msg) {
 #endif /* CHECK */
 
 int err_get_code(void) {
-	ctx_t *ctx = core_get();
+	ctx_t *ctx = core_state();
 	int r = ctx->code;
 	ctx->code = RLC_OK;
 	return r;
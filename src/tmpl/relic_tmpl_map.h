@@ -322,3 +322,183 @@
 			PFX##_free(t4);													\
 		}																	\
 	}
+
+/**
+ * Simplified SWU mapping of several field elements at once, sharing a single
+ * inversion among all of them.
+ */
+#define TMPL_MAP_SSWU_SIM(CUR, PFX, PTR_TY, COPY_COND)						\
+	static void CUR##_map_sswu_sim(CUR##_t *p, PFX##_t *t, int n) {			\
+		PFX##_t t0, t1, t3, *t2 = RLC_ALLOCA(PFX##_t, n);					\
+		ctx_t *ctx = core_get();											\
+		PTR_TY *mBoverA = ctx->CUR##_map_c[0];								\
+		PTR_TY *a = ctx->CUR##_map_c[2];									\
+		PTR_TY *b = ctx->CUR##_map_c[3];									\
+		PTR_TY *u = ctx->CUR##_map_u;										\
+		int i, e1;															\
+																			\
+		PFX##_null(t0);														\
+		PFX##_null(t1);														\
+		PFX##_null(t3);														\
+																			\
+		RLC_TRY {															\
+			if (t2 == NULL) {												\
+				RLC_THROW(ERR_NO_MEMORY);									\
+			}																\
+			for (i = 0; i < n; i++) {										\
+				PFX##_null(t2[i]);											\
+				PFX##_new(t2[i]);											\
+			}																\
+			PFX##_new(t0);													\
+			PFX##_new(t1);													\
+			PFX##_new(t3);													\
+																			\
+			/* collect the denominators u^2 * t^4 + u * t^2, or -u */		\
+			for (i = 0; i < n; i++) {										\
+				PFX##_sqr(t0, t[i]);										\
+				PFX##_mul(t0, t0, u);										\
+				PFX##_sqr(t1, t0);											\
+				PFX##_add(t2[i], t1, t0);									\
+				e1 = PFX##_is_zero(t2[i]);									\
+				PFX##_neg(t3, u);											\
+				COPY_COND(t2[i], t3, e1);									\
+			}																\
+			PFX##_inv_sim(t2, t2, n);										\
+																			\
+			for (i = 0; i < n; i++) {										\
+				PFX##_sqr(t0, t[i]);										\
+				PFX##_mul(t0, t0, u);  /* t0 = u * t^2 */					\
+				PFX##_sqr(t1, t0);     /* t1 = u^2 * t^4 */					\
+				PFX##_add(t3, t1, t0);										\
+				e1 = PFX##_is_zero(t3);										\
+				PFX##_add_dig(t3, t2[i], 1);								\
+				COPY_COND(t2[i], t3, e1 == 0);								\
+																			\
+				/* compute x1, g(x1) */										\
+				PFX##_mul(p[i]->x, t2[i], mBoverA);							\
+				PFX##_sqr(p[i]->y, p[i]->x);								\
+				PFX##_add(p[i]->y, p[i]->y, a);								\
+				PFX##_mul(p[i]->y, p[i]->y, p[i]->x);						\
+				PFX##_add(p[i]->y, p[i]->y, b);								\
+																			\
+				/* compute x2, g(x2) */										\
+				PFX##_mul(t2[i], t0, p[i]->x);								\
+				PFX##_mul(t1, t0, t1);										\
+				PFX##_mul(t3, t1, p[i]->y);									\
+																			\
+				if (!PFX##_srt(p[i]->y, p[i]->y)) {							\
+					PFX##_copy(p[i]->x, t2[i]);								\
+					if (!PFX##_srt(p[i]->y, t3)) {							\
+						RLC_THROW(ERR_NO_VALID);							\
+					}														\
+				}															\
+				PFX##_set_dig(p[i]->z, 1);									\
+				p[i]->coord = BASIC;										\
+			}																\
+		}																	\
+		RLC_CATCH_ANY { RLC_THROW(ERR_CAUGHT); }							\
+		RLC_FINALLY {														\
+			for (i = 0; t2 != NULL && i < n; i++) {							\
+				PFX##_free(t2[i]);											\
+			}																\
+			PFX##_free(t0);													\
+			PFX##_free(t1);													\
+			PFX##_free(t3);													\
+			RLC_FREE(t2);													\
+		}																	\
+	}
+
+/**
+ * Shallue--van de Woestijne map of several field elements at once, sharing a
+ * single inversion among all of them.
+ */
+#define TMPL_MAP_SVDW_SIM(CUR, PFX, PTR_TY, COPY_COND)						\
+	static void CUR##_map_svdw_sim(CUR##_t *p, PFX##_t *t, int n) {			\
+		PFX##_t t1, t2, t4, *t3 = RLC_ALLOCA(PFX##_t, n);					\
+		ctx_t *ctx = core_get();											\
+		PTR_TY *gU = ctx->CUR##_map_c[0];									\
+		PTR_TY *mUover2 = ctx->CUR##_map_c[1];								\
+		PTR_TY *c3 = ctx->CUR##_map_c[2];									\
+		PTR_TY *c4 = ctx->CUR##_map_c[3];									\
+		PTR_TY *u = ctx->CUR##_map_u;										\
+		int i, e0;															\
+																			\
+		PFX##_null(t1);														\
+		PFX##_null(t2);														\
+		PFX##_null(t4);														\
+																			\
+		RLC_TRY {															\
+			if (t3 == NULL) {												\
+				RLC_THROW(ERR_NO_MEMORY);									\
+			}																\
+			for (i = 0; i < n; i++) {										\
+				PFX##_null(t3[i]);											\
+				PFX##_new(t3[i]);											\
+			}																\
+			PFX##_new(t1);													\
+			PFX##_new(t2);													\
+			PFX##_new(t4);													\
+																			\
+			/* collect (1 + t^2 * g(u)) * (1 - t^2 * g(u)), or g(u) */		\
+			for (i = 0; i < n; i++) {										\
+				PFX##_sqr(t1, t[i]);										\
+				PFX##_mul(t1, t1, gU);										\
+				PFX##_add_dig(t2, t1, 1);									\
+				PFX##_sub_dig(t1, t1, 1);									\
+				PFX##_neg(t1, t1);											\
+				PFX##_mul(t3[i], t1, t2);									\
+				e0 = PFX##_is_zero(t3[i]);									\
+				COPY_COND(t3[i], gU, e0);									\
+			}																\
+			PFX##_inv_sim(t3, t3, n);										\
+																			\
+			for (i = 0; i < n; i++) {										\
+				PFX##_sqr(t1, t[i]);										\
+				PFX##_mul(t1, t1, gU);										\
+				PFX##_add_dig(t2, t1, 1); /* 1 + t^2 * g(u) */				\
+				PFX##_sub_dig(t1, t1, 1);									\
+				PFX##_neg(t1, t1);        /* 1 - t^2 * g(u) */				\
+				PFX##_mul(t4, t1, t2);										\
+				e0 = PFX##_is_zero(t4);										\
+				PFX##_zero(t4);												\
+				COPY_COND(t3[i], t4, e0);									\
+																			\
+				PFX##_mul(t4, t[i], t1);									\
+				PFX##_mul(t4, t4, t3[i]);									\
+				PFX##_mul(t4, t4, c3);										\
+																			\
+				/* compute x1 and g(x1) */									\
+				PFX##_sub(p[i]->x, mUover2, t4);							\
+				CUR##_rhs(p[i]->y, p[i]);									\
+				if (!PFX##_srt(p[i]->y, p[i]->y)) {							\
+					/* compute x2 and g(x2) */								\
+					PFX##_add(p[i]->x, mUover2, t4);						\
+					CUR##_rhs(p[i]->y, p[i]);								\
+					if (!PFX##_srt(p[i]->y, p[i]->y)) {						\
+						/* compute x3 and g(x3) */							\
+						PFX##_sqr(p[i]->x, t2);								\
+						PFX##_mul(p[i]->x, p[i]->x, t3[i]);					\
+						PFX##_sqr(p[i]->x, p[i]->x);						\
+						PFX##_mul(p[i]->x, p[i]->x, c4);					\
+						PFX##_add(p[i]->x, p[i]->x, u);						\
+						CUR##_rhs(p[i]->y, p[i]);							\
+						if (!PFX##_srt(p[i]->y, p[i]->y)) {					\
+							RLC_THROW(ERR_NO_VALID);						\
+						}													\
+					}														\
+				}															\
+				PFX##_set_dig(p[i]->z, 1);									\
+				p[i]->coord = BASIC;										\
+			}																\
+		}																	\
+		RLC_CATCH_ANY { RLC_THROW(ERR_CAUGHT); }							\
+		RLC_FINALLY {														\
+			for (i = 0; t3 != NULL && i < n; i++) {							\
+				PFX##_free(t3[i]);											\
+			}																\
+			PFX##_free(t1);													\
+			PFX##_free(t2);													\
+			PFX##_free(t4);													\
+			RLC_FREE(t3);													\
+		}																	\
+	}
@@ -882,12 +882,14 @@ static int division(void) {
 static int reduction(void) {
 	int code = RLC_ERR;
 	bn_t a, b, c, d, e;
+	mod_t ctx;
 
 	bn_null(a);
 	bn_null(b);
 	bn_null(c);
 	bn_null(d);
 	bn_null(e);
+	mod_null(ctx);
 
 	RLC_TRY {
 		bn_new(a);
@@ -895,6 +897,7 @@ static int reduction(void) {
 		bn_new(c);
 		bn_new(d);
 		bn_new(e);
+		mod_new(ctx);
 
 #if BN_MOD == BASIC || !defined(STRIP)
 		TEST_CASE("basic reduction is correct") {
@@ -997,6 +1000,38 @@ static int reduction(void) {
 		TEST_END;
 #endif
 
+		TEST_CASE("reduction with a modulus context is correct") {
+			bn_rand(a, RLC_POS, RLC_BN_BITS - RLC_DIG / 2);
+			bn_rand(b, RLC_POS, RLC_BN_BITS / 2);
+			if (bn_is_even(b)) {
+				bn_add_dig(b, b, 1);
+			}
+			bn_mod_ctx(ctx, b);
+			bn_mod(c, a, b);
+			bn_mod_ctx_rdc(d, a, ctx);
+			TEST_ASSERT(bn_cmp(c, d) == RLC_EQ, end);
+			bn_rand_mod(a, b);
+			bn_rand_mod(c, b);
+			bn_mul(d, a, c);
+			bn_mod(d, d, b);
+			bn_mod_ctx_conv(e, a, ctx);
+			bn_mod_ctx_mul(e, e, c, ctx);
+			TEST_ASSERT(bn_cmp(e, d) == RLC_EQ, end);
+			bn_mod_ctx_conv(e, a, ctx);
+			bn_mod_ctx_sqr(e, e, ctx);
+			bn_mod_ctx_back(e, e, ctx);
+			bn_sqr(d, a);
+			bn_mod(d, d, b);
+			TEST_ASSERT(bn_cmp(e, d) == RLC_EQ, end);
+			/* Check an even modulus, which has no Montgomery form. */
+			bn_rand(a, RLC_POS, RLC_BN_BITS - RLC_DIG / 2);
+			bn_sub_dig(b, b, 1);
+			bn_mod_ctx(ctx, b);
+			bn_mod(c, a, b);
+			bn_mod_ctx_rdc(d, a, ctx);
+			TEST_ASSERT(bn_cmp(c, d) == RLC_EQ, end);
+		}
+		TEST_END;
 	}
 	RLC_CATCH_ANY {
 		RLC_ERROR(end);
@@ -1008,19 +1043,36 @@ static int reduction(void) {
 	bn_free(c);
 	bn_free(d);
 	bn_free(e);
+	mod_free(ctx);
 	return code;
 }
 
 static int exponentiation(void) {
 	int code = RLC_ERR;
-	bn_t a, b, c, p;
+	bn_t a, b, c, p, t[RLC_MAX(RLC_BN_TABLE, 16)];
+	bn_t *u = RLC_ALLOCA(bn_t, 1024), *v = RLC_ALLOCA(bn_t, 1024);
 	crt_t crt;
+	mod_t ctx;
+
+	if (u == NULL || v == NULL) {
+		RLC_FREE(u);
+		RLC_FREE(v);
+		return RLC_ERR;
+	}
 
 	bn_null(a);
 	bn_null(b);
 	bn_null(c);
 	bn_null(p);
 	crt_null(crt);
+	mod_null(ctx);
+	for (int j = 0; j < RLC_MAX(RLC_BN_TABLE, 16); j++) {
+		bn_null(t[j]);
+	}
+	for (int j = 0; j < 1024; j++) {
+		bn_null(u[j]);
+		bn_null(v[j]);
+	}
 
 	RLC_TRY {
 		bn_new(a);
@@ -1028,6 +1080,14 @@ static int exponentiation(void) {
 		bn_new(c);
 		bn_new(p);
 		crt_new(crt);
+		mod_new(ctx);
+		for (int j = 0; j < RLC_MAX(RLC_BN_TABLE, 16); j++) {
+			bn_new(t[j]);
+		}
+		for (int j = 0; j < 1024; j++) {
+			bn_new(u[j]);
+			bn_new(v[j]);
+		}
 
 #if BN_MOD != PMERS
 		bn_gen_prime(p, RLC_BN_BITS);
@@ -1100,6 +1160,127 @@ static int exponentiation(void) {
 		TEST_END;
 #endif
 
+		bn_mod_ctx(ctx, p);
+
+		TEST_CASE("modular exponentiation with a modulus context is correct") {
+			bn_rand(a, RLC_POS, RLC_BN_BITS);
+			bn_rand(b, RLC_POS, RLC_BN_BITS);
+			bn_mxp(c, a, b, p);
+			bn_mod_ctx_conv(a, a, ctx);
+			bn_mxp_ctx(a, a, b, ctx);
+			bn_mod_ctx_back(a, a, ctx);
+			TEST_ASSERT(bn_cmp(a, c) == RLC_EQ, end);
+			bn_neg(b, b);
+			bn_mxp(c, c, b, p);
+			bn_mod_ctx_conv(a, a, ctx);
+			bn_mxp_ctx(a, a, b, ctx);
+			bn_mod_ctx_back(a, a, ctx);
+			TEST_ASSERT(bn_cmp(a, c) == RLC_EQ, end);
+			bn_zero(b);
+			bn_mxp_ctx(a, a, b, ctx);
+			bn_mod_ctx_back(a, a, ctx);
+			TEST_ASSERT(bn_cmp_dig(a, 1) == RLC_EQ, end);
+			bn_rand(a, RLC_POS, RLC_BN_BITS);
+			bn_mxp_dig(c, a, RLC_BN_BITS, p);
+			bn_mod_ctx_conv(a, a, ctx);
+			bn_mxp_ctx_dig(a, a, RLC_BN_BITS, ctx);
+			bn_mod_ctx_back(a, a, ctx);
+			TEST_ASSERT(bn_cmp(a, c) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("interleaved modular exponentiation is correct") {
+			bn_rand(b, RLC_POS, RLC_BN_BITS);
+			for (int j = 0; j < 4; j++) {
+				bn_rand(t[j], RLC_POS, RLC_BN_BITS);
+				bn_mod(t[j], t[j], p);
+				bn_mxp(t[j + 4], t[j], b, p);
+				bn_mod_ctx_conv(t[j], t[j], ctx);
+			}
+			bn_mxp_ctx_many(t, (const bn_t *)t, b, ctx, 4);
+			for (int j = 0; j < 4; j++) {
+				bn_mod_ctx_back(t[j], t[j], ctx);
+				TEST_ASSERT(bn_cmp(t[j], t[j + 4]) == RLC_EQ, end);
+			}
+			bn_neg(b, b);
+			for (int j = 0; j < 4; j++) {
+				bn_mxp(t[j + 4], t[j], b, p);
+				bn_mod_ctx_conv(t[j], t[j], ctx);
+			}
+			bn_mxp_ctx_many(t, (const bn_t *)t, b, ctx, 4);
+			for (int j = 0; j < 4; j++) {
+				bn_mod_ctx_back(t[j], t[j], ctx);
+				TEST_ASSERT(bn_cmp(t[j], t[j + 4]) == RLC_EQ, end);
+			}
+		} TEST_END;
+
+		TEST_ONCE("interleaved modular exponentiation of many bases is correct") {
+			bn_rand(b, RLC_POS, RLC_BN_BITS);
+			for (int j = 0; j < 1024; j++) {
+				bn_rand(u[j], RLC_POS, RLC_BN_BITS);
+				bn_mod(u[j], u[j], p);
+				bn_mod_ctx_conv(u[j], u[j], ctx);
+			}
+			bn_mxp_ctx_many(v, (const bn_t *)u, b, ctx, 1024);
+			for (int j = 0; j < 1024; j++) {
+				bn_mxp_ctx(c, u[j], b, ctx);
+				TEST_ASSERT(bn_cmp(c, v[j]) == RLC_EQ, end);
+			}
+			/* Leave a partial lot at the end. */
+			bn_rand(b, RLC_NEG, RLC_DIG);
+			bn_mxp_ctx_many(v, (const bn_t *)u, b, ctx, 1021);
+			for (int j = 0; j < 1021; j++) {
+				bn_mxp_ctx(c, u[j], b, ctx);
+				TEST_ASSERT(bn_cmp(c, v[j]) == RLC_EQ, end);
+			}
+		} TEST_END;
+
+		TEST_CASE("modular exponentiation of eight bases is correct") {
+			bn_rand(b, RLC_POS, RLC_BN_BITS);
+			for (int j = 0; j < 8; j++) {
+				bn_rand(t[j], RLC_POS, RLC_BN_BITS);
+				bn_mod(t[j], t[j], p);
+				bn_mxp(t[j + 8], t[j], b, p);
+			}
+			bn_mxp_x8(t, (const bn_t *)t, b, p);
+			for (int j = 0; j < 8; j++) {
+				TEST_ASSERT(bn_cmp(t[j], t[j + 8]) == RLC_EQ, end);
+			}
+			bn_rand(b, RLC_NEG, RLC_DIG);
+			for (int j = 0; j < 8; j++) {
+				bn_mxp(t[j + 8], t[j], b, p);
+			}
+			bn_mxp_x8(t, (const bn_t *)t, b, p);
+			for (int j = 0; j < 8; j++) {
+				TEST_ASSERT(bn_cmp(t[j], t[j + 8]) == RLC_EQ, end);
+			}
+		} TEST_END;
+
+		TEST_CASE("fixed base modular exponentiation is correct") {
+			bn_rand(a, RLC_POS, RLC_BN_BITS);
+			bn_mod(a, a, p);
+			bn_mxp_pre(t, a, p);
+			bn_rand(b, RLC_POS, RLC_BN_BITS);
+			bn_mxp(c, a, b, p);
+			bn_mxp_fix(b, (const bn_t *)t, b, p);
+			TEST_ASSERT(bn_cmp(b, c) == RLC_EQ, end);
+			bn_rand(b, RLC_POS, RLC_DIG);
+			bn_mxp(c, a, b, p);
+			bn_mxp_fix(b, (const bn_t *)t, b, p);
+			TEST_ASSERT(bn_cmp(b, c) == RLC_EQ, end);
+			bn_rand(b, RLC_NEG, RLC_BN_BITS / 2);
+			bn_mxp(c, a, b, p);
+			bn_mxp_fix(b, (const bn_t *)t, b, p);
+			TEST_ASSERT(bn_cmp(b, c) == RLC_EQ, end);
+			/* Exponents longer than the modulus use the generic method. */
+			bn_rand(b, RLC_POS, 2 * RLC_BN_BITS - RLC_DIG);
+			bn_mxp(c, a, b, p);
+			bn_mxp_fix(b, (const bn_t *)t, b, p);
+			TEST_ASSERT(bn_cmp(b, c) == RLC_EQ, end);
+			bn_zero(b);
+			bn_mxp_fix(b, (const bn_t *)t, b, p);
+			TEST_ASSERT(bn_cmp_dig(b, 1) == RLC_EQ, end);
+		} TEST_END;
+
 		do {
 			bn_gen_prime(crt->p, RLC_BN_BITS / 2);
 			bn_gen_prime(crt->q, RLC_BN_BITS / 2);
@@ -1135,6 +1316,16 @@ static int exponentiation(void) {
 	bn_free(c);
 	bn_free(p);
 	crt_free(crt);
+	mod_free(ctx);
+	for (int j = 0; j < RLC_MAX(RLC_BN_TABLE, 16); j++) {
+		bn_free(t[j]);
+	}
+	for (int j = 0; j < 1024; j++) {
+		bn_free(u[j]);
+		bn_free(v[j]);
+	}
+	RLC_FREE(u);
+	RLC_FREE(v);
 	return code;
 }
 
@@ -1716,14 +1907,18 @@ static int digit(void) {
 
 static int prime(void) {
 	int code = RLC_ERR;
-	bn_t p, q;
+	bn_t p, q, t[2];
 
 	bn_null(p);
 	bn_null(q);
+	bn_null(t[0]);
+	bn_null(t[1]);
 
 	RLC_TRY {
 		bn_new(p);
 		bn_new(q);
+		bn_new(t[0]);
+		bn_new(t[1]);
 
 		TEST_ONCE("prime generation is consistent") {
 			bn_gen_prime(p, RLC_BN_BITS);
@@ -1767,6 +1962,31 @@ static int prime(void) {
 			TEST_ASSERT(bn_is_prime_solov(p) == 1, end);
 		} TEST_END;
 
+		TEST_CASE("next prime computation is correct") {
+			bn_rand(p, RLC_POS, RLC_BN_BITS / 2);
+			bn_copy(q, p);
+			do {
+				bn_add_dig(q, q, 1);
+			} while (!bn_is_prime(q));
+			bn_next_prime(p, p);
+			TEST_ASSERT(bn_cmp(p, q) == RLC_EQ, end);
+			bn_rand(p, RLC_POS, RLC_DIG / 2);
+			bn_copy(q, p);
+			do {
+				bn_add_dig(q, q, 1);
+			} while (!bn_is_prime(q));
+			bn_next_prime(p, p);
+			TEST_ASSERT(bn_cmp(p, q) == RLC_EQ, end);
+			bn_set_dig(p, 1);
+			bn_next_prime(p, p);
+			TEST_ASSERT(bn_cmp_dig(p, 2) == RLC_EQ, end);
+			bn_next_prime(p, p);
+			TEST_ASSERT(bn_cmp_dig(p, 3) == RLC_EQ, end);
+			bn_set_dig(p, 23);
+			bn_next_prime(p, p);
+			TEST_ASSERT(bn_cmp_dig(p, 29) == RLC_EQ, end);
+		} TEST_END;
+
 		bn_gen_prime_factor(q, p, RLC_BN_BITS>>1, RLC_BN_BITS);
 		TEST_ONCE("prime with large (p-1) prime factor testing is correct") {
 			TEST_ASSERT(bn_is_prime(p) == 1, end);
@@ -1785,6 +2005,8 @@ static int prime(void) {
   end:
 	bn_free(p);
 	bn_free(q);
+	bn_free(t[0]);
+	bn_free(t[1]);
 	return code;
 }
 
@@ -1900,6 +2122,127 @@ static int inversion(void) {
 	return code;
 }
 
+static int lagrange(void) {
+	int i, j, k, n = 40, m = 70, l = 10000;
+	/* Keep the result in memory, since the error handler may longjmp. */
+	volatile int code = RLC_ERR;
+	bn_t a, c, *d = RLC_MALLOC(bn_t, l + 1), *e = RLC_MALLOC(bn_t, l + 1),
+		*x = RLC_MALLOC(bn_t, l);
+
+	bn_null(a);
+	bn_null(c);
+
+	RLC_TRY {
+		bn_new(a);
+		bn_new(c);
+		if (d == NULL || e == NULL || x == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i <= l; i++) {
+			bn_null(d[i]);
+			bn_null(e[i]);
+			bn_new(d[i]);
+			bn_new(e[i]);
+		}
+		for (i = 0; i < l; i++) {
+			bn_null(x[i]);
+			bn_new(x[i]);
+		}
+
+		bn_gen_prime(a, RLC_BN_BITS);
+
+		TEST_CASE("fast lagrange interpolation is correct") {
+			for (j = 0; j < n; j++) {
+				bn_rand_mod(x[j], a);
+			}
+			bn_lag(d, x, a, n);
+			bn_lag_fast(e, x, a, n);
+			for (j = 0; j <= n; j++) {
+				TEST_ASSERT(bn_cmp(d[j], e[j]) == RLC_EQ, end);
+			}
+		} TEST_END;
+
+		TEST_CASE("multipoint polynomial evaluation is correct") {
+			for (j = 0; j < m; j++) {
+				bn_rand_mod(d[j], a);
+			}
+			for (j = 0; j < n; j++) {
+				bn_rand_mod(x[j], a);
+			}
+			bn_evl_sim(e, d, x, a, m, n);
+			for (j = 0; j < n; j++) {
+				bn_evl(c, d, x[j], a, m);
+				TEST_ASSERT(bn_cmp(c, e[j]) == RLC_EQ, end);
+			}
+		} TEST_END;
+
+		TEST_CASE("polynomial interpolation is correct") {
+			for (j = 0; j < n; j++) {
+				bn_rand_mod(d[j], a);
+				do {
+					bn_rand_mod(x[j], a);
+					for (k = 0; k < j && bn_cmp(x[j], x[k]) != RLC_EQ; k++);
+				} while (k < j);
+			}
+			bn_evl_sim(e, d, x, a, n, n);
+			bn_itp(e, x, e, a, n);
+			for (j = 0; j < n; j++) {
+				TEST_ASSERT(bn_cmp(d[j], e[j]) == RLC_EQ, end);
+			}
+		} TEST_END;
+
+		/* Keep the large sets affordable with a smaller modulus. */
+		bn_gen_prime(a, RLC_MIN(RLC_BN_BITS, 256));
+
+		TEST_ONCE("fast lagrange interpolation of many points is correct") {
+			for (j = 0; j < l; j++) {
+				bn_rand_mod(x[j], a);
+			}
+			bn_lag_fast(e, x, a, l);
+			TEST_ASSERT(bn_cmp_dig(e[l], 1) == RLC_EQ, end);
+			bn_evl_sim(d, e, x, a, l + 1, l);
+			for (j = 0; j < l; j++) {
+				TEST_ASSERT(bn_is_zero(d[j]), end);
+			}
+		} TEST_END;
+
+		TEST_ONCE("polynomial interpolation of many points is correct") {
+			/* Random points are distinct with overwhelming probability. */
+			for (j = 0; j < l; j++) {
+				bn_rand_mod(d[j], a);
+				bn_rand_mod(x[j], a);
+			}
+			bn_itp(e, x, d, a, l);
+			for (j = 0; j < l; j += 97) {
+				bn_evl(c, e, x[j], a, l);
+				TEST_ASSERT(bn_cmp(c, d[j]) == RLC_EQ, end);
+			}
+		} TEST_END;
+	}
+	RLC_CATCH_ANY {
+		RLC_ERROR(end);
+	}
+	code = RLC_OK;
+  end:
+	bn_free(a);
+	bn_free(c);
+	if (d != NULL && e != NULL) {
+		for (i = 0; i <= l; i++) {
+			bn_free(d[i]);
+			bn_free(e[i]);
+		}
+	}
+	if (x != NULL) {
+		for (i = 0; i < l; i++) {
+			bn_free(x[i]);
+		}
+	}
+	alloc_free((void *)d);
+	alloc_free((void *)e);
+	alloc_free((void *)x);
+	return code;
+}
+
 static int factor(void) {
 	int code = RLC_ERR;
 	bn_t p, q, n;
@@ -2360,6 +2703,11 @@ int main(void) {
 		return 1;
 	}
 
+	if (lagrange() != RLC_OK) {
+		core_clean();
+		return 1;
+	}
+
 	if (factor() != RLC_OK) {
 		core_clean();
 		return 1;
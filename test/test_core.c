@@ -62,6 +62,64 @@ void *tester(void *ptr) {
 	return NULL;
 }
 
+#if ALLOC == DYNAMIC
+
+/**
+ * Number of blocks obtained from the system allocator and not yet returned.
+ */
+static int chunks;
+
+static void *chunk_get(size_t size) {
+	chunks++;
+	return malloc(size);
+}
+
+static void *chunk_resize(void *ptr, size_t size) {
+	return realloc(ptr, size);
+}
+
+static void chunk_put(void *ptr) {
+	chunks--;
+	free(ptr);
+}
+
+void *freer(void *ptr) {
+	core_init();
+	alloc_free(*(void **)ptr);
+	core_clean();
+	return NULL;
+}
+
+void *owner(void *ptr) {
+	int *code = (int *)ptr;
+	pthread_t thread;
+	void *a, *b;
+
+	*code = RLC_ERR;
+	core_init();
+	a = alloc_malloc(100);
+	if (a != NULL && pthread_create(&thread, NULL, freer, &a) == 0 &&
+			pthread_join(thread, NULL) == 0) {
+		/* The block freed by the other thread must come back here. */
+		b = alloc_malloc(100);
+		if (a == b) {
+			*code = RLC_OK;
+		}
+		alloc_free(b);
+	}
+	core_clean();
+	return NULL;
+}
+
+void *leaver(void *ptr) {
+	core_init();
+	*(void **)ptr = alloc_malloc(100);
+	core_clean();
+	return NULL;
+}
+
+#endif
+
 #endif
 #endif
 
@@ -100,6 +158,122 @@ int main(void) {
 		core_set(old_ctx);
 	} TEST_END;
 
+#if defined(WITH_EP) && defined(EP_PLAIN) && defined(EP_ENDOM) && FP_PRIME == 256
+	TEST_ONCE("switching parameter sets is correct") {
+		ctx_t *par[2] = { NULL, NULL };
+		int id, ids[2] = { SECG_K256, NIST_P256 };
+		ep_t p, q;
+		bn_t k, n;
+
+		ep_null(p);
+		ep_null(q);
+		bn_null(k);
+		bn_null(n);
+
+		ep_new(p);
+		ep_new(q);
+		bn_new(k);
+		bn_new(n);
+
+		id = ep_param_get();
+		/* Configure each parameter set while it is active. */
+		for (int i = 0; i < 2; i++) {
+			par[i] = core_par_new();
+			TEST_ASSERT(par[i] != NULL, end);
+			core_par_set(par[i]);
+			ep_param_set(ids[i]);
+			core_par_set(NULL);
+		}
+		TEST_ASSERT(ep_param_get() == id, end);
+		for (int i = 0; i < 4; i++) {
+			core_par_set(par[i & 1]);
+			TEST_ASSERT(core_par_get() == par[i & 1], end);
+			TEST_ASSERT(ep_param_get() == ids[i & 1], end);
+			ep_curve_get_gen(p);
+			ep_curve_get_ord(n);
+			bn_rand_mod(k, n);
+			ep_mul(p, p, k);
+			ep_mul_gen(q, k);
+			TEST_ASSERT(ep_cmp(p, q) == RLC_EQ, end);
+		}
+		core_par_set(NULL);
+		TEST_ASSERT(ep_param_get() == id, end);
+		core_par_free(par[0]);
+		core_par_free(par[1]);
+
+		ep_free(p);
+		ep_free(q);
+		bn_free(k);
+		bn_free(n);
+	} TEST_END;
+#endif
+
+#if ALLOC == DYNAMIC
+	TEST_ONCE("memory pools are correct") {
+		size_t c0, b0, s0, c1, b1, s1;
+		uint8_t *a, *b;
+		bn_t k;
+		int m;
+
+		alloc_stats(&c0, &b0, &s0);
+		a = (uint8_t *)alloc_calloc(10, 10);
+		TEST_ASSERT(a != NULL, end);
+		for (int i = 0; i < 100; i++) {
+			TEST_ASSERT(a[i] == 0, end);
+			a[i] = i;
+		}
+		a = (uint8_t *)alloc_realloc(a, 1000);
+		TEST_ASSERT(a != NULL, end);
+		for (int i = 0; i < 100; i++) {
+			TEST_ASSERT(a[i] == i, end);
+		}
+		alloc_free(a);
+		alloc_stats(&c1, &b1, &s1);
+		TEST_ASSERT(c1 == c0 + 2 && b1 == b0 + 1100, end);
+		/* Check that freed blocks are recycled. */
+		b = (uint8_t *)alloc_malloc(1000);
+		TEST_ASSERT(a == b, end);
+		alloc_free(b);
+		/* Check that released scopes reuse the arena. */
+		for (int j = 0; j < 2; j++) {
+			alloc_stats(&c0, &b0, &s0);
+			m = alloc_mark();
+			for (int i = 0; i < 64; i++) {
+				bn_null(k);
+				bn_new(k);
+				bn_rand(k, RLC_POS, RLC_BN_BITS);
+				TEST_ASSERT(alloc_malloc(4000) != NULL, end);
+			}
+			alloc_release(m);
+			alloc_stats(&c1, &b1, &s1);
+			TEST_ASSERT(c1 == c0 + 3 * 64, end);
+		}
+		TEST_ASSERT(s1 == s0, end);
+	} TEST_END;
+
+#ifdef CHECK
+	TEST_ONCE("freeing a block of a released scope is detected") {
+		void *a, *b;
+		int m;
+
+		/* Leave a free block outside scopes to be tempted by. */
+		a = alloc_malloc(100);
+		TEST_ASSERT(a != NULL, end);
+		alloc_free(a);
+		m = alloc_mark();
+		b = alloc_malloc(100);
+		TEST_ASSERT(b != NULL && b != a, end);
+		alloc_free(b);
+		a = alloc_malloc(100);
+		TEST_ASSERT(a == b, end);
+		TEST_ASSERT(err_get_code() == RLC_OK, end);
+		alloc_release(m);
+		alloc_free(a);
+		TEST_ASSERT(err_get_code() == RLC_ERR, end);
+	} TEST_END;
+#endif
+#endif
+
 	code = RLC_OK;
 
 #if defined(MULTI)
@@ -161,6 +335,30 @@ int main(void) {
 		}
 		TEST_ASSERT(code == RLC_OK, end);
 	} TEST_END;
+
+#if ALLOC == DYNAMIC
+	TEST_ONCE("memory pools are thread-safe") {
+		/* A wrapper of the C library allocator may replace it at any time. */
+		alloc_t sys = { chunk_get, chunk_resize, chunk_put };
+		pthread_t thread;
+		void *a = NULL;
+		int result = RLC_ERR;
+
+		alloc_set(&sys);
+		chunks = 0;
+		/* A block freed by another thread returns to its pool. */
+		TEST_ASSERT(pthread_create(&thread, NULL, owner, &result) == 0, end);
+		TEST_ASSERT(pthread_join(thread, NULL) == 0, end);
+		TEST_ASSERT(result == RLC_OK && chunks == 0, end);
+		/* A finalized pool is released when its last block is freed. */
+		TEST_ASSERT(pthread_create(&thread, NULL, leaver, &a) == 0, end);
+		TEST_ASSERT(pthread_join(thread, NULL) == 0, end);
+		TEST_ASSERT(a != NULL && chunks > 0, end);
+		alloc_free(a);
+		TEST_ASSERT(chunks == 0, end);
+		alloc_set(NULL);
+	} TEST_END;
+#endif
 #endif
 #endif
 
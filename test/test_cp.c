@@ -39,7 +39,9 @@ static int rsa(void) {
 	int code = RLC_ERR;
 	rsa_t pub, prv;
 	uint8_t in[10], out[RLC_BN_BITS / 8 + 1], h[RLC_MD_LEN];
-	int il, ol;
+	uint8_t bi[4][10], bd[4][10], bo[4][RLC_BN_BITS / 8 + 1];
+	uint8_t *pi[4], *pd[4], *po[4];
+	int il, ol, li[4], ld[4], lo[4];
 	int result;
 
 	rsa_null(pub);
@@ -74,6 +76,33 @@ static int rsa(void) {
 			TEST_ASSERT(cp_rsa_sig(out, &ol, h, RLC_MD_LEN, 1, prv) == RLC_OK, end);
 			TEST_ASSERT(cp_rsa_ver(out, ol, h, RLC_MD_LEN, 1, pub) == 1, end);
 		} TEST_END;
+
+		TEST_CASE("rsa batch decryption/signature is correct") {
+			TEST_ASSERT(result == RLC_OK, end);
+			for (int j = 0; j < 4; j++) {
+				pi[j] = bi[j];
+				pd[j] = bd[j];
+				po[j] = bo[j];
+				li[j] = sizeof(bi[j]);
+				ld[j] = sizeof(bd[j]);
+				lo[j] = RLC_BN_BITS / 8 + 1;
+				rand_bytes(bi[j], li[j]);
+				TEST_ASSERT(cp_rsa_enc(bo[j], &lo[j], bi[j], li[j], pub) ==
+						RLC_OK, end);
+			}
+			TEST_ASSERT(cp_rsa_dec_many(pd, ld, po, lo, 4, prv) == RLC_OK, end);
+			for (int j = 0; j < 4; j++) {
+				TEST_ASSERT(ld[j] == li[j], end);
+				TEST_ASSERT(memcmp(bi[j], bd[j], li[j]) == 0, end);
+				lo[j] = RLC_BN_BITS / 8 + 1;
+			}
+			TEST_ASSERT(cp_rsa_sig_many(po, lo, pi, li, 4, 0, prv) == RLC_OK,
+					end);
+			for (int j = 0; j < 4; j++) {
+				TEST_ASSERT(cp_rsa_ver(bo[j], lo[j], bi[j], li[j], 0, pub) == 1,
+						end);
+			}
+		} TEST_END;
 	} RLC_CATCH_ANY {
 		RLC_ERROR(end);
 	}
@@ -192,6 +221,7 @@ static int paillier(void) {
 	int code = RLC_ERR;
 	bn_t a, b, c, d, s, pub;
 	phpe_t prv;
+	mod_t ctx;
 	int result;
 
 	bn_null(a);
@@ -201,6 +231,7 @@ static int paillier(void) {
 	bn_null(s);
 	bn_null(pub);
 	phpe_null(prv);
+	mod_null(ctx);
 
 	RLC_TRY {
 		bn_new(a);
@@ -210,6 +241,7 @@ static int paillier(void) {
 		bn_new(s);
 		bn_new(pub);
 		phpe_new(prv);
+		mod_new(ctx);
 
 		result = cp_phpe_gen(pub, prv, RLC_BN_BITS / 2);
 
@@ -236,6 +268,18 @@ static int paillier(void) {
 		}
 		TEST_END;
 
+		TEST_CASE("paillier encryption with a modulus context is correct") {
+			TEST_ASSERT(result == RLC_OK, end);
+			TEST_ASSERT(cp_phpe_ctx(ctx, pub) == RLC_OK, end);
+			for (int j = 0; j < 2; j++) {
+				bn_rand_mod(a, pub);
+				TEST_ASSERT(cp_phpe_enc_ctx(c, a, pub, ctx) == RLC_OK, end);
+				TEST_ASSERT(cp_phpe_dec(b, c, prv) == RLC_OK, end);
+				TEST_ASSERT(bn_cmp(a, b) == RLC_EQ, end);
+			}
+		}
+		TEST_END;
+
 		for (int k = 1; k <= 2; k++) {
 			result = cp_ghpe_gen(pub, s, RLC_BN_BITS / (2 * k));
 			util_print("(s = %d) ", k);
@@ -247,6 +291,16 @@ static int paillier(void) {
 				TEST_ASSERT(bn_cmp(a, b) == RLC_EQ, end);
 			}  TEST_END;
 
+			util_print("(s = %d) ", k);
+			TEST_CASE("general paillier encryption with a context is correct") {
+				TEST_ASSERT(result == RLC_OK, end);
+				TEST_ASSERT(cp_ghpe_ctx(ctx, pub, k) == RLC_OK, end);
+				bn_rand(a, RLC_POS, k * (bn_bits(pub) - 1));
+				TEST_ASSERT(cp_ghpe_enc_ctx(c, a, pub, k, ctx) == RLC_OK, end);
+				TEST_ASSERT(cp_ghpe_dec(b, c, pub, s, k) == RLC_OK, end);
+				TEST_ASSERT(bn_cmp(a, b) == RLC_EQ, end);
+			}  TEST_END;
+
 			util_print("(s = %d) ", k);
 			TEST_CASE("general paillier encryption/decryption is homomorphic") {
 				TEST_ASSERT(result == RLC_OK, end);
@@ -285,6 +339,7 @@ static int paillier(void) {
 	bn_free(s);
 	bn_free(pub);
 	phpe_free(prv);
+	mod_free(ctx);
 	return code;
 }
 
@@ -619,20 +674,38 @@ static int ecdsa(void) {
 		printf("初始化参数成功！\n");
 	
 	int code = RLC_ERR;
-	bn_t d, r, s;
-	ec_t q;
-	uint8_t m[5] = { 0, 1, 2, 3, 4 }, h[RLC_MD_LEN];
+	bn_t d, r, s, n, e, rb[4], sb[4];
+	ec_t q, qb[4], pb[4];
+	uint8_t m[5] = { 0, 1, 2, 3, 4 }, h[RLC_MD_LEN], hb[4][RLC_MD_LEN];
+	uint8_t *mb[4];
+	int lb[4], vb[4];
 
 	bn_null(d);
 	bn_null(r);
 	bn_null(s);
+	bn_null(n);
+	bn_null(e);
 	ec_null(q);
+	for (int j = 0; j < 4; j++) {
+		bn_null(rb[j]);
+		bn_null(sb[j]);
+		ec_null(qb[j]);
+		ec_null(pb[j]);
+	}
 
 	RLC_TRY {
 		bn_new(d);
 		bn_new(r);
 		bn_new(s);
+		bn_new(n);
+		bn_new(e);
 		ec_new(q);
+		for (int j = 0; j < 4; j++) {
+			bn_new(rb[j]);
+			bn_new(sb[j]);
+			ec_new(qb[j]);
+			ec_new(pb[j]);
+		}
 		cp_ecdsa_gen(d, q);
 		cp_ecdsa_sig(r, s, m, sizeof(m), 0, d);
 		if(cp_ecdsa_ver(r, s, m, sizeof(m), 0, q)){
@@ -654,6 +727,56 @@ static int ecdsa(void) {
 			TEST_ASSERT(cp_ecdsa_ver(r, s, h, RLC_MD_LEN, 1, q) == 0, end);
 		}
 		TEST_END;
+
+		TEST_CASE("ecdsa batch verification is correct") {
+			ec_curve_get_ord(n);
+			for (int j = 0; j < 4; j++) {
+				/* Two signatures per key, as in a bounded key set. */
+				if (j % 2 == 0) {
+					TEST_ASSERT(cp_ecdsa_gen(d, q) == RLC_OK, end);
+				}
+				ec_copy(qb[j], q);
+				rand_bytes(hb[j], RLC_MD_LEN);
+				mb[j] = hb[j];
+				lb[j] = RLC_MD_LEN;
+				TEST_ASSERT(cp_ecdsa_sig(rb[j], sb[j], hb[j], RLC_MD_LEN, 1,
+						d) == RLC_OK, end);
+				/* Recover R = (e/s)G + (r/s)Q, as a signer would keep it. */
+				bn_read_bin(e, hb[j], RLC_MD_LEN);
+				if (8 * RLC_MD_LEN > bn_bits(n)) {
+					bn_rsh(e, e, 8 * RLC_MD_LEN - bn_bits(n));
+				}
+				bn_mod_inv(s, sb[j], n);
+				bn_mul(e, e, s);
+				bn_mod(e, e, n);
+				bn_mul(s, rb[j], s);
+				bn_mod(s, s, n);
+				ec_mul_sim_gen(pb[j], e, qb[j], s);
+			}
+			TEST_ASSERT(cp_ecdsa_ver_batch(vb, rb, sb, mb, lb, 1, qb, NULL,
+					4) == 1, end);
+			TEST_ASSERT(vb[0] && vb[1] && vb[2] && vb[3], end);
+			TEST_ASSERT(cp_ecdsa_ver_batch(vb, rb, sb, mb, lb, 1, qb, pb,
+					4) == 1, end);
+			TEST_ASSERT(vb[0] && vb[1] && vb[2] && vb[3], end);
+			/* The other point with the same x-coordinate is not accepted. */
+			ec_neg(pb[2], pb[2]);
+			TEST_ASSERT(cp_ecdsa_ver_batch(vb, rb, sb, mb, lb, 1, qb, pb,
+					4) == 1, end);
+			TEST_ASSERT(vb[0] && vb[1] && vb[2] && vb[3], end);
+			hb[1][0] ^= 1;
+			TEST_ASSERT(cp_ecdsa_ver_batch(vb, rb, sb, mb, lb, 1, qb, pb,
+					4) == 0, end);
+			TEST_ASSERT(vb[0] && !vb[1] && vb[2] && vb[3], end);
+			TEST_ASSERT(cp_ecdsa_ver_batch(vb, rb, sb, mb, lb, 1, qb, NULL,
+					4) == 0, end);
+			TEST_ASSERT(vb[0] && !vb[1] && vb[2] && vb[3], end);
+			bn_zero(sb[3]);
+			TEST_ASSERT(cp_ecdsa_ver_batch(vb, rb, sb, mb, lb, 1, qb, pb,
+					4) == 0, end);
+			TEST_ASSERT(vb[0] && !vb[1] && vb[2] && !vb[3], end);
+		}
+		TEST_END;
 	}
 	RLC_CATCH_ANY {
 		RLC_ERROR(end);
@@ -664,7 +787,15 @@ static int ecdsa(void) {
 	bn_free(d);
 	bn_free(r);
 	bn_free(s);
+	bn_free(n);
+	bn_free(e);
 	ec_free(q);
+	for (int j = 0; j < 4; j++) {
+		bn_free(rb[j]);
+		bn_free(sb[j]);
+		ec_free(qb[j]);
+		ec_free(pb[j]);
+	}
 	return 0;
 }
 
@@ -1100,6 +1231,109 @@ end:
 
 #endif /* WITH_EC */
 
+#if defined(WITH_ED)
+
+/* Test vectors 1 and 2 from RFC 8032, Section 7.1. */
+static const char *EDDSA_PRV[] = {
+	"9D61B19DEFFD5A60BA844AF492EC2CC44449C5697B326919703BAC031CAE7F60",
+	"4CCD089B28FF96DA9DB6C346EC114E0F5B8A319F35ABA624DA8CF6ED4FB8A6FB"
+};
+
+static const char *EDDSA_PUB[] = {
+	"D75A980182B10AB7D54BFED3C964073A0EE172F3DAA62325AF021A68F707511A",
+	"3D4017C3E843895A92B70AA74D1B7EBC9C982CCF2EC4968CC0CD55F12AF4660C"
+};
+
+static const char *EDDSA_SIG[] = {
+	"E5564300C360AC729086E2CC806E828A84877F1EB8E5D974D873E06522490155"
+	"5FB8821590A33BACC61E39701CF9B46BD25BF5F0595BBE24655141438E7A100B",
+	"92A009A9F0D4CAB8720E820B5F642540A2B27B5416503F8FB3762223EBDB69DA"
+	"085AC1E43E15996E458F3613D0F11D8C387B2EAEB4302AEEB00D291612BB0C00"
+};
+
+static int eddsa(void) {
+	int code = RLC_ERR;
+	uint8_t m[5] = { 0, 1, 2, 3, 4 }, v = 0x72;
+	uint8_t prv[RLC_EDDSA_LEN], pub[4][RLC_EDDSA_LEN], sig[4][RLC_EDDSA_SIG];
+	uint8_t s[RLC_EDDSA_SIG], *sb[4], *mb[4], *pb[4];
+	int lb[4], vb[4];
+	bn_t t;
+
+	bn_null(t);
+
+	RLC_TRY {
+		bn_new(t);
+
+		TEST_CASE("eddsa signature is correct") {
+			TEST_ASSERT(cp_eddsa_gen(pub[0], prv) == RLC_OK, end);
+			TEST_ASSERT(cp_eddsa_sig(sig[0], m, sizeof(m), prv, pub[0])
+					== RLC_OK, end);
+			TEST_ASSERT(cp_eddsa_ver(sig[0], m, sizeof(m), pub[0]) == 1, end);
+			m[0] ^= 1;
+			TEST_ASSERT(cp_eddsa_ver(sig[0], m, sizeof(m), pub[0]) == 0, end);
+			m[0] ^= 1;
+			sig[0][RLC_EDDSA_LEN] ^= 1;
+			TEST_ASSERT(cp_eddsa_ver(sig[0], m, sizeof(m), pub[0]) == 0, end);
+			/* A public key not matching the private key is refused. */
+			pub[0][0] ^= 1;
+			TEST_ASSERT(cp_eddsa_sig(sig[0], m, sizeof(m), prv, pub[0])
+					== RLC_ERR, end);
+			pub[0][0] ^= 1;
+		}
+		TEST_END;
+
+		TEST_CASE("eddsa signature is compatible with rfc 8032") {
+			for (int j = 0; j < 2; j++) {
+				bn_read_str(t, EDDSA_PRV[j], strlen(EDDSA_PRV[j]), 16);
+				bn_write_bin(prv, RLC_EDDSA_LEN, t);
+				bn_read_str(t, EDDSA_PUB[j], strlen(EDDSA_PUB[j]), 16);
+				bn_write_bin(pub[j], RLC_EDDSA_LEN, t);
+				bn_read_str(t, EDDSA_SIG[j], strlen(EDDSA_SIG[j]), 16);
+				bn_write_bin(s, RLC_EDDSA_SIG, t);
+				TEST_ASSERT(cp_eddsa_sig(sig[j], &v, j, prv, pub[j])
+						== RLC_OK, end);
+				TEST_ASSERT(memcmp(sig[j], s, RLC_EDDSA_SIG) == 0, end);
+				TEST_ASSERT(cp_eddsa_ver(s, &v, j, pub[j]) == 1, end);
+			}
+		}
+		TEST_END;
+
+		TEST_CASE("eddsa batch verification is correct") {
+			for (int j = 0; j < 4; j++) {
+				TEST_ASSERT(cp_eddsa_gen(pub[j], prv) == RLC_OK, end);
+				TEST_ASSERT(cp_eddsa_sig(sig[j], m, j + 1, prv, pub[j])
+						== RLC_OK, end);
+				sb[j] = sig[j];
+				mb[j] = m;
+				lb[j] = j + 1;
+				pb[j] = pub[j];
+			}
+			TEST_ASSERT(cp_eddsa_ver_batch(vb, sb, mb, lb, pb, 4) == 1, end);
+			TEST_ASSERT(vb[0] && vb[1] && vb[2] && vb[3], end);
+			/* Corrupt a single signature and locate it. */
+			lb[2] = 1;
+			TEST_ASSERT(cp_eddsa_ver_batch(vb, sb, mb, lb, pb, 4) == 0, end);
+			TEST_ASSERT(vb[0] && vb[1] && !vb[2] && vb[3], end);
+			/* A malformed S is rejected before the batch check. */
+			lb[2] = 3;
+			memset(sig[1] + RLC_EDDSA_LEN, 0xFF, RLC_EDDSA_LEN);
+			TEST_ASSERT(cp_eddsa_ver_batch(vb, sb, mb, lb, pb, 4) == 0, end);
+			TEST_ASSERT(vb[0] && !vb[1] && vb[2] && vb[3], end);
+		}
+		TEST_END;
+	}
+	RLC_CATCH_ANY {
+		RLC_ERROR(end);
+	}
+	code = RLC_OK;
+
+  end:
+	bn_free(t);
+	return code;
+}
+
+#endif
+
 #if defined(WITH_PC)
 
 static int pdpub(void) {
@@ -1477,18 +1711,27 @@ static int bgn(void) {
 static int bls(void) {
 	int code = RLC_ERR;
 	bn_t d;
-	g1_t s;
-	g2_t q;
-	uint8_t m[5] = { 0, 1, 2, 3, 4 };
+	g1_t s, sb[4];
+	g2_t q, qb[4];
+	uint8_t m[5] = { 0, 1, 2, 3, 4 }, hb[4][RLC_MD_LEN], *mb[4];
+	int lb[4], vb[4];
 
 	bn_null(d);
 	g1_null(s);
 	g2_null(q);
+	for (int i = 0; i < 4; i++) {
+		g1_null(sb[i]);
+		g2_null(qb[i]);
+	}
 
 	RLC_TRY {
 		bn_new(d);
 		g1_new(s);
 		g2_new(q);
+		for (int i = 0; i < 4; i++) {
+			g1_new(sb[i]);
+			g2_new(qb[i]);
+		}
 
 		TEST_CASE("boneh-lynn-schacham short signature is correct") {
 			TEST_ASSERT(cp_bls_gen(d, q) == RLC_OK, end);
@@ -1500,6 +1743,63 @@ static int bls(void) {
 			TEST_ASSERT(cp_bls_ver(s, m, sizeof(m), q) == 0, end);
 		}
 		TEST_END;
+
+		TEST_CASE("boneh-lynn-schacham aggregate signature is correct") {
+			for (int i = 0; i < 4; i++) {
+				rand_bytes(hb[i], RLC_MD_LEN);
+				mb[i] = hb[i];
+				lb[i] = RLC_MD_LEN;
+				TEST_ASSERT(cp_bls_gen(d, qb[i]) == RLC_OK, end);
+				TEST_ASSERT(cp_bls_sig(sb[i], mb[i], lb[i], d) == RLC_OK, end);
+			}
+			TEST_ASSERT(cp_bls_agg_sig(s, sb, 4) == RLC_OK, end);
+			TEST_ASSERT(cp_bls_agg_ver(s, mb, lb, qb, 4) == 1, end);
+			TEST_ASSERT(cp_bls_agg_ver(s, mb, lb, qb, 3) == 0, end);
+			TEST_ASSERT(cp_bls_ver_batch(vb, sb, mb, lb, qb, 4) == 1, end);
+			/* Check a swapped pair of signatures. */
+			g1_copy(s, sb[0]);
+			g1_copy(sb[0], sb[1]);
+			g1_copy(sb[1], s);
+			TEST_ASSERT(cp_bls_ver_batch(vb, sb, mb, lb, qb, 4) == 0, end);
+			TEST_ASSERT(vb[0] == 0 && vb[1] == 0, end);
+			TEST_ASSERT(vb[2] == 1 && vb[3] == 1, end);
+			g2_set_infty(qb[3]);
+			TEST_ASSERT(cp_bls_agg_ver(s, mb, lb, qb, 4) == 0, end);
+			TEST_ASSERT(cp_bls_agg_ver(s, mb, lb, qb, 0) == 0, end);
+			g1_set_infty(s);
+			TEST_ASSERT(cp_bls_agg_ver(s, mb, lb, qb, 1) == 0, end);
+			/* Check that a repeated message is rejected even if the
+			 * aggregate verification equation holds. */
+			TEST_ASSERT(cp_bls_gen(d, qb[0]) == RLC_OK, end);
+			TEST_ASSERT(cp_bls_sig(sb[0], mb[0], lb[0], d) == RLC_OK, end);
+			g2_copy(qb[1], qb[0]);
+			g1_copy(sb[1], sb[0]);
+			mb[1] = mb[0];
+			TEST_ASSERT(cp_bls_agg_sig(s, sb, 2) == RLC_OK, end);
+			TEST_ASSERT(cp_bls_agg_ver(s, mb, lb, qb, 2) == 0, end);
+		}
+		TEST_END;
+
+		TEST_CASE("boneh-lynn-schacham fast aggregate verification is correct") {
+			for (int i = 0; i < 4; i++) {
+				TEST_ASSERT(cp_bls_gen(d, qb[i]) == RLC_OK, end);
+				TEST_ASSERT(cp_bls_sig(sb[i], m, sizeof(m), d) == RLC_OK, end);
+			}
+			TEST_ASSERT(cp_bls_agg_sig(s, sb, 4) == RLC_OK, end);
+			TEST_ASSERT(cp_bls_fast_ver(s, m, sizeof(m), qb, 4) == 1, end);
+			TEST_ASSERT(cp_bls_fast_ver(s, m, sizeof(m), qb, 3) == 0, end);
+			m[0] ^= 1;
+			TEST_ASSERT(cp_bls_fast_ver(s, m, sizeof(m), qb, 4) == 0, end);
+			/* The identity must not verify for an empty signer set. */
+			g1_set_infty(s);
+			TEST_ASSERT(cp_bls_fast_ver(s, m, sizeof(m), qb, 0) == 0, end);
+			/* Nor for keys cancelling each other in the aggregate. */
+			g2_neg(qb[1], qb[0]);
+			TEST_ASSERT(cp_bls_fast_ver(s, m, sizeof(m), qb, 2) == 0, end);
+			g2_set_infty(qb[1]);
+			TEST_ASSERT(cp_bls_fast_ver(s, m, sizeof(m), qb, 2) == 0, end);
+		}
+		TEST_END;
 	}
 	RLC_CATCH_ANY {
 		RLC_ERROR(end);
@@ -1510,6 +1810,10 @@ static int bls(void) {
 	bn_free(d);
 	g1_free(s);
 	g2_free(q);
+	for (int i = 0; i < 4; i++) {
+		g1_free(sb[i]);
+		g2_free(qb[i]);
+	}
 	return code;
 }
 
@@ -2295,32 +2599,32 @@ static int psi(void) {
 
 int main(void) {
 
-	// if (core_init() != RLC_OK) {
-	// 	core_clean();
-	// 	return 1;
-	// }
+	if (core_init() != RLC_OK) {
+		core_clean();
+		return 1;
+	}
 
 	util_banner("Tests for the CP module", 0);
 
-#if 0
-// #if defined(WITH_BN)
+#if defined(WITH_BN)
 	util_banner("Protocols based on integer factorization:\n", 0);
 	if (rsa() != RLC_OK) {
 		core_clean();
 		return 1;
 	}
 
-	if (rabin() != RLC_OK) {
+	if (paillier() != RLC_OK) {
 		core_clean();
 		return 1;
 	}
 
-	if (benaloh() != RLC_OK) {
+#if 0
+	if (rabin() != RLC_OK) {
 		core_clean();
 		return 1;
 	}
 
-	if (paillier() != RLC_OK) {
+	if (benaloh() != RLC_OK) {
 		core_clean();
 		return 1;
 	}
@@ -2330,6 +2634,7 @@ int main(void) {
 		return 1;
 	}
 #endif
+#endif
 
 #if defined(WITH_EC)
 	util_banner("Protocols based on elliptic curves:\n", 0);
@@ -2394,77 +2699,88 @@ int main(void) {
 	}
 #endif
 
-// #if defined(WITH_PC)
-#if 0
-	util_banner("Protocols based on pairings:\n", 0);
-	if (pc_param_set_any() == RLC_OK) {
-
-		if (pdpub() != RLC_OK) {
+#if defined(WITH_ED)
+	util_banner("Protocols based on Edwards curves:\n", 0);
+	if (ed_param_set_any() == RLC_OK) {
+		if (eddsa() != RLC_OK) {
 			core_clean();
 			return 1;
 		}
+	} else {
+		util_print("Skipped: no Edwards curve with FP_PRIME = %d, "
+				"build with FP_PRIME = 255 to test EdDSA.\n", FP_PRIME);
+	}
+#endif
 
-		if (pdprv() != RLC_OK) {
-			core_clean();
-			return 1;
-		}
+#if defined(WITH_PC)
+	util_banner("Protocols based on pairings:\n", 0);
+	if (pc_param_set_any() == RLC_OK) {
 
-		if (sokaka() != RLC_OK) {
-			core_clean();
-			return 1;
-		}
+	// 	if (pdpub() != RLC_OK) {
+	// 		core_clean();
+	// 		return 1;
+	// 	}
 
-		if (ibe() != RLC_OK) {
-			core_clean();
-			return 1;
-		}
+	// 	if (pdprv() != RLC_OK) {
+	// 		core_clean();
+	// 		return 1;
+	// 	}
 
-		if (bgn() != RLC_OK) {
-			core_clean();
-			return 1;
-		}
+	// 	if (sokaka() != RLC_OK) {
+	// 		core_clean();
+	// 		return 1;
+	// 	}
+
+	// 	if (ibe() != RLC_OK) {
+	// 		core_clean();
+	// 		return 1;
+	// 	}
+
+	// 	if (bgn() != RLC_OK) {
+	// 		core_clean();
+	// 		return 1;
+	// 	}
 
 		if (bls() != RLC_OK) {
 			core_clean();
 			return 1;
 		}
 
-		if (bbs() != RLC_OK) {
-			core_clean();
-			return 1;
-		}
+	// 	if (bbs() != RLC_OK) {
+	// 		core_clean();
+	// 		return 1;
+	// 	}
 
-		if (cls() != RLC_OK) {
-			core_clean();
-			return 1;
-		}
+	// 	if (cls() != RLC_OK) {
+	// 		core_clean();
+	// 		return 1;
+	// 	}
 
-		if (pss() != RLC_OK) {
-			core_clean();
-			return 1;
-		}
+	// 	if (pss() != RLC_OK) {
+	// 		core_clean();
+	// 		return 1;
+	// 	}
 
-#if defined(WITH_MPC)
-		if (mpss() != RLC_OK) {
-			core_clean();
-			return 1;
-		}
-#endif
+// #if defined(WITH_MPC)
+	// 	if (mpss() != RLC_OK) {
+	// 		core_clean();
+	// 		return 1;
+	// 	}
+// #endif
 
-		if (zss() != RLC_OK) {
-			core_clean();
-			return 1;
-		}
+	// 	if (zss() != RLC_OK) {
+	// 		core_clean();
+	// 		return 1;
+	// 	}
 
-		if (lhs() != RLC_OK) {
-			core_clean();
-			return 1;
-		}
+	// 	if (lhs() != RLC_OK) {
+	// 		core_clean();
+	// 		return 1;
+	// 	}
 	}
 #endif
 
-#if 0
-// #if defined(WITH_BN) && defined(WITH_PC)
+#if defined(WITH_BN) && defined(WITH_PC)
 	util_banner("Protocols based on accumulators:\n", 0);
 	if (pc_param_set_any() == RLC_OK) {
 		if (psi() != RLC_OK) {
@@ -1173,6 +1173,36 @@ static int simultaneous(void) {
 			ed_mul_sim_lot(p[16], p, k, 16);
 			TEST_ASSERT(ed_cmp(p[16], r) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_CASE("bucket method for many point multiplications is correct") {
+			ed_set_infty(r);
+			ed_mul_sim_lot_bucket(p[16], p, k, 0);
+			TEST_ASSERT(ed_cmp(p[16], r) == RLC_EQ, end);
+			for (int j = 0; j < 16; j++) {
+				bn_rand_mod(k[j], n);
+				ed_rand(p[j]);
+				ed_mul(p[16], p[j], k[j]);
+				ed_add(r, r, p[16]);
+				ed_mul_sim_lot_bucket(p[16], p, k, j + 1);
+				TEST_ASSERT(ed_cmp(p[16], r) == RLC_EQ, end);
+			}
+			ed_mul(p[16], p[0], k[0]);
+			ed_sub(r, r, p[16]);
+			bn_zero(k[0]);
+			ed_mul_sim_lot_bucket(p[16], p, k, 16);
+			TEST_ASSERT(ed_cmp(p[16], r) == RLC_EQ, end);
+			ed_mul(p[16], p[1], k[1]);
+			ed_sub(r, r, p[16]);
+			ed_sub(r, r, p[16]);
+			bn_neg(k[1], k[1]);
+			ed_mul_sim_lot_bucket(p[16], p, k, 16);
+			TEST_ASSERT(ed_cmp(p[16], r) == RLC_EQ, end);
+			bn_add(k[2], k[2], n);
+			ed_mul_sim_lot_bucket(p[16], p, k, 16);
+			TEST_ASSERT(ed_cmp(p[16], r) == RLC_EQ, end);
+			ed_mul_sim_lot_inter(r, p, k, 16);
+			TEST_ASSERT(ed_cmp(p[16], r) == RLC_EQ, end);
+		} TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -839,6 +839,23 @@ static int fixed(void) {
 			ep_mul_fix(r, (const ep_t *)t, k);
 			TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_CASE("fixed point multiplication with a stored table is correct") {
+			uint8_t *bin = RLC_ALLOCA(uint8_t, ep_size_pre());
+			TEST_ASSERT(bin != NULL, end);
+			ep_rand(p);
+			ep_mul_pre(t, p);
+			ep_write_pre(bin, ep_size_pre(), (const ep_t *)t);
+			for (int i = 0; i < RLC_EP_TABLE; i++) {
+				ep_set_infty(t[i]);
+			}
+			ep_read_pre(t, bin, ep_size_pre());
+			RLC_FREE(bin);
+			bn_rand_mod(k, n);
+			ep_mul_fix(q, (const ep_t *)t, k);
+			ep_mul(r, p, k);
+			TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
+		} TEST_END;
 		for (int i = 0; i < RLC_EP_TABLE; i++) {
 			ep_free(t[i]);
 		}
@@ -1286,6 +1303,36 @@ static int simultaneous(void) {
 			ep_mul_sim_lot(p[16], p, k, 16);
 			TEST_ASSERT(ep_cmp(p[16], r) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_CASE("bucket method for many point multiplications is correct") {
+			ep_set_infty(r);
+			ep_mul_sim_lot_bucket(p[16], p, k, 0);
+			TEST_ASSERT(ep_cmp(p[16], r) == RLC_EQ, end);
+			for (int j = 0; j < 16; j++) {
+				bn_rand_mod(k[j], n);
+				ep_rand(p[j]);
+				ep_mul(p[16], p[j], k[j]);
+				ep_add(r, r, p[16]);
+				ep_mul_sim_lot_bucket(p[16], p, k, j + 1);
+				TEST_ASSERT(ep_cmp(p[16], r) == RLC_EQ, end);
+			}
+			ep_mul(p[16], p[0], k[0]);
+			ep_sub(r, r, p[16]);
+			bn_zero(k[0]);
+			ep_mul_sim_lot_bucket(p[16], p, k, 16);
+			TEST_ASSERT(ep_cmp(p[16], r) == RLC_EQ, end);
+			ep_mul(p[16], p[1], k[1]);
+			ep_sub(r, r, p[16]);
+			ep_sub(r, r, p[16]);
+			bn_neg(k[1], k[1]);
+			ep_mul_sim_lot_bucket(p[16], p, k, 16);
+			TEST_ASSERT(ep_cmp(p[16], r) == RLC_EQ, end);
+			bn_add(k[2], k[2], n);
+			ep_mul_sim_lot_bucket(p[16], p, k, 16);
+			TEST_ASSERT(ep_cmp(p[16], r) == RLC_EQ, end);
+			ep_mul_sim_lot_inter(r, p, k, 16);
+			TEST_ASSERT(ep_cmp(p[16], r) == RLC_EQ, end);
+		} TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -1304,16 +1351,25 @@ static int simultaneous(void) {
 
 static int compression(void) {
 	int code = RLC_ERR;
-	ep_t a, b, c;
+	ep_t a, b, c, d[11], e[11];
+	int r;
 
 	ep_null(a);
 	ep_null(b);
 	ep_null(c);
+	for (int j = 0; j < 11; j++) {
+		ep_null(d[j]);
+		ep_null(e[j]);
+	}
 
 	RLC_TRY {
 		ep_new(a);
 		ep_new(b);
 		ep_new(c);
+		for (int j = 0; j < 11; j++) {
+			ep_new(d[j]);
+			ep_new(e[j]);
+		}
 
 		TEST_CASE("point compression is correct") {
 			ep_rand(a);
@@ -1322,6 +1378,23 @@ static int compression(void) {
 			TEST_ASSERT(ep_cmp(a, c) == RLC_EQ, end);
 		}
 		TEST_END;
+
+		TEST_CASE("batch point compression is correct") {
+			for (int j = 0; j < 11; j++) {
+				ep_rand(d[j]);
+				ep_pck(e[j], d[j]);
+			}
+			TEST_ASSERT(ep_upk_many(e, (const ep_t *)e, 11) == 1, end);
+			for (int j = 0; j < 11; j++) {
+				TEST_ASSERT(ep_cmp(d[j], e[j]) == RLC_EQ, end);
+				ep_pck(e[j], d[j]);
+			}
+			/* The batch fails exactly when the bad abscissa fails alone. */
+			fp_rand(e[4]->x);
+			r = ep_upk(c, e[4]);
+			TEST_ASSERT(ep_upk_many(d, (const ep_t *)e, 11) == r, end);
+		}
+		TEST_END;
 	}
 	RLC_CATCH_ANY {
 		RLC_ERROR(end);
@@ -1331,6 +1404,10 @@ static int compression(void) {
 	ep_free(a);
 	ep_free(b);
 	ep_free(c);
+	for (int j = 0; j < 11; j++) {
+		ep_free(d[j]);
+		ep_free(e[j]);
+	}
 	return code;
 }
 
@@ -1338,17 +1415,26 @@ static int hashing(void) {
 	int code = RLC_ERR;
 	ep_t a;
 	ep_t b;
+	ep_t c[17];
 	bn_t n;
-	uint8_t msg[5];
+	uint8_t msg[5], buf[17][40];
+	const uint8_t *m[17];
+	int l[17];
 
 	ep_null(a);
 	ep_null(b);
 	bn_null(n);
+	for (int i = 0; i < 17; i++) {
+		ep_null(c[i]);
+	}
 
 	RLC_TRY {
 		ep_new(a);
 		ep_new(b);
 		bn_new(n);
+		for (int i = 0; i < 17; i++) {
+			ep_new(c[i]);
+		}
 
 		ep_curve_get_ord(n);
 
@@ -1362,6 +1448,20 @@ static int hashing(void) {
 			TEST_ASSERT(ep_is_infty(a) == 1, end);
 		}
 		TEST_END;
+
+		TEST_CASE("point hashing of several messages is correct") {
+			rand_bytes(buf[0], sizeof(buf));
+			for (int i = 0; i < 17; i++) {
+				m[i] = buf[i];
+				l[i] = (i * 7) % 40;
+			}
+			ep_map_dst_many(c, m, l, 17, (const uint8_t *)"RELIC", 5);
+			for (int i = 0; i < 17; i++) {
+				ep_map_dst(a, m[i], l[i], (const uint8_t *)"RELIC", 5);
+				TEST_ASSERT(ep_cmp(a, c[i]) == RLC_EQ, end);
+			}
+		}
+		TEST_END;
 	}
 	RLC_CATCH_ANY {
 		RLC_ERROR(end);
@@ -1371,6 +1471,9 @@ static int hashing(void) {
 	ep_free(a);
 	ep_free(b);
 	bn_free(n);
+	for (int i = 0; i < 17; i++) {
+		ep_free(c[i]);
+	}
 	return code;
 }
 
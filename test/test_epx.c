@@ -645,6 +645,23 @@ static int fixed2(void) {
 			ep2_mul_fix(r, t, k);
 			TEST_ASSERT(ep2_cmp(q, r) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_CASE("fixed point multiplication with a stored table is correct") {
+			uint8_t *bin = RLC_ALLOCA(uint8_t, ep2_size_pre());
+			TEST_ASSERT(bin != NULL, end);
+			ep2_rand(p);
+			ep2_mul_pre(t, p);
+			ep2_write_pre(bin, ep2_size_pre(), t);
+			for (int i = 0; i < RLC_EP_TABLE; i++) {
+				ep2_set_infty(t[i]);
+			}
+			ep2_read_pre(t, bin, ep2_size_pre());
+			RLC_FREE(bin);
+			bn_rand_mod(k, n);
+			ep2_mul_fix(q, t, k);
+			ep2_mul(r, p, k);
+			TEST_ASSERT(ep2_cmp(q, r) == RLC_EQ, end);
+		} TEST_END;
 		for (int i = 0; i < RLC_EP_TABLE; i++) {
 			ep2_free(t[i]);
 		}
@@ -1045,6 +1062,34 @@ static int simultaneous2(void) {
 			ep2_mul_sim_lot(p[16], p, k, 16);
 			TEST_ASSERT(ep2_cmp(p[16], r) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_CASE("bucket method for many point multiplications is correct") {
+			ep2_set_infty(r);
+			for (int j = 0; j < 16; j++) {
+				bn_rand_mod(k[j], n);
+				ep2_rand(p[j]);
+				ep2_mul(p[16], p[j], k[j]);
+				ep2_add(r, r, p[16]);
+				ep2_mul_sim_lot_bucket(p[16], p, k, j + 1);
+				TEST_ASSERT(ep2_cmp(p[16], r) == RLC_EQ, end);
+			}
+			ep2_mul(p[16], p[0], k[0]);
+			ep2_sub(r, r, p[16]);
+			bn_zero(k[0]);
+			ep2_mul_sim_lot_bucket(p[16], p, k, 16);
+			TEST_ASSERT(ep2_cmp(p[16], r) == RLC_EQ, end);
+			ep2_mul(p[16], p[1], k[1]);
+			ep2_sub(r, r, p[16]);
+			ep2_sub(r, r, p[16]);
+			bn_neg(k[1], k[1]);
+			ep2_mul_sim_lot_bucket(p[16], p, k, 16);
+			TEST_ASSERT(ep2_cmp(p[16], r) == RLC_EQ, end);
+			bn_add(k[2], k[2], n);
+			ep2_mul_sim_lot_bucket(p[16], p, k, 16);
+			TEST_ASSERT(ep2_cmp(p[16], r) == RLC_EQ, end);
+			ep2_mul_sim_lot_inter(r, p, k, 16);
+			TEST_ASSERT(ep2_cmp(p[16], r) == RLC_EQ, end);
+		} TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -1063,16 +1108,25 @@ static int simultaneous2(void) {
 
 static int compression2(void) {
 	int code = RLC_ERR;
-	ep2_t a, b, c;
+	ep2_t a, b, c, d[11], e[11];
+	int r;
 
 	ep2_null(a);
 	ep2_null(b);
 	ep2_null(c);
+	for (int j = 0; j < 11; j++) {
+		ep2_null(d[j]);
+		ep2_null(e[j]);
+	}
 
 	RLC_TRY {
 		ep2_new(a);
 		ep2_new(b);
 		ep2_new(c);
+		for (int j = 0; j < 11; j++) {
+			ep2_new(d[j]);
+			ep2_new(e[j]);
+		}
 
 		TEST_CASE("point compression is correct") {
 			ep2_rand(a);
@@ -1081,6 +1135,23 @@ static int compression2(void) {
 			TEST_ASSERT(ep2_cmp(a, c) == RLC_EQ, end);
 		}
 		TEST_END;
+
+		TEST_CASE("batch point compression is correct") {
+			for (int j = 0; j < 11; j++) {
+				ep2_rand(d[j]);
+				ep2_pck(e[j], d[j]);
+			}
+			TEST_ASSERT(ep2_upk_many(e, (const ep2_t *)e, 11) == 1, end);
+			for (int j = 0; j < 11; j++) {
+				TEST_ASSERT(ep2_cmp(d[j], e[j]) == RLC_EQ, end);
+				ep2_pck(e[j], d[j]);
+			}
+			/* The batch fails exactly when the bad abscissa fails alone. */
+			fp2_rand(e[4]->x);
+			r = ep2_upk(c, e[4]);
+			TEST_ASSERT(ep2_upk_many(d, (const ep2_t *)e, 11) == r, end);
+		}
+		TEST_END;
 	}
 	RLC_CATCH_ANY {
 		RLC_ERROR(end);
@@ -1090,6 +1161,10 @@ static int compression2(void) {
 	ep2_free(a);
 	ep2_free(b);
 	ep2_free(c);
+	for (int j = 0; j < 11; j++) {
+		ep2_free(d[j]);
+		ep2_free(e[j]);
+	}
 	return code;
 }
 
@@ -1098,16 +1173,25 @@ static int hashing2(void) {
 	bn_t n;
 	ep2_t p;
 	ep2_t q;
-	uint8_t msg[5];
+	ep2_t r[17];
+	uint8_t msg[5], buf[17][40];
+	const uint8_t *m[17];
+	int l[17];
 
 	bn_null(n);
 	ep2_null(p);
 	ep2_null(q);
+	for (int i = 0; i < 17; i++) {
+		ep2_null(r[i]);
+	}
 
 	RLC_TRY {
 		bn_new(n);
 		ep2_new(p);
 		ep2_new(q);
+		for (int i = 0; i < 17; i++) {
+			ep2_new(r[i]);
+		}
 
 		ep2_curve_get_ord(n);
 
@@ -1121,6 +1205,20 @@ static int hashing2(void) {
 			TEST_ASSERT(ep2_is_infty(p) == 1, end);
 		}
 		TEST_END;
+
+		TEST_CASE("point hashing of several messages is correct") {
+			rand_bytes(buf[0], sizeof(buf));
+			for (int i = 0; i < 17; i++) {
+				m[i] = buf[i];
+				l[i] = (i * 7) % 40;
+			}
+			ep2_map_dst_many(r, m, l, 17, (const uint8_t *)"RELIC", 5);
+			for (int i = 0; i < 17; i++) {
+				ep2_map_dst(p, m[i], l[i], (const uint8_t *)"RELIC", 5);
+				TEST_ASSERT(ep2_cmp(p, r[i]) == RLC_EQ, end);
+			}
+		}
+		TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -1131,6 +1229,9 @@ static int hashing2(void) {
 	bn_free(n);
 	ep2_free(p);
 	ep2_free(q);
+	for (int i = 0; i < 17; i++) {
+		ep2_free(r[i]);
+	}
 	return code;
 }
 
@@ -1941,6 +2042,21 @@ static int simultaneous4(void) {
 			TEST_ASSERT(ep4_cmp(p[1], r) == RLC_EQ, end);
 		} TEST_END;
 
+		TEST_CASE("bucket method for many point multiplications is correct") {
+			bn_rand_mod(k[0], n);
+			bn_rand_mod(k[1], n);
+			ep4_rand(p[0]);
+			ep4_rand(p[1]);
+			ep4_mul_sim(r, p[0], k[0], p[1], k[1]);
+			ep4_mul_sim_lot_bucket(p[1], p, k, 2);
+			TEST_ASSERT(ep4_cmp(p[1], r) == RLC_EQ, end);
+			bn_neg(k[0], k[0]);
+			bn_add(k[1], k[1], n);
+			ep4_mul_sim(r, p[0], k[0], p[1], k[1]);
+			ep4_mul_sim_lot_bucket(p[1], p, k, 2);
+			TEST_ASSERT(ep4_cmp(p[1], r) == RLC_EQ, end);
+		} TEST_END;
+
 #if EP_SIM == BASIC || !defined(STRIP)
 		TEST_CASE("basic simultaneous point multiplication is correct") {
 			bn_zero(k[0]);
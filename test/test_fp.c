@@ -373,7 +373,7 @@ static int subtraction(void) {
 
 static int multiplication(void) {
 	int code = RLC_ERR;
-	fp_t a, b, c, d, e, f;
+	fp_t a, b, c, d, e, f, g[8], h[8], k[8];
 
 	fp_null(a);
 	fp_null(b);
@@ -381,6 +381,11 @@ static int multiplication(void) {
 	fp_null(d);
 	fp_null(e);
 	fp_null(f);
+	for (int j = 0; j < 8; j++) {
+		fp_null(g[j]);
+		fp_null(h[j]);
+		fp_null(k[j]);
+	}
 
 	RLC_TRY {
 		fp_new(a);
@@ -389,6 +394,11 @@ static int multiplication(void) {
 		fp_new(d);
 		fp_new(e);
 		fp_new(f);
+		for (int j = 0; j < 8; j++) {
+			fp_new(g[j]);
+			fp_new(h[j]);
+			fp_new(k[j]);
+		}
 
 		TEST_CASE("multiplication is commutative") {
 			fp_rand(a);
@@ -435,6 +445,27 @@ static int multiplication(void) {
 			TEST_ASSERT(fp_is_zero(e), end);
 		} TEST_END;
 
+		TEST_CASE("multiplication of eight elements is correct") {
+			for (int j = 0; j < 8; j++) {
+				fp_rand(g[j]);
+				fp_rand(h[j]);
+			}
+			fp_mul_x8(k, (const fp_t *)g, (const fp_t *)h);
+			for (int j = 0; j < 8; j++) {
+				fp_mul(d, g[j], h[j]);
+				TEST_ASSERT(fp_cmp(k[j], d) == RLC_EQ, end);
+			}
+			fp_copy(e, g[1]);
+			fp_zero(h[0]);
+			fp_set_dig(h[1], 1);
+			fp_mul_x8(g, (const fp_t *)g, (const fp_t *)h);
+			TEST_ASSERT(fp_is_zero(g[0]), end);
+			TEST_ASSERT(fp_cmp(g[1], e) == RLC_EQ, end);
+			for (int j = 2; j < 8; j++) {
+				TEST_ASSERT(fp_cmp(g[j], k[j]) == RLC_EQ, end);
+			}
+		} TEST_END;
+
 #if FP_MUL == BASIC || !defined(STRIP)
 		TEST_CASE("basic multiplication is correct") {
 			fp_rand(a);
@@ -490,6 +521,11 @@ static int multiplication(void) {
 	fp_free(d);
 	fp_free(e);
 	fp_free(f);
+	for (int j = 0; j < 8; j++) {
+		fp_free(g[j]);
+		fp_free(h[j]);
+		fp_free(k[j]);
+	}
 	return code;
 }
 
@@ -774,6 +810,161 @@ static int reduction(void) {
 	return code;
 }
 
+static int batch(void) {
+	int code = RLC_ERR;
+	/* Use enough elements for both the eight-lane path and the leftovers. */
+	fp_t a[11], b[11], c[11], d;
+	dv_t t[11];
+	bn_t e;
+	int f[11];
+
+	bn_null(e);
+	fp_null(d);
+	for (int j = 0; j < 11; j++) {
+		fp_null(a[j]);
+		fp_null(b[j]);
+		fp_null(c[j]);
+		dv_null(t[j]);
+	}
+
+	RLC_TRY {
+		bn_new(e);
+		fp_new(d);
+		for (int j = 0; j < 11; j++) {
+			fp_new(a[j]);
+			fp_new(b[j]);
+			fp_new(c[j]);
+			dv_new(t[j]);
+			dv_zero(t[j], 2 * RLC_FP_DIGS);
+		}
+
+		TEST_CASE("batch addition is correct") {
+			for (int j = 0; j < 11; j++) {
+				fp_rand(a[j]);
+				fp_rand(b[j]);
+			}
+			fp_add_many(c, (const fp_t *)a, (const fp_t *)b, 11);
+			for (int j = 0; j < 11; j++) {
+				fp_add(d, a[j], b[j]);
+				TEST_ASSERT(fp_cmp(c[j], d) == RLC_EQ, end);
+			}
+		} TEST_END;
+
+		TEST_CASE("batch subtraction is correct") {
+			for (int j = 0; j < 11; j++) {
+				fp_rand(a[j]);
+				fp_rand(b[j]);
+			}
+			fp_sub_many(c, (const fp_t *)a, (const fp_t *)b, 11);
+			for (int j = 0; j < 11; j++) {
+				fp_sub(d, a[j], b[j]);
+				TEST_ASSERT(fp_cmp(c[j], d) == RLC_EQ, end);
+			}
+		} TEST_END;
+
+		TEST_CASE("batch multiplication is correct") {
+			for (int j = 0; j < 11; j++) {
+				fp_rand(a[j]);
+				fp_rand(b[j]);
+			}
+			fp_mul_many(c, (const fp_t *)a, (const fp_t *)b, 11);
+			for (int j = 0; j < 11; j++) {
+				fp_mul(d, a[j], b[j]);
+				TEST_ASSERT(fp_cmp(c[j], d) == RLC_EQ, end);
+			}
+			fp_mul_many(a, (const fp_t *)a, (const fp_t *)b, 11);
+			for (int j = 0; j < 11; j++) {
+				TEST_ASSERT(fp_cmp(a[j], c[j]) == RLC_EQ, end);
+			}
+		} TEST_END;
+
+		TEST_CASE("batch squaring is correct") {
+			for (int j = 0; j < 11; j++) {
+				fp_rand(a[j]);
+			}
+			fp_sqr_many(c, (const fp_t *)a, 11);
+			for (int j = 0; j < 11; j++) {
+				fp_sqr(d, a[j]);
+				TEST_ASSERT(fp_cmp(c[j], d) == RLC_EQ, end);
+			}
+			fp_sqr_many(a, (const fp_t *)a, 11);
+			for (int j = 0; j < 11; j++) {
+				TEST_ASSERT(fp_cmp(a[j], c[j]) == RLC_EQ, end);
+			}
+		} TEST_END;
+
+		TEST_CASE("batch modular reduction is correct") {
+			for (int j = 0; j < 11; j++) {
+				fp_rand(a[j]);
+				fp_rand(b[j]);
+				fp_muln_low(t[j], a[j], b[j]);
+			}
+			fp_rdc_many(c, t, 11);
+			for (int j = 0; j < 11; j++) {
+				fp_mul(d, a[j], b[j]);
+				TEST_ASSERT(fp_cmp(c[j], d) == RLC_EQ, end);
+			}
+		} TEST_END;
+
+		TEST_CASE("batch exponentiation is correct") {
+			bn_rand(e, RLC_POS, RLC_FP_BITS);
+			for (int j = 0; j < 11; j++) {
+				fp_rand(a[j]);
+			}
+			fp_exp_many(c, (const fp_t *)a, e, 11);
+			for (int j = 0; j < 11; j++) {
+				fp_exp(d, a[j], e);
+				TEST_ASSERT(fp_cmp(c[j], d) == RLC_EQ, end);
+			}
+			bn_neg(e, e);
+			fp_exp_many(c, (const fp_t *)a, e, 11);
+			for (int j = 0; j < 11; j++) {
+				fp_exp(d, a[j], e);
+				TEST_ASSERT(fp_cmp(c[j], d) == RLC_EQ, end);
+			}
+		} TEST_END;
+
+		TEST_CASE("batch square root extraction is correct") {
+			for (int j = 0; j < 11; j++) {
+				fp_rand(a[j]);
+				fp_sqr(b[j], a[j]);
+			}
+			fp_zero(b[3]);
+			TEST_ASSERT(fp_srt_many(c, f, (const fp_t *)b, 11), end);
+			for (int j = 0; j < 11; j++) {
+				TEST_ASSERT(f[j] == 1, end);
+				fp_sqr(d, c[j]);
+				TEST_ASSERT(fp_cmp(d, b[j]) == RLC_EQ, end);
+			}
+			for (int j = 0; j < 11; j++) {
+				fp_rand(a[j]);
+			}
+			fp_srt_many(c, f, (const fp_t *)a, 11);
+			for (int j = 0; j < 11; j++) {
+				TEST_ASSERT(f[j] == fp_srt(d, a[j]), end);
+				if (f[j]) {
+					fp_sqr(d, c[j]);
+					TEST_ASSERT(fp_cmp(d, a[j]) == RLC_EQ, end);
+				}
+			}
+		} TEST_END;
+	}
+	RLC_CATCH_ANY {
+		RLC_ERROR(end);
+	}
+	code = RLC_OK;
+  end:
+	bn_free(e);
+	fp_free(d);
+	for (int j = 0; j < 11; j++) {
+		fp_free(a[j]);
+		fp_free(b[j]);
+		fp_free(c[j]);
+		dv_free(t[j]);
+	}
+	return code;
+}
+
 static int inversion(void) {
 	int code = RLC_ERR;
 	fp_t a, b, c, d[2];
@@ -1213,6 +1404,11 @@ int main(void) {
 		return 1;
 	}
 
+	if (batch() != RLC_OK) {
+		core_clean();
+		return 1;
+	}
+
 	if (inversion() != RLC_OK) {
 		core_clean();
 		return 1;
@@ -566,6 +566,14 @@ static int squaring2(void) {
 			TEST_ASSERT(fp2_cmp(b, c) == RLC_EQ, end);
 		} TEST_END;
 #endif
+
+		TEST_CASE("cyclotomic squaring is correct") {
+			fp2_rand(a);
+			fp2_conv_cyc(a, a);
+			fp2_sqr(b, a);
+			fp2_sqr_cyc(c, a);
+			TEST_ASSERT(fp2_cmp(b, c) == RLC_EQ, end);
+		} TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -639,19 +647,27 @@ static int inversion2(void) {
 
 static int exponentiation2(void) {
 	int code = RLC_ERR;
-	fp2_t a, b, c;
-	bn_t d;
+	fp2_t a, b, c, e[2];
+	bn_t d, f[2];
 
 	fp2_null(a);
 	fp2_null(b);
 	fp2_null(c);
 	bn_null(d);
+	for (int j = 0; j < 2; j++) {
+		fp2_null(e[j]);
+		bn_null(f[j]);
+	}
 
 	RLC_TRY {
 		fp2_new(a);
 		fp2_new(b);
 		fp2_new(c);
 		bn_new(d);
+		for (int j = 0; j < 2; j++) {
+			fp2_new(e[j]);
+			bn_new(f[j]);
+		}
 
 		TEST_CASE("exponentiation is correct") {
 			fp2_rand(a);
@@ -693,6 +709,23 @@ static int exponentiation2(void) {
 			fp2_exp_cyc(c, a, d);
 			TEST_ASSERT(fp2_cmp(b, c) == RLC_EQ, end);
         } TEST_END;
+
+		TEST_CASE("simultaneous exponentiation of many elements is correct") {
+			fp2_set_dig(c, 1);
+			for (int j = 0; j < 2; j++) {
+				fp2_rand(e[j]);
+				fp2_conv_cyc(e[j], e[j]);
+				bn_rand(f[j], RLC_POS, RLC_FP_BITS);
+				fp2_exp(b, e[j], f[j]);
+				fp2_mul(c, c, b);
+			}
+			bn_neg(f[1], f[1]);
+			fp2_inv(b, b);
+			fp2_mul(c, c, b);
+			fp2_mul(c, c, b);
+			fp2_exp_cyc_lot(a, e, f, 2);
+			TEST_ASSERT(fp2_cmp(a, c) == RLC_EQ, end);
+		} TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -704,6 +737,10 @@ static int exponentiation2(void) {
 	fp2_free(b);
 	fp2_free(c);
 	bn_free(d);
+	for (int j = 0; j < 2; j++) {
+		fp2_free(e[j]);
+		bn_free(f[j]);
+	}
 	return code;
 }
 
@@ -771,17 +808,25 @@ static int compression2(void) {
 
 static int square_root2(void) {
 	int code = RLC_ERR;
-	fp2_t a, b, c;
-	int r;
+	fp2_t a, b, c, d[11], e[11];
+	int r, f[11];
 
 	fp2_null(a);
 	fp2_null(b);
 	fp2_null(c);
+	for (int j = 0; j < 11; j++) {
+		fp2_null(d[j]);
+		fp2_null(e[j]);
+	}
 
 	RLC_TRY {
 		fp2_new(a);
 		fp2_new(b);
 		fp2_new(c);
+		for (int j = 0; j < 11; j++) {
+			fp2_new(d[j]);
+			fp2_new(e[j]);
+		}
 
 		TEST_CASE("square root extraction is correct") {
 			fp2_zero(a);
@@ -814,6 +859,32 @@ static int square_root2(void) {
 			TEST_ASSERT(fp2_cmp(b, a) == RLC_EQ ||
 					fp2_cmp(c, a) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_CASE("batch square root extraction is correct") {
+			for (int j = 0; j < 11; j++) {
+				fp2_rand(a);
+				fp2_sqr(d[j], a);
+			}
+			fp_zero(d[2][1]);
+			fp2_zero(d[5]);
+			TEST_ASSERT(fp2_srt_many(e, f, d, 11), end);
+			for (int j = 0; j < 11; j++) {
+				TEST_ASSERT(f[j] == 1, end);
+				fp2_sqr(c, e[j]);
+				TEST_ASSERT(fp2_cmp(c, d[j]) == RLC_EQ, end);
+			}
+			for (int j = 0; j < 11; j++) {
+				fp2_rand(d[j]);
+			}
+			fp2_srt_many(e, f, d, 11);
+			for (int j = 0; j < 11; j++) {
+				TEST_ASSERT(f[j] == fp2_srt(b, d[j]), end);
+				if (f[j]) {
+					fp2_sqr(c, e[j]);
+					TEST_ASSERT(fp2_cmp(c, d[j]) == RLC_EQ, end);
+				}
+			}
+		} TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -824,6 +895,10 @@ static int square_root2(void) {
 	fp2_free(a);
 	fp2_free(b);
 	fp2_free(c);
+	for (int j = 0; j < 11; j++) {
+		fp2_free(d[j]);
+		fp2_free(e[j]);
+	}
 	return code;
 }
 
@@ -4418,16 +4493,20 @@ static int cyclotomic12(void) {
 
 static int inversion12(void) {
 	int code = RLC_ERR;
-	fp12_t a, b, c;
+	fp12_t a, b, c, d[2];
 
 	fp12_null(a);
 	fp12_null(b);
 	fp12_null(c);
+	fp12_null(d[0]);
+	fp12_null(d[1]);
 
 	RLC_TRY {
 		fp12_new(a);
 		fp12_new(b);
 		fp12_new(c);
+		fp12_new(d[0]);
+		fp12_new(d[1]);
 
 		TEST_CASE("inversion is correct") {
 			do {
@@ -4447,6 +4526,20 @@ static int inversion12(void) {
 			fp12_inv_cyc(c, a);
 			TEST_ASSERT(fp12_cmp(b, c) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_CASE("simultaneous inversion is correct") {
+			do {
+				fp12_rand(a);
+				fp12_rand(b);
+			} while (fp12_is_zero(a) || fp12_is_zero(b));
+			fp12_copy(d[0], a);
+			fp12_copy(d[1], b);
+			fp12_inv(a, a);
+			fp12_inv(b, b);
+			fp12_inv_sim(d, d, 2);
+			TEST_ASSERT(fp12_cmp(d[0], a) == RLC_EQ &&
+					fp12_cmp(d[1], b) == RLC_EQ, end);
+		} TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -4457,6 +4550,8 @@ static int inversion12(void) {
 	fp12_free(a);
 	fp12_free(b);
 	fp12_free(c);
+	fp12_free(d[0]);
+	fp12_free(d[1]);
 	return code;
 }
 
@@ -5664,16 +5759,20 @@ static int cyclotomic24(void) {
 
 static int inversion24(void) {
 	int code = RLC_ERR;
-	fp24_t a, b, c;
+	fp24_t a, b, c, d[2];
 
 	fp24_null(a);
 	fp24_null(b);
 	fp24_null(c);
+	fp24_null(d[0]);
+	fp24_null(d[1]);
 
 	RLC_TRY {
 		fp24_new(a);
 		fp24_new(b);
 		fp24_new(c);
+		fp24_new(d[0]);
+		fp24_new(d[1]);
 
 		TEST_CASE("inversion is correct") {
 			do {
@@ -5683,6 +5782,20 @@ static int inversion24(void) {
 			fp24_mul(c, a, b);
 			TEST_ASSERT(fp24_cmp_dig(c, 1) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_CASE("simultaneous inversion is correct") {
+			do {
+				fp24_rand(a);
+				fp24_rand(b);
+			} while (fp24_is_zero(a) || fp24_is_zero(b));
+			fp24_copy(d[0], a);
+			fp24_copy(d[1], b);
+			fp24_inv(a, a);
+			fp24_inv(b, b);
+			fp24_inv_sim(d, d, 2);
+			TEST_ASSERT(fp24_cmp(d[0], a) == RLC_EQ &&
+					fp24_cmp(d[1], b) == RLC_EQ, end);
+		} TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -5693,6 +5806,8 @@ static int inversion24(void) {
 	fp24_free(a);
 	fp24_free(b);
 	fp24_free(c);
+	fp24_free(d[0]);
+	fp24_free(d[1]);
 	return code;
 }
 
@@ -6456,16 +6571,20 @@ static int cyclotomic48(void) {
 
 static int inversion48(void) {
 	int code = RLC_ERR;
-	fp48_t a, b, c;
+	fp48_t a, b, c, d[2];
 
 	fp48_null(a);
 	fp48_null(b);
 	fp48_null(c);
+	fp48_null(d[0]);
+	fp48_null(d[1]);
 
 	RLC_TRY {
 		fp48_new(a);
 		fp48_new(b);
 		fp48_new(c);
+		fp48_new(d[0]);
+		fp48_new(d[1]);
 
 		TEST_CASE("inversion is correct") {
 			do {
@@ -6485,6 +6604,20 @@ static int inversion48(void) {
 			fp48_inv_cyc(c, a);
 			TEST_ASSERT(fp48_cmp(b, c) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_CASE("simultaneous inversion is correct") {
+			do {
+				fp48_rand(a);
+				fp48_rand(b);
+			} while (fp48_is_zero(a) || fp48_is_zero(b));
+			fp48_copy(d[0], a);
+			fp48_copy(d[1], b);
+			fp48_inv(a, a);
+			fp48_inv(b, b);
+			fp48_inv_sim(d, d, 2);
+			TEST_ASSERT(fp48_cmp(d[0], a) == RLC_EQ &&
+					fp48_cmp(d[1], b) == RLC_EQ, end);
+		} TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -6495,6 +6628,8 @@ static int inversion48(void) {
 	fp48_free(a);
 	fp48_free(b);
 	fp48_free(c);
+	fp48_free(d[0]);
+	fp48_free(d[1]);
 	return code;
 }
 
@@ -209,6 +209,66 @@ static int sha256(void) {
 	}
 	TEST_END;
 
+	TEST_ONCE("sha256 hash function of several messages is correct") {
+		uint8_t buf[33][200], out[33][32], *dig[33];
+		const uint8_t *msg[33];
+		int len[33];
+
+		rand_bytes(buf[0], sizeof(buf));
+		for (i = 0; i < 33; i++) {
+			/* Cover the padding boundaries and unbalanced lanes. */
+			len[i] = (i * 53 + (i & 1) * 7) % 200;
+			msg[i] = buf[i];
+			dig[i] = out[i];
+		}
+		len[3] = 55;
+		len[4] = 56;
+		len[5] = 64;
+		md_map_sh256_many(dig, msg, len, 33);
+		for (i = 0; i < 33; i++) {
+			md_map_sh256(digest, msg[i], len[i]);
+			TEST_ASSERT(memcmp(digest, out[i], 32) == 0, end);
+		}
+	}
+	TEST_END;
+
+	TEST_ONCE("sha256 implementations are consistent") {
+		const int kernel[4] = {
+			RLC_MD_SH256_NI, RLC_MD_SH256_AVX2, RLC_MD_SH256_AVX512,
+			RLC_MD_SH256_SSE2
+		};
+		uint8_t buf[37][200], ref[37][32], out[37][32], *dig[37];
+		const uint8_t *msg[37];
+		int k, len[37];
+
+		rand_bytes(buf[0], sizeof(buf));
+		for (i = 0; i < 37; i++) {
+			len[i] = (i * 59 + (i & 1) * 9) % 200;
+			msg[i] = buf[i];
+			dig[i] = out[i];
+		}
+		/* Compute the reference digests with the portable code. */
+		md_sh256_set(0);
+		for (i = 0; i < 37; i++) {
+			md_map_sh256(ref[i], msg[i], len[i]);
+		}
+		for (k = 0; k < 4; k++) {
+			/* Skip the implementations not supported by the processor. */
+			if (md_sh256_set(kernel[k]) != kernel[k]) {
+				continue;
+			}
+			memset(out, 0, sizeof(out));
+			md_map_sh256_many(dig, msg, len, 37);
+			for (i = 0; i < 37; i++) {
+				TEST_ASSERT(memcmp(out[i], ref[i], 32) == 0, end);
+				md_map_sh256(digest, msg[i], len[i]);
+				TEST_ASSERT(memcmp(digest, ref[i], 32) == 0, end);
+			}
+		}
+		md_sh256_set(RLC_MD_SH256_ALL);
+	}
+	TEST_END;
+
 	TEST_ONCE("sha256 xmd function is correct") {
 		uint8_t buf[75] = {0,};
 		md_xmd_sh256(buf, 16, (uint8_t *)TEST1, strlen(TEST1), (uint8_t *)"", 0);
@@ -222,6 +282,29 @@ static int sha256(void) {
 	}
 	TEST_END;
 
+	TEST_ONCE("sha256 xmd function of several messages is correct") {
+		uint8_t buf[4][75], ref[75], *out[4];
+		const uint8_t *msg[4] = {
+			(uint8_t *)TEST1, (uint8_t *)TEST2a, (uint8_t *)TEST3a,
+			(uint8_t *)TEST4a
+		};
+		int len[4] = {
+			strlen(TEST1), strlen(TEST2a), strlen(TEST3a), strlen(TEST4a)
+		};
+		for (i = 0; i < 4; i++) {
+			out[i] = buf[i];
+		}
+		md_xmd_sh256_many(out, 75, msg, len, 4, (uint8_t *)TEST4b,
+				strlen(TEST4b));
+		for (i = 0; i < 4; i++) {
+			md_xmd_sh256(ref, 75, msg[i], len[i], (uint8_t *)TEST4b,
+					strlen(TEST4b));
+			TEST_ASSERT(memcmp(buf[i], ref, 75) == 0, end);
+		}
+		TEST_ASSERT(memcmp(buf[3], result_xmd_sha256[3], 75) == 0, end);
+	}
+	TEST_END;
+
 	code = RLC_OK;
 
   end:
@@ -561,12 +561,21 @@ static int simultaneous1(void) {
 
 static int validity1(void) {
 	int code = RLC_ERR;
-	g1_t a;
+	g1_t a, d[11], e[11];
+	int r;
 
 	g1_null(a);
+	for (int j = 0; j < 11; j++) {
+		g1_null(d[j]);
+		g1_null(e[j]);
+	}
 
 	RLC_TRY {
 		g1_new(a);
+		for (int j = 0; j < 11; j++) {
+			g1_new(d[j]);
+			g1_new(e[j]);
+		}
 
 		TEST_CASE("validity test is correct") {
 			g1_set_infty(a);
@@ -581,6 +590,20 @@ static int validity1(void) {
 			g1_blind(a, a);
 			TEST_ASSERT(g1_is_valid(a), end);
 		} TEST_END;
+
+		TEST_CASE("batch decompression with validity test is correct") {
+			for (int j = 0; j < 11; j++) {
+				g1_rand(d[j]);
+				ep_pck(e[j], d[j]);
+			}
+			TEST_ASSERT(g1_upk_many(d, (const g1_t *)e, 11, 1), end);
+			/* A random abscissa is rarely in the subgroup, if on the curve. */
+			fp_rand(e[4]->x);
+			r = ep_upk(a, e[4]);
+			TEST_ASSERT(g1_upk_many(d, (const g1_t *)e, 11, 0) == r, end);
+			r = r && g1_is_valid(a);
+			TEST_ASSERT(g1_upk_many(d, (const g1_t *)e, 11, 1) == r, end);
+		} TEST_END;
 	}
 	RLC_CATCH_ANY {
 		RLC_ERROR(end);
@@ -588,6 +611,10 @@ static int validity1(void) {
 	code = RLC_OK;
   end:
 	g1_free(a);
+	for (int j = 0; j < 11; j++) {
+		g1_free(d[j]);
+		g1_free(e[j]);
+	}
 	return code;
 }
 
@@ -1436,8 +1463,8 @@ static int inversion(void) {
 
 int exponentiation(void) {
 	int code = RLC_ERR;
-	gt_t a, b, c;
-	bn_t n, d, e;
+	gt_t a, b, c, f[4];
+	bn_t n, d, e, g[4];
 
 	gt_null(a);
 	gt_null(b);
@@ -1445,6 +1472,10 @@ int exponentiation(void) {
 	bn_null(d);
 	bn_null(e);
 	bn_null(n);
+	for (int j = 0; j < 4; j++) {
+		gt_null(f[j]);
+		bn_null(g[j]);
+	}
 
 	RLC_TRY {
 		gt_new(a);
@@ -1453,6 +1484,10 @@ int exponentiation(void) {
 		bn_new(d);
 		bn_new(e);
 		bn_new(n);
+		for (int j = 0; j < 4; j++) {
+			gt_new(f[j]);
+			bn_new(g[j]);
+		}
 
 		gt_get_gen(a);
 		pc_get_ord(n);
@@ -1507,6 +1542,34 @@ int exponentiation(void) {
 			gt_exp_dig(c, a, d->dp[0]);
 			TEST_ASSERT(gt_cmp(b, c) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_CASE("simultaneous exponentiation of many elements is correct") {
+			gt_set_unity(c);
+			for (int j = 0; j < 4; j++) {
+				gt_rand(f[j]);
+				bn_rand_mod(g[j], n);
+				gt_exp(b, f[j], g[j]);
+				gt_mul(c, c, b);
+				gt_exp_sim_lot(b, f, g, j + 1);
+				TEST_ASSERT(gt_cmp(b, c) == RLC_EQ, end);
+			}
+			gt_exp(b, f[0], g[0]);
+			gt_inv(b, b);
+			gt_mul(c, c, b);
+			bn_zero(g[0]);
+			gt_exp_sim_lot(b, f, g, 4);
+			TEST_ASSERT(gt_cmp(b, c) == RLC_EQ, end);
+			gt_exp(b, f[1], g[1]);
+			gt_inv(b, b);
+			gt_mul(c, c, b);
+			gt_mul(c, c, b);
+			bn_neg(g[1], g[1]);
+			gt_exp_sim_lot(b, f, g, 4);
+			TEST_ASSERT(gt_cmp(b, c) == RLC_EQ, end);
+			bn_add(g[2], g[2], n);
+			gt_exp_sim_lot(b, f, g, 4);
+			TEST_ASSERT(gt_cmp(b, c) == RLC_EQ, end);
+		} TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -1520,6 +1583,10 @@ int exponentiation(void) {
 	bn_free(d);
 	bn_free(e);
 	bn_free(n);
+	for (int j = 0; j < 4; j++) {
+		gt_free(f[j]);
+		bn_free(g[j]);
+	}
 	return code;
 }
 
@@ -1551,10 +1618,13 @@ static int validity(void) {
 
 static int pairing(void) {
 	int j, code = RLC_ERR;
-	g1_t p[2];
-	g2_t q[2];
+	g1_t p[8];
+	g2_t q[8];
 	gt_t e1, e2;
 	bn_t k, n;
+#if FP_PRIME < 1536
+	ln_t t[RLC_PC_TABLE];
+#endif
 
 	gt_null(e1);
 	gt_null(e2);
@@ -1567,12 +1637,18 @@ static int pairing(void) {
 		bn_new(k);
 		bn_new(n);
 
-		for (j = 0; j < 2; j++) {
+		for (j = 0; j < 8; j++) {
 			g1_null(p[j]);
 			g2_null(q[j]);
 			g1_new(p[j]);
 			g2_new(q[j]);
 		}
+#if FP_PRIME < 1536
+		for (j = 0; j < RLC_PC_TABLE; j++) {
+			ln_null(t[j]);
+			ln_new(t[j]);
+		}
+#endif
 
 		pc_get_ord(n);
 
@@ -1637,6 +1713,44 @@ static int pairing(void) {
 			pc_map_sim(e2, p, q, 2);
 			TEST_ASSERT(gt_cmp(e1, e2) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_CASE("multi-pairing of many pairs is correct") {
+			gt_set_unity(e1);
+			for (j = 0; j < 8; j++) {
+				g1_rand(p[j]);
+				g2_rand(q[j]);
+				if (j == 3) {
+					g2_set_infty(q[j]);
+				} else {
+					pc_map(e2, p[j], q[j]);
+					gt_mul(e1, e1, e2);
+				}
+			}
+			pc_map_sim(e2, p, q, 8);
+			TEST_ASSERT(gt_cmp(e1, e2) == RLC_EQ, end);
+		} TEST_END;
+
+#if FP_PRIME < 1536
+		TEST_CASE("pairing with fixed argument is correct") {
+			g1_rand(p[0]);
+			g2_rand(q[0]);
+			pc_map_pre(t, q[0]);
+			pc_map_fix(e1, p[0], t);
+			TEST_ASSERT(gt_is_unity(e1) == 0, end);
+#if PP_MAP == OATEP
+			pc_map(e2, p[0], q[0]);
+			TEST_ASSERT(gt_cmp(e1, e2) == RLC_EQ, end);
+#endif
+			bn_rand_mod(k, n);
+			g1_mul(p[1], p[0], k);
+			pc_map_fix(e2, p[1], t);
+			gt_exp(e1, e1, k);
+			TEST_ASSERT(gt_cmp(e1, e2) == RLC_EQ, end);
+			g1_set_infty(p[0]);
+			pc_map_fix(e1, p[0], t);
+			TEST_ASSERT(gt_is_unity(e1), end);
+		} TEST_END;
+#endif
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -1648,10 +1762,15 @@ static int pairing(void) {
 	gt_free(e2);
 	bn_free(k);
 	bn_free(n);
-	for (j = 0; j < 2; j++) {
+	for (j = 0; j < 8; j++) {
 		g1_free(p[j]);
 		g2_free(q[j]);
 	}
+#if FP_PRIME < 1536
+	for (j = 0; j < RLC_PC_TABLE; j++) {
+		ln_free(t[j]);
+	}
+#endif
 	return code;
 }
 
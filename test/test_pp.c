@@ -1066,16 +1066,19 @@ static int addition12(void) {
 }
 
 static int pairing12(void) {
-	int j, code = RLC_ERR;
+	int j, l, m = 0, code = RLC_ERR;
 	bn_t k, n;
-	ep_t p[2];
-	ep2_t q[2], r;
-	fp12_t e1, e2;
+	ep_t p[2], *u = NULL;
+	ep2_t q[2], r, *v = NULL;
+	fp12_t e1, e2, f[2];
+	fp2_t t[2][RLC_PP_TABLE_K12], *_t[2];
 
 	bn_null(k);
 	bn_null(n);
 	fp12_null(e1);
 	fp12_null(e2);
+	fp12_null(f[0]);
+	fp12_null(f[1]);
 	ep2_null(r);
 
 	RLC_TRY {
@@ -1083,6 +1086,8 @@ static int pairing12(void) {
 		bn_new(k);
 		fp12_new(e1);
 		fp12_new(e2);
+		fp12_new(f[0]);
+		fp12_new(f[1]);
 		ep2_new(r);
 
 		for (j = 0; j < 2; j++) {
@@ -1090,6 +1095,11 @@ static int pairing12(void) {
 			ep2_null(q[j]);
 			ep_new(p[j]);
 			ep2_new(q[j]);
+			for (l = 0; l < RLC_PP_TABLE_K12; l++) {
+				fp2_null(t[j][l]);
+				fp2_new(t[j][l]);
+			}
+			_t[j] = t[j];
 		}
 
 		ep_curve_get_ord(n);
@@ -1343,7 +1353,100 @@ static int pairing12(void) {
 			pp_map_sim_oatep_k12(e2, p, q, 2);
 			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_CASE("optimal ate multi-pairing in affine coordinates is correct") {
+			ep_rand(p[0]);
+			ep2_rand(q[0]);
+			ep_rand(p[1]);
+			ep2_rand(q[1]);
+			pp_map_sim_oatep_k12(e1, p, q, 2);
+			pp_map_sim_oatep_k12_aff(e2, p, q, 2);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			pp_map_sim_oatep_k12_aff(e2, p, q, 1);
+			pp_map_oatep_k12(e1, p[0], q[0]);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			ep2_set_infty(q[i % 2]);
+			pp_map_oatep_k12(e1, p[1 - (i % 2)], q[1 - (i % 2)]);
+			pp_map_sim_oatep_k12_aff(e2, p, q, 2);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_ONCE("optimal ate multi-pairing of many pairs is correct") {
+			/* Give each thread enough pairs to take the affine Miller loop. */
+			m = RLC_PP_AFF_MIN * CORES;
+			u = RLC_MALLOC(ep_t, m);
+			v = RLC_MALLOC(ep2_t, m);
+
+			TEST_ASSERT(u != NULL && v != NULL, end);
+			for (l = 0; l < m; l++) {
+				ep_null(u[l]);
+				ep2_null(v[l]);
+				ep_new(u[l]);
+				ep2_new(v[l]);
+			}
+			fp12_set_dig(f[0], 1);
+			for (l = 0; l < m; l++) {
+				ep_rand(u[l]);
+				ep2_rand(v[l]);
+				pp_map_oatep_k12(e2, u[l], v[l]);
+				fp12_copy(e1, f[0]);
+				fp12_mul(f[0], f[0], e2);
+			}
+			pp_map_sim_oatep_k12(e2, u, v, m);
+			TEST_ASSERT(fp12_cmp(f[0], e2) == RLC_EQ, end);
+			pp_map_sim_oatep_k12_aff(e2, u, v, m);
+			TEST_ASSERT(fp12_cmp(f[0], e2) == RLC_EQ, end);
+			/* Pairs at infinity are left out of the shared inversions. */
+			ep2_set_infty(v[m - 1]);
+			pp_map_sim_oatep_k12_aff(e2, u, v, m);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("optimal ate pairing with precomputation is correct") {
+			ep_rand(p[0]);
+			ep2_rand(q[0]);
+			pp_map_oatep_k12(e1, p[0], q[0]);
+			pp_map_pre_k12(t[0], q[0]);
+			pp_map_oatep_k12_pre(e2, p[0], t[0]);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			ep2_set_infty(q[0]);
+			pp_map_pre_k12(t[0], q[0]);
+			pp_map_oatep_k12_pre(e2, p[0], t[0]);
+			TEST_ASSERT(fp12_cmp_dig(e2, 1) == RLC_EQ, end);
+			ep_set_infty(p[0]);
+			ep2_rand(q[0]);
+			pp_map_pre_k12(t[0], q[0]);
+			pp_map_oatep_k12_pre(e2, p[0], t[0]);
+			TEST_ASSERT(fp12_cmp_dig(e2, 1) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("optimal ate multi-pairing with precomputation is correct") {
+			ep_rand(p[0]);
+			ep2_rand(q[0]);
+			ep_rand(p[1]);
+			ep2_rand(q[1]);
+			pp_map_sim_oatep_k12(e1, p, q, 2);
+			pp_map_pre_k12(t[0], q[0]);
+			pp_map_pre_k12(t[1], q[1]);
+			pp_map_sim_oatep_k12_pre(e2, p, _t, 2);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			ep2_set_infty(q[i % 2]);
+			pp_map_oatep_k12(e1, p[1 - (i % 2)], q[1 - (i % 2)]);
+			pp_map_pre_k12(t[i % 2], q[i % 2]);
+			pp_map_sim_oatep_k12_pre(e2, p, _t, 2);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+		} TEST_END;
 #endif
+
+		TEST_CASE("final exponentiation of multiple elements is correct") {
+			fp12_rand(f[0]);
+			fp12_rand(f[1]);
+			pp_exp_k12(e1, f[0]);
+			pp_exp_k12(e2, f[1]);
+			pp_exp_k12_many(f, f, 2);
+			TEST_ASSERT(fp12_cmp(e1, f[0]) == RLC_EQ &&
+					fp12_cmp(e2, f[1]) == RLC_EQ, end);
+		} TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -1355,12 +1458,25 @@ static int pairing12(void) {
 	bn_free(k);
 	fp12_free(e1);
 	fp12_free(e2);
+	fp12_free(f[0]);
+	fp12_free(f[1]);
 	ep2_free(r);
 
 	for (j = 0; j < 2; j++) {
 		ep_free(p[j]);
 		ep2_free(q[j]);
+		for (l = 0; l < RLC_PP_TABLE_K12; l++) {
+			fp2_free(t[j][l]);
+		}
+	}
+	for (l = 0; u != NULL && l < m; l++) {
+		ep_free(u[l]);
 	}
+	for (l = 0; v != NULL && l < m; l++) {
+		ep2_free(v[l]);
+	}
+	alloc_free((void *)u);
+	alloc_free((void *)v);
 	return code;
 }
 
@@ -1552,16 +1668,19 @@ static int addition24(void) {
 }
 
 static int pairing24(void) {
-	int j, code = RLC_ERR;
+	int j, l, code = RLC_ERR;
 	bn_t k, n;
 	ep_t p[2];
 	ep4_t q[2], r;
-	fp24_t e1, e2;
+	fp24_t e1, e2, f[2];
+	fp4_t t[2][RLC_PP_TABLE_K24], *_t[2];
 
 	bn_null(k);
 	bn_null(n);
 	fp24_null(e1);
 	fp24_null(e2);
+	fp24_null(f[0]);
+	fp24_null(f[1]);
 	ep4_null(r);
 
 	RLC_TRY {
@@ -1569,6 +1688,8 @@ static int pairing24(void) {
 		bn_new(k);
 		fp24_new(e1);
 		fp24_new(e2);
+		fp24_new(f[0]);
+		fp24_new(f[1]);
 		ep4_new(r);
 
 		for (j = 0; j < 2; j++) {
@@ -1576,6 +1697,11 @@ static int pairing24(void) {
 			ep4_null(q[j]);
 			ep_new(p[j]);
 			ep4_new(q[j]);
+			for (l = 0; l < RLC_PP_TABLE_K24; l++) {
+				fp4_null(t[j][l]);
+				fp4_new(t[j][l]);
+			}
+			_t[j] = t[j];
 		}
 
 		ep_curve_get_ord(n);
@@ -1641,6 +1767,51 @@ static int pairing24(void) {
 			pp_map_sim_k24(e2, p, q, 2);
 			TEST_ASSERT(fp24_cmp(e1, e2) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_CASE("pairing with precomputation is correct") {
+			ep_rand(p[0]);
+			ep4_rand(q[0]);
+			pp_map_k24(e1, p[0], q[0]);
+			pp_map_pre_k24(t[0], q[0]);
+			pp_map_k24_pre(e2, p[0], t[0]);
+			TEST_ASSERT(fp24_cmp(e1, e2) == RLC_EQ, end);
+			ep4_set_infty(q[0]);
+			pp_map_pre_k24(t[0], q[0]);
+			pp_map_k24_pre(e2, p[0], t[0]);
+			TEST_ASSERT(fp24_cmp_dig(e2, 1) == RLC_EQ, end);
+			ep_set_infty(p[0]);
+			ep4_rand(q[0]);
+			pp_map_pre_k24(t[0], q[0]);
+			pp_map_k24_pre(e2, p[0], t[0]);
+			TEST_ASSERT(fp24_cmp_dig(e2, 1) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("multi-pairing with precomputation is correct") {
+			ep_rand(p[0]);
+			ep4_rand(q[0]);
+			ep_rand(p[1]);
+			ep4_rand(q[1]);
+			pp_map_sim_k24(e1, p, q, 2);
+			pp_map_pre_k24(t[0], q[0]);
+			pp_map_pre_k24(t[1], q[1]);
+			pp_map_sim_k24_pre(e2, p, _t, 2);
+			TEST_ASSERT(fp24_cmp(e1, e2) == RLC_EQ, end);
+			ep4_set_infty(q[i % 2]);
+			pp_map_k24(e1, p[1 - (i % 2)], q[1 - (i % 2)]);
+			pp_map_pre_k24(t[i % 2], q[i % 2]);
+			pp_map_sim_k24_pre(e2, p, _t, 2);
+			TEST_ASSERT(fp24_cmp(e1, e2) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("final exponentiation of multiple elements is correct") {
+			fp24_rand(f[0]);
+			fp24_rand(f[1]);
+			pp_exp_k24(e1, f[0]);
+			pp_exp_k24(e2, f[1]);
+			pp_exp_k24_many(f, f, 2);
+			TEST_ASSERT(fp24_cmp(e1, f[0]) == RLC_EQ &&
+					fp24_cmp(e2, f[1]) == RLC_EQ, end);
+		} TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -1652,11 +1823,16 @@ static int pairing24(void) {
 	bn_free(k);
 	fp24_free(e1);
 	fp24_free(e2);
+	fp24_free(f[0]);
+	fp24_free(f[1]);
 	ep4_free(r);
 
 	for (j = 0; j < 2; j++) {
 		ep_free(p[j]);
 		ep4_free(q[j]);
+		for (l = 0; l < RLC_PP_TABLE_K24; l++) {
+			fp4_free(t[j][l]);
+		}
 	}
 	return code;
 }
@@ -1966,30 +2142,44 @@ static int addition48(void) {
 }
 
 static int pairing48(void) {
-	int code = RLC_ERR;
+	int j, code = RLC_ERR;
 	bn_t k, n;
-	ep_t p;
-	fp8_t qx, qy, qz;
-	fp48_t e1, e2;
+	ep_t p, _p[2];
+	fp8_t qx, qy, qz, t[RLC_PP_TABLE_K48], *_t[2];
+	fp48_t e1, e2, f[2];
 
 	bn_null(k);
 	bn_null(n);
 	ep_null(p);
+	ep_null(_p[0]);
+	ep_null(_p[1]);
 	fp8_null(qx);
 	fp8_null(qy);
 	fp8_null(qz);
 	fp48_null(e1);
 	fp48_null(e2);
+	fp48_null(f[0]);
+	fp48_null(f[1]);
+	for (j = 0; j < RLC_PP_TABLE_K48; j++) {
+		fp8_null(t[j]);
+	}
 
 	RLC_TRY {
 		bn_new(n);
 		bn_new(k);
 		ep_new(p);
+		ep_new(_p[0]);
+		ep_new(_p[1]);
 		fp8_new(qx);
 		fp8_new(qy);
 		fp8_new(qz);
 		fp48_new(e1);
 		fp48_new(e2);
+		fp48_new(f[0]);
+		fp48_new(f[1]);
+		for (j = 0; j < RLC_PP_TABLE_K48; j++) {
+			fp8_new(t[j]);
+		}
 
 		ep_curve_get_ord(n);
 
@@ -2035,6 +2225,43 @@ static int pairing48(void) {
 			fp48_sqr(e1, e1);
 			TEST_ASSERT(fp48_cmp(e1, e2) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_CASE("pairing with precomputation is correct") {
+			ep_rand(p);
+			pp_map_k48(e1, p, qx, qy);
+			pp_map_pre_k48(t, qx, qy);
+			pp_map_k48_pre(e2, p, t);
+			TEST_ASSERT(fp48_cmp(e1, e2) == RLC_EQ, end);
+			ep_set_infty(p);
+			pp_map_k48_pre(e2, p, t);
+			TEST_ASSERT(fp48_cmp_dig(e2, 1) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("multi-pairing with precomputation is correct") {
+			ep_rand(_p[0]);
+			ep_rand(_p[1]);
+			pp_map_pre_k48(t, qx, qy);
+			_t[0] = _t[1] = t;
+			pp_map_k48(e1, _p[0], qx, qy);
+			pp_map_k48(e2, _p[1], qx, qy);
+			fp48_mul(e1, e1, e2);
+			pp_map_sim_k48_pre(e2, _p, _t, 2);
+			TEST_ASSERT(fp48_cmp(e1, e2) == RLC_EQ, end);
+			ep_set_infty(_p[1]);
+			pp_map_k48(e1, _p[0], qx, qy);
+			pp_map_sim_k48_pre(e2, _p, _t, 2);
+			TEST_ASSERT(fp48_cmp(e1, e2) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("final exponentiation of multiple elements is correct") {
+			fp48_rand(f[0]);
+			fp48_rand(f[1]);
+			pp_exp_k48(e1, f[0]);
+			pp_exp_k48(e2, f[1]);
+			pp_exp_k48_many(f, f, 2);
+			TEST_ASSERT(fp48_cmp(e1, f[0]) == RLC_EQ &&
+					fp48_cmp(e2, f[1]) == RLC_EQ, end);
+		} TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -2045,11 +2272,18 @@ static int pairing48(void) {
 	bn_free(n);
 	bn_free(k);
 	ep_free(p);
+	ep_free(_p[0]);
+	ep_free(_p[1]);
 	fp8_free(qx);
 	fp8_free(qy);
 	fp8_free(qz);
 	fp48_free(e1);
 	fp48_free(e2);
+	fp48_free(f[0]);
+	fp48_free(f[1]);
+	for (j = 0; j < RLC_PP_TABLE_K48; j++) {
+		fp8_free(t[j]);
+	}
 	return code;
 }
 